@@ -0,0 +1,3 @@
+#pragma once
+#define GIT_COMMIT "584f5c0b17d2e71f989991e34722704eee0c3ff1"
+#define GIT_DIRTY 1
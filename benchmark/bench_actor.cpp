@@ -265,8 +265,148 @@ class QueryBench : public td::Benchmark {
   td::ActorOwn<ServerActor> server_;
 };
 
+class FanOutBench : public td::Benchmark {
+ public:
+  struct MasterActor;
+
+  std::string get_description() const override {
+    return PSTRING() << "FanOut (worker_n = " << worker_n_ << ", threads_n = " << thread_n_ << ")";
+  }
+
+  struct WorkerActor : public td::Actor {
+    td::ActorId<MasterActor> master;
+
+    void query(int x);
+  };
+
+  // master on the main scheduler fans each round out to workers pinned to other schedulers
+  // and waits for all replies, like Td sending queries to its Sessions
+  struct MasterActor : public td::Actor {
+    std::vector<td::ActorId<WorkerActor>> workers;
+    int pending = 0;
+    int rounds = 0;
+
+    void run(int n) {
+      rounds = td::max(n / static_cast<int>(workers.size()), 1);
+      send_round();
+    }
+    void send_round() {
+      pending = static_cast<int>(workers.size());
+      for (auto &worker : workers) {
+        send_closure(worker, &WorkerActor::query, rounds);
+      }
+    }
+    void on_result(int x) {
+      if (--pending != 0) {
+        return;
+      }
+      if (--rounds == 0) {
+        td::Scheduler::instance()->finish();
+      } else {
+        send_round();
+      }
+    }
+  };
+
+  FanOutBench(int worker_n, int thread_n) : worker_n_(worker_n), thread_n_(thread_n) {
+  }
+
+  void start_up() override {
+    scheduler_ = new td::ConcurrentScheduler();
+    scheduler_->init(thread_n_);
+
+    master_ = scheduler_->create_actor_unsafe<MasterActor>(0, "Master").release();
+    for (int i = 0; i < worker_n_; i++) {
+      auto worker = scheduler_
+                        ->create_actor_unsafe<WorkerActor>(thread_n_ > 1 ? 1 + i % (thread_n_ - 1) : 0, "Worker")
+                        .release();
+      worker.get_actor_unsafe()->master = master_;
+      master_.get_actor_unsafe()->workers.push_back(worker);
+    }
+    scheduler_->start();
+  }
+
+  void run(int n) override {
+    {
+      auto guard = scheduler_->get_main_guard();
+      send_closure(master_, &MasterActor::run, td::max(n, 100));
+    }
+    while (scheduler_->run_main(10)) {
+      // empty
+    }
+  }
+
+  void tear_down() override {
+    scheduler_->finish();
+    delete scheduler_;
+  }
+
+ private:
+  int worker_n_ = -1;
+  int thread_n_ = -1;
+  td::ActorId<MasterActor> master_;
+  td::ConcurrentScheduler *scheduler_ = nullptr;
+};
+
+void FanOutBench::WorkerActor::query(int x) {
+  send_closure(master, &MasterActor::on_result, x);
+}
+
+class MigrationBench : public td::Benchmark {
+ public:
+  std::string get_description() const override {
+    return PSTRING() << "Migration (threads_n = " << thread_n_ << ")";
+  }
+
+  // the actor hops between two worker schedulers, paying the full migration cost on each message
+  struct HopActor : public td::Actor {
+    void hop(int n) {
+      if (n == 0) {
+        td::Scheduler::instance()->finish();
+        return;
+      }
+      migrate(1 + (n & 1));
+      send_closure_later(actor_id(this), &HopActor::hop, n - 1);
+    }
+  };
+
+  explicit MigrationBench(int thread_n) : thread_n_(thread_n) {
+    CHECK(thread_n_ >= 3);
+  }
+
+  void start_up() override {
+    scheduler_ = new td::ConcurrentScheduler();
+    scheduler_->init(thread_n_);
+    actor_ = scheduler_->create_actor_unsafe<HopActor>(0, "Hop").release();
+    scheduler_->start();
+  }
+
+  void run(int n) override {
+    {
+      auto guard = scheduler_->get_main_guard();
+      send_closure(actor_, &HopActor::hop, td::max(n, 100));
+    }
+    while (scheduler_->run_main(10)) {
+      // empty
+    }
+  }
+
+  void tear_down() override {
+    scheduler_->finish();
+    delete scheduler_;
+  }
+
+ private:
+  int thread_n_ = -1;
+  td::ActorId<HopActor> actor_;
+  td::ConcurrentScheduler *scheduler_ = nullptr;
+};
+
 int main() {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(DEBUG));
+  bench(FanOutBench(16, 0));
+  bench(FanOutBench(16, 5));
+  bench(MigrationBench(3));
   bench(RingBench<4>(504, 0));
   bench(RingBench<3>(504, 0));
   bench(RingBench<0>(504, 0));
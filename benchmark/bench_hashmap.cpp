@@ -0,0 +1,89 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/benchmark.h"
+#include "td/utils/common.h"
+#include "td/utils/ConcurrentHashTable.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/Clocks.h"
+#include "td/utils/port/thread.h"
+
+#include <atomic>
+
+#if !TD_THREAD_UNSUPPORTED
+
+// Inserts keys into a ConcurrentHashMap growing from a single slot, so every run goes
+// through the whole chain of resizes. The maximum latency of a single insert shows
+// the cost of the incremental migration in the insert path.
+class ConcurrentHashMapInsertBench final : public td::Benchmark {
+  td::unique_ptr<td::ConcurrentHashMap<td::int32, td::int32>> hash_map_;
+  size_t threads_n_;
+  int n_ = 0;
+  std::atomic<td::int64> max_latency_ns_{0};
+
+ public:
+  explicit ConcurrentHashMapInsertBench(size_t threads_n) : threads_n_(threads_n) {
+  }
+
+  std::string get_description() const final {
+    return PSTRING() << "ConcurrentHashMap insert with growth, " << threads_n_ << " threads";
+  }
+
+  void start_up_n(int n) final {
+    n_ = n * static_cast<int>(threads_n_);
+    hash_map_ = td::make_unique<td::ConcurrentHashMap<td::int32, td::int32>>();
+    max_latency_ns_ = 0;
+  }
+
+  void run(int n) final {
+    n = n_;
+    td::vector<td::thread> threads;
+    for (size_t thread_id = 0; thread_id < threads_n_; thread_id++) {
+      auto l = static_cast<int>(static_cast<size_t>(n) * thread_id / threads_n_);
+      auto r = static_cast<int>(static_cast<size_t>(n) * (thread_id + 1) / threads_n_);
+      threads.emplace_back([l, r, this] {
+        td::int64 max_latency_ns = 0;
+        for (int i = l; i < r; i++) {
+          // the map expects randomized keys; decorate the counter with a multiplicative hash
+          auto key = static_cast<td::int32>(static_cast<td::uint32>(i + 1) * 2654435761u) | 1;
+          auto start = td::Clocks::monotonic();
+          hash_map_->insert(key, i + 2);
+          auto latency_ns = static_cast<td::int64>((td::Clocks::monotonic() - start) * 1e9);
+          if (latency_ns > max_latency_ns) {
+            max_latency_ns = latency_ns;
+          }
+        }
+        auto old_max = max_latency_ns_.load();
+        while (old_max < max_latency_ns && !max_latency_ns_.compare_exchange_weak(old_max, max_latency_ns)) {
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  void tear_down() final {
+    LOG(ERROR) << get_description() << ": " << n_ << " inserts, max insert latency "
+               << max_latency_ns_.load() / 1000 << "us";
+    hash_map_.reset();
+  }
+};
+
+int main() {
+  td::bench(ConcurrentHashMapInsertBench(1));
+  td::bench(ConcurrentHashMapInsertBench(4));
+  td::bench(ConcurrentHashMapInsertBench(16));
+  return 0;
+}
+
+#else
+
+int main() {
+  return 0;
+}
+
+#endif
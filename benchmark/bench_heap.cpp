@@ -0,0 +1,50 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/benchmark.h"
+#include "td/utils/common.h"
+#include "td/utils/Heap.h"
+#include "td/utils/logging.h"
+#include "td/utils/Random.h"
+
+// Simulates a timeout-heavy scheduler in steady state: the heap holds a large
+// number of armed timers, and every iteration fires the nearest one and re-arms
+// it at a random point in the future. K is the heap arity; KHeap uses K = 4 by
+// default because the sibling scan of fix_down stays within one cache line there.
+template <int K>
+class HeapChurnBench final : public td::Benchmark {
+  static constexpr int TIMER_COUNT = 1 << 20;
+
+  td::KHeap<double, K> heap_;
+  td::vector<td::HeapNode> nodes_;
+
+ public:
+  std::string get_description() const final {
+    return PSTRING() << "KHeap churn with " << TIMER_COUNT << " timers, K = " << K;
+  }
+
+  void start_up() final {
+    heap_ = td::KHeap<double, K>();
+    nodes_ = td::vector<td::HeapNode>(TIMER_COUNT);
+    for (auto &node : nodes_) {
+      heap_.insert(td::Random::fast(0, 1000000) * 0.001, &node);
+    }
+  }
+
+  void run(int n) final {
+    for (int i = 0; i < n; i++) {
+      auto now = heap_.top_key();
+      auto *node = heap_.pop();
+      heap_.insert(now + 1 + td::Random::fast(0, 999) * 0.001, node);
+    }
+  }
+};
+
+int main() {
+  td::bench(HeapChurnBench<2>());
+  td::bench(HeapChurnBench<4>());
+  td::bench(HeapChurnBench<8>());
+}
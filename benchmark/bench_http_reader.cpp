@@ -52,6 +52,40 @@ class HttpReaderBench : public td::Benchmark {
   }
 };
 
+class HttpBodyReaderBench : public td::Benchmark {
+  std::string get_description() const override {
+    return "HttpBodyReaderBench";
+  }
+
+  void run(int n) override {
+    std::string http_post_query =
+        "POST / HTTP/1.1\r\nConnection:keep-alive\r\nhost:127.0.0.1:8080\r\nContent-Length:5000\r\n\r\n" +
+        std::string(5000, 'a');
+    td::HttpQuery q;
+    int parsed = 0;
+    for (int i = 0; i < n; i++) {
+      writer_.append(http_post_query);
+      reader_.sync_with_writer();
+      while (true) {
+        auto wait = http_reader_.read_next(&q).ok();
+        if (wait != 0) {
+          break;
+        }
+        parsed++;
+      }
+    }
+    CHECK(parsed == n);
+  }
+  td::ChainBufferWriter writer_;
+  td::ChainBufferReader reader_;
+  td::HttpReader http_reader_;
+
+  void start_up() override {
+    reader_ = writer_.extract_reader();
+    http_reader_.init(&reader_, 1 << 20, 0);
+  }
+};
+
 class BufferBench : public td::Benchmark {
   std::string get_description() const override {
     return "BufferBench";
@@ -113,4 +147,5 @@ int main() {
   td::bench(BufferBench());
   td::bench(FindBoundaryBench());
   td::bench(HttpReaderBench());
+  td::bench(HttpBodyReaderBench());
 }
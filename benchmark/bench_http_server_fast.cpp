@@ -36,7 +36,7 @@ class HttpEchoConnection : public Actor {
   }
 
   void handle_query() {
-    query_ = HttpQuery();
+    query_.clear();
     HttpHeaderCreator hc;
     Slice content = "hello world";
     //auto content = BufferSlice("hello world");
@@ -0,0 +1,75 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/Client.h"
+#include "td/telegram/td_api.h"
+
+#include "td/utils/benchmark.h"
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/Clocks.h"
+
+#include <algorithm>
+
+namespace td {
+
+// Server updates can't be fed into MessagesManager through the public
+// interface, so this measures the pipeline every message travels through
+// instead: Client::send from the caller's thread, the scheduler hop to the Td
+// actor, request dispatch and Client::receive of the answer. testCallString
+// round-trips a message-sized payload before initialization, so no network or
+// database is involved and the numbers isolate the per-message framework
+// overhead. The window size controls how many requests are kept in flight,
+// like a flood of updates waiting in the Td mailbox.
+class TdClientRoundtripBenchmark : public Benchmark {
+ public:
+  explicit TdClientRoundtripBenchmark(size_t window_size) : window_size_(window_size) {
+  }
+
+  string get_description() const override {
+    return PSTRING() << "Client roundtrips with " << window_size_ << " requests in flight";
+  }
+
+  void run(int n) override {
+    Client client;
+    auto query_count = static_cast<size_t>(n);
+    vector<double> sent_at(query_count);
+    vector<double> latencies(query_count);
+    string payload(100, 'a');
+    size_t sent = 0;
+    size_t received = 0;
+    while (received < query_count) {
+      while (sent < query_count && sent - received < window_size_) {
+        sent_at[sent] = Clocks::monotonic();
+        client.send({sent + 1, td_api::make_object<td_api::testCallString>(payload)});
+        sent++;
+      }
+      auto response = client.receive(10);
+      if (response.id == 0) {
+        // an authorization state update, not an answer
+        continue;
+      }
+      latencies[received] = Clocks::monotonic() - sent_at[static_cast<size_t>(response.id - 1)];
+      received++;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    LOG(INFO) << get_description() << ": latency p50 = " << latencies[query_count / 2] * 1e6
+              << " us, p99 = " << latencies[query_count * 99 / 100] * 1e6 << " us";
+  }
+
+ private:
+  size_t window_size_;
+};
+
+}  // namespace td
+
+int main() {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(INFO));
+  td::bench(td::TdClientRoundtripBenchmark(1));
+  td::bench(td::TdClientRoundtripBenchmark(10));
+  td::bench(td::TdClientRoundtripBenchmark(100));
+  return 0;
+}
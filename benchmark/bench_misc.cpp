@@ -4,6 +4,7 @@
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
+#include "td/utils/base64.h"
 #include "td/utils/benchmark.h"
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
@@ -68,6 +69,31 @@ BENCH(EventFd, "EventFd") {
 }
 #endif
 
+BENCH(Base64Encode, "base64_encode 1KB") {
+  string input(1024, '\0');
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<char>(i * 7);
+  }
+  size_t res = 0;
+  for (int i = 0; i < n; i++) {
+    res += base64_encode(input).size();
+  }
+  do_not_optimize_away(res);
+}
+
+BENCH(Base64Decode, "base64_decode 1KB") {
+  string input(1024, '\0');
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = static_cast<char>(i * 7);
+  }
+  string encoded = base64_encode(input);
+  size_t res = 0;
+  for (int i = 0; i < n; i++) {
+    res += base64_decode(encoded).ok().size();
+  }
+  do_not_optimize_away(res);
+}
+
 BENCH(NewInt, "new int + delete") {
   std::uintptr_t res = 0;
   for (int i = 0; i < n; i++) {
@@ -376,6 +402,9 @@ int main() {
   td::bench(td::CreateFileBench());
   td::bench(td::PwriteBench());
 
+  td::bench(td::Base64EncodeBench());
+  td::bench(td::Base64DecodeBench());
+
   td::bench(td::CallBench());
 #if !TD_THREAD_UNSUPPORTED
   td::bench(td::ThreadNewBench());
@@ -7,11 +7,13 @@
 #include "td/utils/benchmark.h"
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
+#include "td/utils/MpmcQueue.h"
 #include "td/utils/MpscPollableQueue.h"
 #include "td/utils/port/sleep.h"
 #include "td/utils/port/thread.h"
 #include "td/utils/queue.h"
 #include "td/utils/Random.h"
+#include "td/utils/SharedObjectPool.h"
 
 // TODO: check system calls
 // TODO: all return values must be checked
@@ -929,9 +931,175 @@ void test_queue() {
   }
 }
 
+// Adapters giving the unbounded node-based MpmcQueue and the bounded array
+// MpmcBoundedQueue the same blocking push/pop interface, so they can be
+// compared under the same producer-consumer load
+class MpmcQueueAdapter {
+ public:
+  explicit MpmcQueueAdapter(size_t threads_n) : queue_(threads_n) {
+  }
+  static std::string get_description() {
+    return "unbounded MpmcQueue";
+  }
+  void push(qvalue_t value, size_t thread_id) {
+    queue_.push(value, thread_id);
+  }
+  qvalue_t pop(size_t thread_id) {
+    qvalue_t value;
+    Backoff backoff;
+    while (!queue_.try_pop(value, thread_id)) {
+      backoff.next();
+    }
+    return value;
+  }
+
+ private:
+  td::MpmcQueue<qvalue_t> queue_;
+};
+
+class MpmcBoundedQueueAdapter {
+ public:
+  explicit MpmcBoundedQueueAdapter(size_t) : queue_(1024) {
+  }
+  static std::string get_description() {
+    return "MpmcBoundedQueue";
+  }
+  void push(qvalue_t value, size_t) {
+    Backoff backoff;
+    while (!queue_.try_push(value)) {
+      backoff.next();
+    }
+  }
+  qvalue_t pop(size_t) {
+    qvalue_t value;
+    Backoff backoff;
+    while (!queue_.try_pop(value)) {
+      backoff.next();
+    }
+    return value;
+  }
+
+ private:
+  td::MpmcBoundedQueue<qvalue_t> queue_;
+};
+
+template <class QueueT>
+class MpmcProducerConsumerBenchmark : public td::Benchmark {
+ public:
+  explicit MpmcProducerConsumerBenchmark(int threads_n) : threads_n_(threads_n) {
+  }
+
+  std::string get_description() const override {
+    return PSTRING() << QueueT::get_description() << " with " << threads_n_ << " producers and " << threads_n_
+                     << " consumers";
+  }
+
+  void run(int n) override {
+    QueueT queue(static_cast<size_t>(2 * threads_n_));
+    std::vector<td::thread> consumers;
+    for (int i = 0; i < threads_n_; i++) {
+      consumers.emplace_back([&queue, thread_id = static_cast<size_t>(threads_n_ + i)] {
+        while (queue.pop(thread_id) != -1) {
+        }
+      });
+    }
+    std::vector<td::thread> producers;
+    for (int i = 0; i < threads_n_; i++) {
+      producers.emplace_back([&queue, this, n, thread_id = static_cast<size_t>(i)] {
+        for (int value = static_cast<int>(thread_id); value < n; value += threads_n_) {
+          queue.push(value, thread_id);
+        }
+      });
+    }
+    for (auto &producer : producers) {
+      producer.join();
+    }
+    for (int i = 0; i < threads_n_; i++) {
+      // producer thread identifiers are free again
+      queue.push(-1, static_cast<size_t>(i % threads_n_));
+    }
+    for (auto &consumer : consumers) {
+      consumer.join();
+    }
+  }
+
+ private:
+  int threads_n_;
+};
+
+// Measures contention on the free list of SharedObjectPool: the owner thread
+// allocates objects and hands them out, while releaser threads drop their
+// references concurrently, so every recycling is a push to the pool's
+// lock-free queue from a foreign thread, like NetQuery churn across schedulers.
+class SharedObjectPoolContentionBenchmark : public td::Benchmark {
+ public:
+  explicit SharedObjectPoolContentionBenchmark(int threads_n) : threads_n_(threads_n) {
+  }
+
+  std::string get_description() const override {
+    return PSTRING() << "SharedObjectPool churn with " << threads_n_ << " releaser threads";
+  }
+
+  void run(int n) override {
+    td::SharedObjectPool<int> pool;
+    using Ptr = decltype(pool.alloc(0));
+    std::vector<td::MpscPollableQueue<Ptr>> queues(threads_n_);
+    for (auto &queue : queues) {
+      queue.init();
+    }
+    std::vector<td::thread> threads;
+    for (int i = 0; i < threads_n_; i++) {
+      threads.emplace_back([&queue = queues[i]] {
+        while (true) {
+          auto ready_count = queue.reader_wait_nonblock();
+          if (ready_count == 0) {
+            queue.reader_get_event_fd().wait(1000);
+            continue;
+          }
+          while (ready_count-- > 0) {
+            auto ptr = queue.reader_get_unsafe();
+            if (ptr.empty()) {
+              return;
+            }
+            // dropping ptr recycles the object into the pool from this thread
+          }
+        }
+      });
+    }
+    for (int i = 0; i < n; i++) {
+      queues[i % threads_n_].writer_put(pool.alloc(i));
+    }
+    for (auto &queue : queues) {
+      queue.writer_put(Ptr());
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+ private:
+  int threads_n_;
+};
+
 int main() {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(DEBUG));
   //test_queue();
+
+#define BENCH_MPMC(N)                                                  \
+  std::fprintf(stderr, "MpmcQueue %dx%d:\t", N, N);                    \
+  td::bench(MpmcProducerConsumerBenchmark<MpmcQueueAdapter>(N));       \
+  std::fprintf(stderr, "MpmcBoundedQueue %dx%d:\t", N, N);             \
+  td::bench(MpmcProducerConsumerBenchmark<MpmcBoundedQueueAdapter>(N));
+
+  // 2, 4 and 16 threads split evenly between producers and consumers
+  BENCH_MPMC(1);
+  BENCH_MPMC(2);
+  BENCH_MPMC(8);
+
+  std::fprintf(stderr, "SharedObjectPool 1:\t");
+  td::bench(SharedObjectPoolContentionBenchmark(1));
+  std::fprintf(stderr, "SharedObjectPool 4:\t");
+  td::bench(SharedObjectPoolContentionBenchmark(4));
 #define BENCH_Q2(Q, N)                      \
   std::fprintf(stderr, "!%s %d:\t", #Q, N); \
   td::bench(QueueBenchmark2<Q>(N));
@@ -117,6 +117,39 @@ static Backtrace get_backtrace() {
   return res;
 }
 
+#if USE_MEMPROF_SAMPLING
+// Size-weighted sampling: a stack is captured roughly once per sample_interval
+// allocated bytes, so every allocation of at least the interval is sampled and
+// smaller ones are sampled proportionally to their size. Allocations that lose
+// the coin toss are charged to a shared "unsampled" bucket, which keeps
+// get_used_memory_size exact while making the per-allocation overhead a
+// thread-local subtraction.
+static constexpr std::size_t sample_interval = 1 << 19;
+
+static bool should_sample(std::size_t size) {
+  static __thread std::size_t countdown;  // static zero-initialized
+  if (countdown <= size) {
+    countdown = sample_interval;
+    return true;
+  }
+  countdown -= size;
+  return false;
+}
+
+static Backtrace get_allocation_backtrace(std::size_t size) {
+  if (should_sample(size)) {
+    return get_backtrace();
+  }
+  Backtrace res{{nullptr}};
+  res[0] = reinterpret_cast<void *>(2);
+  return res;
+}
+#else
+static Backtrace get_allocation_backtrace(std::size_t size) {
+  return get_backtrace();
+}
+#endif
+
 static constexpr std::size_t reserved = 16;
 static constexpr std::int32_t malloc_info_magic = 0x27138373;
 struct malloc_info {
@@ -239,7 +272,7 @@ static malloc_info *get_info(void *data_void) {
 }
 
 void *malloc(std::size_t size) {
-  return malloc_with_frame(size, get_backtrace());
+  return malloc_with_frame(size, get_allocation_backtrace(size));
 }
 
 void free(void *data_void) {
@@ -260,16 +293,16 @@ void free(void *data_void) {
 }
 void *calloc(std::size_t size_a, std::size_t size_b) {
   auto size = size_a * size_b;
-  void *res = malloc_with_frame(size, get_backtrace());
+  void *res = malloc_with_frame(size, get_allocation_backtrace(size));
   std::memset(res, 0, size);
   return res;
 }
 void *realloc(void *ptr, std::size_t size) {
   if (ptr == nullptr) {
-    return malloc_with_frame(size, get_backtrace());
+    return malloc_with_frame(size, get_allocation_backtrace(size));
   }
   auto *info = get_info(ptr);
-  auto *new_ptr = malloc_with_frame(size, get_backtrace());
+  auto *new_ptr = malloc_with_frame(size, get_allocation_backtrace(size));
   auto to_copy = std::min(static_cast<std::int32_t>(size), info->size);
   std::memcpy(new_ptr, ptr, to_copy);
   free(ptr);
@@ -283,7 +316,7 @@ void *memalign(std::size_t aligment, std::size_t size) {
 
 // c++14 guarantees that it is enough to override these two operators.
 void *operator new(std::size_t count) {
-  return malloc_with_frame(count, get_backtrace());
+  return malloc_with_frame(count, get_allocation_backtrace(count));
 }
 void operator delete(void *ptr) noexcept(true) {
   free(ptr);
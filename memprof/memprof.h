@@ -23,5 +23,11 @@ struct AllocInfo {
 bool is_memprof_on();
 std::size_t get_ht_size();
 double get_fast_backtrace_success_rate();
+
+// Calls func for every allocation site with live memory; safe to call at any
+// time from a running process. Two pseudo-sites are possible: a backtrace
+// beginning with the pointer 1 collects allocations made after the site table
+// overflowed, and one beginning with the pointer 2 collects allocations that
+// were not sampled in SAMPLING mode.
 void dump_alloc(const std::function<void(const AllocInfo &)> &func);
 std::size_t get_used_memory_size();
@@ -20261,6 +20261,10 @@ int sqlcipher_ltc_setup(sqlcipher_provider *p) {
 
 typedef struct {
   EVP_CIPHER *evp_cipher;
+  /* cipher and hmac contexts are cached here and reused for every page,
+     so page crypto pays no per-page context allocation and setup */
+  EVP_CIPHER_CTX *evp_cipher_ctx;
+  HMAC_CTX *hmac_ctx;
 } openssl_ctx;
 
 static unsigned int openssl_external_init = 0;
@@ -20402,14 +20406,19 @@ static int sqlcipher_openssl_random (void *ctx, void *buffer, int length) {
 
 static int sqlcipher_openssl_hmac(void *ctx, unsigned char *hmac_key, int key_sz, unsigned char *in, int in_sz, unsigned char *in2, int in2_sz, unsigned char *out) {
   unsigned int outlen;
-  HMAC_CTX* hctx = HMAC_CTX_new();
-  if(hctx == NULL) return SQLITE_ERROR;
+  openssl_ctx *o_ctx = (openssl_ctx *)ctx;
+  HMAC_CTX* hctx = o_ctx->hmac_ctx;
+  if(hctx == NULL) {
+    hctx = HMAC_CTX_new();
+    if(hctx == NULL) return SQLITE_ERROR;
+    o_ctx->hmac_ctx = hctx;
+  }
+  /* initializing with an explicit key also resets a context used for a previous page */
   HMAC_Init_ex(hctx, hmac_key, key_sz, EVP_sha1(), NULL);
   HMAC_Update(hctx, in, in_sz);
   HMAC_Update(hctx, in2, in2_sz);
   HMAC_Final(hctx, out, &outlen);
-  HMAC_CTX_free(hctx);
-  return SQLITE_OK; 
+  return SQLITE_OK;
 }
 
 static int sqlcipher_openssl_kdf(void *ctx, const unsigned char *pass, int pass_sz, unsigned char* salt, int salt_sz, int workfactor, int key_sz, unsigned char *key) {
@@ -20419,19 +20428,24 @@ static int sqlcipher_openssl_kdf(void *ctx, const unsigned char *pass, int pass_
 
 static int sqlcipher_openssl_cipher(void *ctx, int mode, unsigned char *key, int key_sz, unsigned char *iv, unsigned char *in, int in_sz, unsigned char *out) {
   int tmp_csz, csz;
-  EVP_CIPHER_CTX* ectx = EVP_CIPHER_CTX_new();
-  if(ectx == NULL) return SQLITE_ERROR;
-  EVP_CipherInit_ex(ectx, ((openssl_ctx *)ctx)->evp_cipher, NULL, NULL, NULL, mode);
+  openssl_ctx *o_ctx = (openssl_ctx *)ctx;
+  EVP_CIPHER_CTX* ectx = o_ctx->evp_cipher_ctx;
+  if(ectx == NULL) {
+    ectx = EVP_CIPHER_CTX_new();
+    if(ectx == NULL) return SQLITE_ERROR;
+    o_ctx->evp_cipher_ctx = ectx;
+  }
+  /* initializing with an explicit cipher also resets a context used for a previous page */
+  EVP_CipherInit_ex(ectx, o_ctx->evp_cipher, NULL, NULL, NULL, mode);
   EVP_CIPHER_CTX_set_padding(ectx, 0); // no padding
   EVP_CipherInit_ex(ectx, NULL, NULL, key, iv, mode);
   EVP_CipherUpdate(ectx, out, &tmp_csz, in, in_sz);
-  csz = tmp_csz;  
+  csz = tmp_csz;
   out += tmp_csz;
   EVP_CipherFinal_ex(ectx, out, &tmp_csz);
   csz += tmp_csz;
-  EVP_CIPHER_CTX_free(ectx);
   assert(in_sz == csz);
-  return SQLITE_OK; 
+  return SQLITE_OK;
 }
 
 static int sqlcipher_openssl_set_cipher(void *ctx, const char *cipher_name) {
@@ -20465,6 +20479,9 @@ static int sqlcipher_openssl_get_hmac_sz(void *ctx) {
 
 static int sqlcipher_openssl_ctx_copy(void *target_ctx, void *source_ctx) {
   memcpy(target_ctx, source_ctx, sizeof(openssl_ctx));
+  /* the cached crypto contexts are owned by the source; the copy recreates its own lazily */
+  ((openssl_ctx *)target_ctx)->evp_cipher_ctx = NULL;
+  ((openssl_ctx *)target_ctx)->hmac_ctx = NULL;
   return SQLITE_OK;
 }
 
@@ -20480,6 +20497,9 @@ static int sqlcipher_openssl_ctx_init(void **ctx) {
 }
 
 static int sqlcipher_openssl_ctx_free(void **ctx) {
+  openssl_ctx *o_ctx = (openssl_ctx *)*ctx;
+  if(o_ctx->evp_cipher_ctx != NULL) EVP_CIPHER_CTX_free(o_ctx->evp_cipher_ctx);
+  if(o_ctx->hmac_ctx != NULL) HMAC_CTX_free(o_ctx->hmac_ctx);
   sqlcipher_openssl_deactivate(*ctx);
   sqlcipher_free(*ctx, sizeof(openssl_ctx));
   return SQLITE_OK;
@@ -28,6 +28,14 @@ static void generate_cpp(const std::string &directory, const std::string &tl_nam
   td::tl::write_tl_to_file(config, path + ".hpp", WriterHpp(tl_name, string_type, bytes_type));
 }
 
+// The .tlo scheme blobs are consumed here, at build time, and nothing of them
+// survives into the shipped binary: constructor dispatch is compiled into
+// switch statements, and the only runtime scheme tables (the name-to-id maps of
+// the JSON interface) are function-local statics built on first use. So there
+// is no load-time scheme data left to compress or to initialize lazily; what a
+// scheme costs is its generated code, and each scheme below is emitted as its
+// own translation unit, so a client that never references secret_api does not
+// link it.
 int main() {
   generate_cpp<>("auto/td/telegram", "telegram_api", "std::string", "BufferSlice",
                  {"\"td/tl/tl_object_parse.h\"", "\"td/tl/tl_object_store.h\""}, {"\"td/utils/buffer.h\""});
@@ -622,6 +622,11 @@ std::string TD_TL_writer_cpp::gen_store_function_end(const std::vector<tl::var_d
          "}\n";
 }
 
+// Dispatch on constructor id stays a plain switch: compilers lower it to a jump
+// table when the ids cluster and to a short branch tree otherwise, and the cost is
+// dwarfed by the allocations done by the chosen fetch. A perfect-hash table would
+// also need the whole constructor list here, which the per-case writer interface
+// shared with the other language backends does not provide.
 std::string TD_TL_writer_cpp::gen_fetch_switch_begin() const {
   return "  int constructor = p.fetch_int();\n"
          "  switch (constructor) {\n";
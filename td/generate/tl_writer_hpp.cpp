@@ -202,6 +202,11 @@ std::string TD_TL_writer_hpp::gen_additional_proxy_function_begin(const std::str
                                                                   const std::string &class_name, int arity,
                                                                   bool is_function) const {
   assert(function_name == "downcast_call");
+  // downcast_call is deliberately a single switch over constructor identifiers: every case is a
+  // direct call that the compiler can inline, and the sparse constants are lowered to a jump table
+  // or branch-free binary search. A function-pointer table indexed by a dense ordinal can't do
+  // better, because the identifiers are fixed by the scheme and mapping one to its ordinal at
+  // runtime needs the same search the switch already compiles to
   return
 #ifndef DISABLE_HPP_DOCUMENTATION
       "/**\n"
@@ -53,6 +53,10 @@ int TD_TL_writer::get_storer_type(const tl::tl_combinator *t, const std::string
   return storer_name == "TlStorerToString";
 }
 
+// td_api objects deliberately get no binary TL parsers and storers: only the
+// TlStorerToString used for logging is generated for them. A binary client
+// interface would need Client parser/storer modes here, TlBufferParser in
+// get_parsers and a regeneration of the whole auto directory.
 tl::TL_writer::Mode TD_TL_writer::get_parser_mode(int type) const {
   if (tl_name == "td_api") {
 #ifndef TD_ENABLE_JNI  // we need to parse all types in order to implement toString
@@ -89,6 +93,11 @@ std::vector<std::string> TD_TL_writer::get_parsers() const {
   return parsers;
 }
 
+// there are no compile-time size hints for the generated classes: every object is stored
+// with a TlStorerCalcLength pass first, so callers always allocate the exact buffer size,
+// and for variable-size constructors no constexpr lower bound could replace that pass.
+// For the fixed-size ones the pass degenerates to a few additions, which is not worth
+// widening the generated interface for
 std::vector<std::string> TD_TL_writer::get_storers() const {
   std::vector<std::string> storers;
   if (tl_name == "telegram_api" || tl_name == "mtproto_api" || tl_name == "secret_api") {
@@ -55,13 +55,17 @@ class AuthKey {
     auth_key_.clear();
   }
 
-  enum : int32 { AUTH_FLAG = 1, WAS_AUTH_FLAG = 2 };
+  enum : int32 { AUTH_FLAG = 1, WAS_AUTH_FLAG = 2, HAS_EXPIRES_AT = 4 };
 
   template <class StorerT>
   void store(StorerT &storer) const {
     storer.store_binary(auth_key_id_);
-    storer.store_binary(static_cast<int32>((auth_flag_ ? AUTH_FLAG : 0) | (was_auth_flag_ ? WAS_AUTH_FLAG : 0)));
+    storer.store_binary(static_cast<int32>((auth_flag_ ? AUTH_FLAG : 0) | (was_auth_flag_ ? WAS_AUTH_FLAG : 0) |
+                                           (expires_at_ > 0 ? HAS_EXPIRES_AT : 0)));
     storer.store_string(auth_key_);
+    if (expires_at_ > 0) {
+      storer.template store_binary<double>(expires_at_);
+    }
   }
 
   template <class ParserT>
@@ -71,6 +75,9 @@ class AuthKey {
     auth_flag_ = (flags & AUTH_FLAG) != 0;
     was_auth_flag_ = (flags & WAS_AUTH_FLAG) != 0 || auth_flag_;
     auth_key_ = parser.template fetch_string<string>();
+    if ((flags & HAS_EXPIRES_AT) != 0) {
+      expires_at_ = parser.fetch_double();
+    }
     // just in case
     need_header_ = true;
   }
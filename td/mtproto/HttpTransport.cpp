@@ -14,6 +14,7 @@
 #include "td/utils/misc.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
+#include "td/utils/StringBuilder.h"
 
 // TODO: do I need \r\n as delimiter?
 
@@ -48,28 +49,39 @@ void Transport::write(BufferWriter &&message, bool quick_ack) {
    * Content-Length: [message->size()]
    * Host: url
    */
-  HttpHeaderCreator hc;
-  Slice host;
-  Slice proxy_authorizarion;
-  std::tie(host, proxy_authorizarion) = split(Slice(secret_), '|');
-  if (host.empty()) {
-    hc.init_post("/api");
-    hc.add_header("Host", "");
-    hc.set_keep_alive();
-  } else {
-    hc.init_post(PSLICE() << "HTTP://" << host << ":80/api");
-    hc.add_header("Host", host);
-    hc.add_header("User-Agent", "curl/7.35.0");
-    hc.add_header("Accept", "*/*");
-    hc.add_header("Proxy-Connection", "keep-alive");
-    if (!proxy_authorizarion.empty()) {
-      hc.add_header("Proxy-Authorization", proxy_authorizarion);
+  if (header_template_.empty()) {
+    // all headers except Content-Length are the same for every packet sent over
+    // the connection, so they are rendered only once
+    HttpHeaderCreator hc;
+    Slice host;
+    Slice proxy_authorizarion;
+    std::tie(host, proxy_authorizarion) = split(Slice(secret_), '|');
+    if (host.empty()) {
+      hc.init_post("/api");
+      hc.add_header("Host", "");
+      hc.set_keep_alive();
+    } else {
+      hc.init_post(PSLICE() << "HTTP://" << host << ":80/api");
+      hc.add_header("Host", host);
+      hc.add_header("User-Agent", "curl/7.35.0");
+      hc.add_header("Accept", "*/*");
+      hc.add_header("Proxy-Connection", "keep-alive");
+      if (!proxy_authorizarion.empty()) {
+        hc.add_header("Proxy-Authorization", proxy_authorizarion);
+      }
     }
+    auto r_head = hc.finish();
+    CHECK(r_head.is_ok());
+    auto head = r_head.ok();
+    CHECK(head.size() >= 2);
+    // drop the final empty line; Content-Length and the empty line are appended per packet
+    header_template_ = head.substr(0, head.size() - 2).str();
   }
-  hc.set_content_size(message.size());
-  auto r_head = hc.finish();
-  CHECK(r_head.is_ok());
-  Slice src = r_head.ok();
+  char head_buf[HttpHeaderCreator::MAX_HEADER];
+  StringBuilder sb(MutableSlice{head_buf, sizeof(head_buf)});
+  sb << header_template_ << "Content-Length: " << message.size() << "\r\n\r\n";
+  CHECK(!sb.is_error());
+  Slice src = sb.as_cslice();
   // LOG(DEBUG) << src;
   MutableSlice dst = message.prepare_prepend();
   dst.substr(dst.size() - src.size()).copy_from(src);
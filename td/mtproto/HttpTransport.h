@@ -30,6 +30,9 @@ class Transport : public IStreamTransport {
   bool support_quick_ack() const override {
     return false;
   }
+  bool support_solid_input() const override {
+    return false;
+  }
   void write(BufferWriter &&message, bool quick_ack) override;
   bool can_read() const override;
   bool can_write() const override;
@@ -47,6 +50,7 @@ class Transport : public IStreamTransport {
 
  private:
   string secret_;
+  string header_template_;  // pre-rendered request head without Content-Length
   HttpReader reader_;
   HttpQuery http_query_;
   ChainBufferWriter *output_;
@@ -24,6 +24,9 @@ class IStreamTransport {
   virtual ~IStreamTransport() = default;
   virtual Result<size_t> read_next(BufferSlice *message, uint32 *quick_ack) = 0;
   virtual bool support_quick_ack() const = 0;
+  // whether read_next reads frames directly from the input stream passed to init,
+  // so making that stream solid allows to extract whole frames without a copy
+  virtual bool support_solid_input() const = 0;
   virtual void write(BufferWriter &&message, bool quick_ack) = 0;
   virtual bool can_read() const = 0;
   virtual bool can_write() const = 0;
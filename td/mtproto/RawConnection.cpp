@@ -29,6 +29,9 @@ void RawConnection::send_crypto(const Storer &storer, int64 session_id, int64 sa
   info.session_id = session_id;
   info.use_random_padding = transport_->use_random_padding();
 
+  // The first write only computes the packet size (TL size and padded size are cached in the storer
+  // and in info), the second one serializes the query directly into the final buffer and encrypts it
+  // in place. The transport then prepends its header into the reserved space, so the packet is never copied.
   auto packet = BufferWriter{Transport::write(storer, auth_key, &info), transport_->max_prepend_size(),
                              transport_->max_append_size()};
   Transport::write(storer, auth_key, &info, packet.as_slice());
@@ -82,8 +85,15 @@ Status RawConnection::flush_read(const AuthKey &auth_key, Callback &callback) {
       if (wait_size > MAX_PACKET_SIZE) {
         return Status::Error(PSLICE() << "Expected packet size is too big: " << wait_size);
       }
+      if (wait_size > (1 << 12) && wait_size != solid_input_size_ && transport_->support_solid_input()) {
+        // decryption is done in place, so it is worth receiving a big packet into one buffer:
+        // read_next will then extract it from the stream without a copy
+        socket_fd_.make_input_solid(wait_size);
+        solid_input_size_ = wait_size;
+      }
       break;
     }
+    solid_input_size_ = 0;
 
     if (quick_ack != 0) {
       TRY_STATUS(on_quick_ack(quick_ack, callback));
@@ -114,6 +114,7 @@ class RawConnection {
   BufferedFd<SocketFd> socket_fd_;
   unique_ptr<IStreamTransport> transport_;
   std::map<uint32, uint64> quick_ack_to_token_;
+  size_t solid_input_size_{0};
   bool has_error_{false};
 
   unique_ptr<StatsCallback> stats_callback_;
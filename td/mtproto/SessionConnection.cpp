@@ -187,6 +187,9 @@ unique_ptr<RawConnection> SessionConnection::move_as_raw_connection() {
 }
 
 /*** SessionConnection ***/
+// transient parse products don't need their own storage: container items and rpc results are
+// returned as reference-counted views into the decrypted packet buffer, and gzdecode reuses a
+// thread-local inflate context, so parsing a packet allocates only the objects that outlive it
 BufferSlice SessionConnection::as_buffer_slice(Slice packet) {
   return current_buffer_slice_->from_slice(packet);
 }
@@ -342,6 +345,7 @@ Status SessionConnection::on_packet(const MsgInfo &info,
       LOG(ERROR) << bad_info << ": MessageId is too high. Session will be closed";
       // All this queries will be re-sent by parent
       to_send_.clear();
+      to_send_size_ = 0;
       callback_->on_session_failed(Status::Error("MessageId is too high"));
       return Status::Error("MessageId is too high");
     }
@@ -754,11 +758,16 @@ Result<uint64> SessionConnection::send_query(BufferSlice buffer, bool gzip_flag,
   }
   auto seq_no = auth_data_->next_seq_no(true);
   if (to_send_.empty()) {
-    send_before(Time::now_cached() + QUERY_DELAY);
+    send_before(Time::now_cached() + query_batching_delay());
   }
   to_send_.push_back(MtprotoQuery{message_id, seq_no, std::move(buffer), gzip_flag, invoke_after_id, use_quick_ack});
+  to_send_size_ += to_send_.back().packet.size();
   VLOG(mtproto) << "Invoke query " << message_id << " of size " << to_send_.back().packet.size() << " with seq_no "
                 << seq_no << " after " << invoke_after_id << (use_quick_ack ? " with quick ack" : "");
+  if (to_send_size_ >= (1 << 15)) {
+    // a full container is already pending, there is no reason to wait for more queries
+    send_before(Time::now_cached());
+  }
 
   return message_id;
 }
@@ -887,6 +896,7 @@ void SessionConnection::flush_packet() {
     std::move(to_send_.begin(), to_send_.begin() + send_till, std::back_inserter(queries));
     to_send_.erase(to_send_.begin(), to_send_.begin() + send_till);
   }
+  to_send_size_ -= send_size;
 
   bool destroy_auth_key = need_destroy_auth_key_ && !sent_destroy_auth_key_;
 
@@ -928,6 +938,9 @@ void SessionConnection::flush_packet() {
       std::any_of(queries.begin(), queries.end(), [](const auto &query) { return query.use_quick_ack; });
 
   {
+    // everything flushed here — acks, ping, http_wait, service queries and the query container —
+    // is serialized into one msg_container and encrypted as a single packet, so a flush costs one
+    // msg_key computation, one KDF and one AES pass however many messages it carries
     uint64 parent_message_id = 0;
     auto storer = PacketStorer<CryptoImpl>(
         queries, auth_data_->get_header(), std::move(to_ack), ping_id, ping_disconnect_delay() + 2, max_delay,
@@ -149,11 +149,21 @@ class SessionConnection
   int http_max_wait() const {
     return 25 * 1000;  // 25s. Longer could be closed by proxy
   }
+
+  double query_batching_delay() const {
+    // wait for more queries to share the container and its encryption, but never
+    // long enough to noticeably delay the answer on a fast connection
+    if (raw_connection_->rtt_ <= 0) {
+      return QUERY_DELAY;
+    }
+    return min(QUERY_DELAY, max(0.0001, raw_connection_->rtt_ * (1.0 / 32)));
+  }
   static constexpr int HTTP_MAX_AFTER = 10;              // 0.01s
   static constexpr int HTTP_MAX_DELAY = 30;              // 0.03s
   static constexpr int TEMP_KEY_TIMEOUT = 60 * 60 * 24;  // one day
 
   vector<MtprotoQuery> to_send_;
+  size_t to_send_size_ = 0;
   vector<int64> to_ack_;
   double force_send_at_ = 0;
 
@@ -37,8 +37,8 @@ size_t IntermediateTransport::read_from_stream(ChainBufferReader *stream, Buffer
 
   size_t total_size = data_size + header_size;
   if (stream_size < total_size) {
-    // optimization
-    // stream->make_solid(total_size);
+    // RawConnection uses the returned size to make the input buffer solid,
+    // so the complete frame can be cut below without a copy
     return total_size;
   }
 
@@ -100,8 +100,8 @@ size_t AbridgedTransport::read_from_stream(ChainBufferReader *stream, BufferSlic
 
   size_t total_size = header_size + data_size;
   if (stream->size() < total_size) {
-    // optimization
-    // stream->make_solid(total_size);
+    // RawConnection uses the returned size to make the input buffer solid,
+    // so the complete frame can be cut below without a copy
     return total_size;
   }
 
@@ -88,6 +88,9 @@ class OldTransport : public IStreamTransport {
   bool support_quick_ack() const override {
     return impl_.support_quick_ack();
   }
+  bool support_solid_input() const override {
+    return true;
+  }
   void write(BufferWriter &&message, bool quick_ack) override {
     impl_.write_prepare_inplace(&message, quick_ack);
     output_->append(message.as_buffer_slice());
@@ -138,6 +141,11 @@ class ObfuscatedTransport : public IStreamTransport {
     return impl_.support_quick_ack();
   }
 
+  bool support_solid_input() const override {
+    // frames are extracted from the output of the AES-CTR byte flow, not from the socket buffer
+    return false;
+  }
+
   void write(BufferWriter &&message, bool quick_ack) override;
 
   void init(ChainBufferReader *input, ChainBufferWriter *output) override;
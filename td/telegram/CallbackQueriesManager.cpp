@@ -24,6 +24,7 @@
 #include "td/utils/logging.h"
 #include "td/utils/Random.h"
 #include "td/utils/Status.h"
+#include "td/utils/Time.h"
 
 namespace td {
 
@@ -252,15 +253,49 @@ int64 CallbackQueriesManager::send_callback_query(FullMessageId full_message_id,
   } while (callback_query_answers_.find(result_id) != callback_query_answers_.end());
   callback_query_answers_[result_id];  // reserve place for result
 
+  auto cache_key = get_payload_cache_key(full_message_id, payload);
+  auto cached_it = answer_cache_.find(cache_key);
+  if (cached_it != answer_cache_.end()) {
+    if (Time::now() < cached_it->second.expires_at) {
+      LOG(INFO) << "Answer callback query " << result_id << " from cache";
+      callback_query_answers_[result_id] = cached_it->second.answer;
+      promise.set_value(Unit());
+      return result_id;
+    }
+    answer_cache_.erase(cached_it);
+  }
+  pending_answer_cache_keys_[result_id] = std::move(cache_key);
+
   td_->create_handler<GetBotCallbackAnswerQuery>(std::move(promise))
       ->send(dialog_id, full_message_id.get_message_id(), payload, result_id);
 
   return result_id;
 }
 
+string CallbackQueriesManager::get_payload_cache_key(FullMessageId full_message_id,
+                                                     const tl_object_ptr<td_api::CallbackQueryPayload> &payload) {
+  auto prefix = PSTRING() << full_message_id.get_dialog_id().get() << ' ' << full_message_id.get_message_id().get()
+                          << ' ' << payload->get_id() << ' ';
+  switch (payload->get_id()) {
+    case td_api::callbackQueryPayloadData::ID:
+      return prefix + static_cast<const td_api::callbackQueryPayloadData *>(payload.get())->data_;
+    case td_api::callbackQueryPayloadGame::ID:
+      return prefix + static_cast<const td_api::callbackQueryPayloadGame *>(payload.get())->game_short_name_;
+    default:
+      UNREACHABLE();
+      return prefix;
+  }
+}
+
 void CallbackQueriesManager::on_get_callback_query_answer(
     int64 result_id, tl_object_ptr<telegram_api::messages_botCallbackAnswer> &&answer) {
   LOG(INFO) << "Receive answer for callback query " << result_id;
+  string cache_key;
+  auto cache_key_it = pending_answer_cache_keys_.find(result_id);
+  if (cache_key_it != pending_answer_cache_keys_.end()) {
+    cache_key = std::move(cache_key_it->second);
+    pending_answer_cache_keys_.erase(cache_key_it);
+  }
   auto it = callback_query_answers_.find(result_id);
   CHECK(it != callback_query_answers_.end());
   CHECK(it->second.text.empty());
@@ -272,6 +307,10 @@ void CallbackQueriesManager::on_get_callback_query_answer(
   LOG(INFO) << to_string(answer);
   it->second = CallbackQueryAnswer{(answer->flags_ & BOT_CALLBACK_ANSWER_FLAG_NEED_SHOW_ALERT) != 0, answer->message_,
                                    answer->url_};
+  if (!cache_key.empty() && answer->cache_time_ > 0) {
+    answer_cache_[std::move(cache_key)] =
+        CachedCallbackQueryAnswer{it->second, Time::now() + answer->cache_time_};
+  }
 }
 
 tl_object_ptr<td_api::callbackQueryAnswer> CallbackQueriesManager::get_callback_query_answer_object(int64 result_id) {
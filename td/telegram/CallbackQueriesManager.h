@@ -56,10 +56,23 @@ class CallbackQueriesManager {
     string url;
   };
 
+  struct CachedCallbackQueryAnswer {
+    CallbackQueryAnswer answer;
+    double expires_at = 0;
+  };
+
   tl_object_ptr<td_api::CallbackQueryPayload> get_query_payload(int32 flags, BufferSlice &&data,
                                                                 string &&game_short_name);
 
+  static string get_payload_cache_key(FullMessageId full_message_id,
+                                      const tl_object_ptr<td_api::CallbackQueryPayload> &payload);
+
   std::unordered_map<int64, CallbackQueryAnswer> callback_query_answers_;
+  std::unordered_map<int64, string> pending_answer_cache_keys_;
+
+  // answers are cached for the server-provided cache_time, so pressing the same
+  // button again shortly doesn't cost a server round trip
+  std::unordered_map<string, CachedCallbackQueryAnswer> answer_cache_;
 
   Td *td_;
 };
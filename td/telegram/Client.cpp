@@ -64,6 +64,12 @@ class Client::Impl final {
     requests_.push_back(std::move(request));
   }
 
+  void send_batch(std::vector<Request> requests) {
+    for (auto &request : requests) {
+      requests_.push_back(std::move(request));
+    }
+  }
+
   Response receive(double timeout) {
     if (!requests_.empty()) {
       auto guard = concurrent_scheduler_->get_main_guard();
@@ -139,6 +145,13 @@ class MultiTd : public Actor {
     CHECK(!td.empty());
     send_closure(td, &Td::request, request.id, std::move(request.function));
   }
+  void send_batch(int32 td_id, std::vector<Client::Request> requests) {
+    auto &td = tds_[td_id];
+    CHECK(!td.empty());
+    for (auto &request : requests) {
+      send_closure(td, &Td::request, request.id, std::move(request.function));
+    }
+  }
   void destroy(int32 td_id) {
     auto size = tds_.erase(td_id);
     CHECK(size == 1);
@@ -148,6 +161,10 @@ class MultiTd : public Actor {
   std::unordered_map<int32, ActorOwn<Td> > tds_;
 };
 
+// Clients don't get own threads; they are multiplexed over a bounded number of
+// scheduler pools instead. Each MultiImpl owns one ConcurrentScheduler and a MultiTd
+// actor, which routes requests to the Td actors of the clients assigned to the pool,
+// so hundreds of clients cost one actor each and not a thread group each.
 class MultiImpl {
  public:
   static std::shared_ptr<MultiImpl> get() {
@@ -169,6 +186,9 @@ class MultiImpl {
 
   MultiImpl() {
     concurrent_scheduler_ = std::make_shared<ConcurrentScheduler>();
+    // dedicated pool for file loaders, so that heavy file transfers
+    // don't steal cycles from the Td and Session schedulers
+    concurrent_scheduler_->add_pool("io", static_cast<int32>(clamp(thread::hardware_concurrency() / 4, 1u, 4u)));
     concurrent_scheduler_->init(3);
     concurrent_scheduler_->start();
 
@@ -202,6 +222,13 @@ class MultiImpl {
     send_closure(multi_td_, &MultiTd::send, td_id, std::move(request));
   }
 
+  void send_batch(int32 td_id, std::vector<Client::Request> requests) {
+    // the whole batch is delivered to MultiTd as a single scheduler event,
+    // so dozens of ready requests cost one queue round trip and one wakeup
+    auto guard = concurrent_scheduler_->get_send_guard();
+    send_closure(multi_td_, &MultiTd::send_batch, td_id, std::move(requests));
+  }
+
   void destroy(int32 td_id) {
     auto guard = concurrent_scheduler_->get_send_guard();
     send_closure(multi_td_, &MultiTd::destroy, td_id);
@@ -266,6 +293,21 @@ class Client::Impl final {
     multi_impl_->send(td_id_, std::move(request));
   }
 
+  void send_batch(std::vector<Client::Request> requests) {
+    for (auto &request : requests) {
+      if (request.id == 0 || request.function == nullptr) {
+        LOG(ERROR) << "Drop wrong request " << request.id;
+        request.function = nullptr;
+      }
+    }
+    td::remove_if(requests, [](const auto &request) { return request.function == nullptr; });
+    if (requests.empty()) {
+      return;
+    }
+
+    multi_impl_->send_batch(td_id_, std::move(requests));
+  }
+
   Client::Response receive(double timeout) {
     VLOG(td_requests) << "Begin to wait for updates with timeout " << timeout;
     auto is_locked = receive_lock_.exchange(true);
@@ -327,6 +369,10 @@ void Client::send(Request &&request) {
   impl_->send(std::move(request));
 }
 
+void Client::send_batch(std::vector<Request> &&requests) {
+  impl_->send_batch(std::move(requests));
+}
+
 Client::Response Client::receive(double timeout) {
   return impl_->receive(timeout);
 }
@@ -13,6 +13,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace td {
 
@@ -79,6 +80,13 @@ class Client final {
    */
   void send(Request &&request);
 
+  /**
+   * Sends several requests to TDLib as one batch, which is cheaper than sending them one by one.
+   * Responses are received through Client::receive as usual, one per request. May be called from any thread.
+   * \param[in] requests Requests to TDLib.
+   */
+  void send_batch(std::vector<Request> &&requests);
+
   /**
    * A response to a request, or an incoming update from TDLib.
    */
@@ -15,6 +15,8 @@
 #include "td/utils/JsonBuilder.h"
 #include "td/utils/logging.h"
 #include "td/utils/port/thread_local.h"
+#include "td/utils/StackAllocator.h"
+#include "td/utils/StringBuilder.h"
 
 #include <utility>
 
@@ -25,8 +27,19 @@ static td_api::object_ptr<td_api::Function> get_return_error_function(Slice erro
   return td_api::make_object<td_api::testReturnError>(std::move(error));
 }
 
+static TD_THREAD_LOCAL string *current_request;
+
+static MutableSlice copy_request(Slice request) {
+  // json_decode parses in-situ: strings are unescaped inside the buffer and handed out
+  // as slices, so it is enough to copy the request into a reusable thread-local buffer
+  // instead of allocating a fresh string for every request
+  init_thread_local<string>(current_request);
+  current_request->assign(request.begin(), request.size());
+  return *current_request;
+}
+
 static std::pair<td_api::object_ptr<td_api::Function>, string> to_request(Slice request) {
-  auto request_str = request.str();
+  auto request_str = copy_request(request);
   auto r_json_value = json_decode(request_str);
   if (r_json_value.is_error()) {
     return {get_return_error_function(PSLICE()
@@ -54,12 +67,26 @@ static std::pair<td_api::object_ptr<td_api::Function>, string> to_request(Slice
   return std::make_pair(std::move(func), std::move(extra));
 }
 
-static std::string from_response(const td_api::Object &object, const string &extra) {
-  auto str = json_encode<string>(ToJson(object));
-  CHECK(!str.empty() && str.back() == '}');
-  if (!extra.empty()) {
-    str.pop_back();
-    str.reserve(str.size() + 11 + extra.size());
+static TD_THREAD_LOCAL string *current_output;
+
+static CSlice from_response(const td_api::Object &object, const string &extra) {
+  auto buf = StackAllocator::alloc(1 << 18);
+  JsonBuilder jb(StringBuilder(buf.as_slice(), true));
+  jb.enter_value() << ToJson(object);
+  LOG_IF(ERROR, jb.string_builder().is_error()) << "JSON buffer overflow";
+  auto slice = jb.string_builder().as_cslice();
+  CHECK(!slice.empty() && slice.back() == '}');
+
+  // the response is assembled in place in a reusable thread-local buffer, so a multi-MB
+  // response neither allocates a fresh string nor gets copied once more to append @extra
+  init_thread_local<string>(current_output);
+  auto &str = *current_output;
+  if (extra.empty()) {
+    str.assign(slice.begin(), slice.size());
+  } else {
+    str.clear();
+    str.reserve(slice.size() + 10 + extra.size());
+    str.append(slice.begin(), slice.size() - 1);
     str += ",\"@extra\":";
     str += extra;
     str += '}';
@@ -67,14 +94,6 @@ static std::string from_response(const td_api::Object &object, const string &ext
   return str;
 }
 
-static TD_THREAD_LOCAL std::string *current_output;
-
-static CSlice store_string(std::string str) {
-  init_thread_local<std::string>(current_output);
-  *current_output = std::move(str);
-  return *current_output;
-}
-
 void ClientJson::send(Slice request) {
   auto parsed_request = to_request(request);
   std::uint64_t extra_id = extra_id_.fetch_add(1, std::memory_order_relaxed);
@@ -100,13 +119,13 @@ CSlice ClientJson::receive(double timeout) {
       extra_.erase(it);
     }
   }
-  return store_string(from_response(*response.object, extra));
+  return from_response(*response.object, extra);
 }
 
 CSlice ClientJson::execute(Slice request) {
   auto parsed_request = to_request(request);
-  return store_string(from_response(*Client::execute(Client::Request{0, std::move(parsed_request.first)}).object,
-                                    parsed_request.second));
+  return from_response(*Client::execute(Client::Request{0, std::move(parsed_request.first)}).object,
+                       parsed_request.second);
 }
 
 }  // namespace td
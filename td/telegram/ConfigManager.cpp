@@ -801,6 +801,8 @@ void ConfigManager::start_up() {
   // }
   auto expire_time = load_config_expire_time();
   if (expire_time.is_in_past()) {
+    // the client keeps using options persisted in ConfigShared and DC options saved
+    // by ConnectionCreator while the refresh is in flight
     request_config();
   } else {
     expire_time_ = expire_time;
@@ -898,8 +900,7 @@ Timestamp ConfigManager::load_config_expire_time() {
 }
 
 void ConfigManager::save_config_expire(Timestamp timestamp) {
-  G()->td_db()->get_binlog_pmc()->set("config_expire",
-                                      to_string(static_cast<int>(Clocks::system() + expire_time_.in())));
+  G()->td_db()->get_binlog_pmc()->set("config_expire", to_string(static_cast<int>(Clocks::system() + timestamp.in())));
 }
 
 void ConfigManager::process_config(tl_object_ptr<telegram_api::config> config) {
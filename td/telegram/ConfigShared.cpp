@@ -11,9 +11,12 @@
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
 
+#include <utility>
+
 namespace td {
 
 ConfigShared::ConfigShared(std::shared_ptr<KeyValueSyncInterface> config_pmc) : config_pmc_(std::move(config_pmc)) {
+  options_ = std::make_shared<const std::unordered_map<string, string>>(config_pmc_->get_all());
 }
 
 void ConfigShared::set_callback(unique_ptr<Callback> callback) {
@@ -52,19 +55,32 @@ void ConfigShared::set_option_string(Slice name, Slice value) {
 }
 
 bool ConfigShared::have_option(Slice name) const {
-  return config_pmc_->isset(name.str());
+  auto options = get_options_snapshot();
+  return options->count(name.str()) > 0;
 }
 
 string ConfigShared::get_option(Slice name) const {
-  return config_pmc_->get(name.str());
+  auto options = get_options_snapshot();
+  auto it = options->find(name.str());
+  if (it == options->end()) {
+    return string();
+  }
+  return it->second;
 }
 
 std::unordered_map<string, string> ConfigShared::get_options(Slice prefix) const {
-  return config_pmc_->prefix_get(prefix);
+  auto options = get_options_snapshot();
+  std::unordered_map<string, string> res;
+  for (auto &option : *options) {
+    if (begins_with(option.first, prefix)) {
+      res.emplace(option.first, option.second);
+    }
+  }
+  return res;
 }
 
 std::unordered_map<string, string> ConfigShared::get_options() const {
-  return config_pmc_->get_all();
+  return *get_options_snapshot();
 }
 
 bool ConfigShared::get_option_boolean(Slice name, bool default_value) const {
@@ -110,12 +126,43 @@ tl_object_ptr<td_api::OptionValue> ConfigShared::get_option_value(Slice name) co
   return get_option_value_object(get_option(name));
 }
 
+std::shared_ptr<const std::unordered_map<string, string>> ConfigShared::get_options_snapshot() const {
+#if !TD_HAVE_ATOMIC_SHARED_PTR
+  std::lock_guard<std::mutex> guard(options_mutex_);
+  auto res = options_;
+  return res;
+#else
+  return atomic_load(&options_);
+#endif
+}
+
+void ConfigShared::set_options_snapshot(std::shared_ptr<const std::unordered_map<string, string>> options) {
+#if !TD_HAVE_ATOMIC_SHARED_PTR
+  std::lock_guard<std::mutex> guard(options_mutex_);
+  options_ = std::move(options);
+#else
+  atomic_store(&options_, std::move(options));
+#endif
+}
+
 bool ConfigShared::set_option(Slice name, Slice value) {
+  std::lock_guard<std::mutex> guard(set_option_mutex_);
+  bool have_changed;
   if (value.empty()) {
-    return config_pmc_->erase(name.str()) != 0;
+    have_changed = config_pmc_->erase(name.str()) != 0;
   } else {
-    return config_pmc_->set(name.str(), value.str()) != 0;
-  }
+    have_changed = config_pmc_->set(name.str(), value.str()) != 0;
+  }
+  if (have_changed) {
+    auto new_options = std::make_shared<std::unordered_map<string, string>>(*get_options_snapshot());
+    if (value.empty()) {
+      new_options->erase(name.str());
+    } else {
+      (*new_options)[name.str()] = value.str();
+    }
+    set_options_snapshot(std::move(new_options));
+  }
+  return have_changed;
 }
 
 tl_object_ptr<td_api::OptionValue> ConfigShared::get_option_value_object(Slice value) {
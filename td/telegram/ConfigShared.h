@@ -14,6 +14,7 @@
 #include "td/utils/Slice.h"
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 namespace td {
@@ -57,6 +58,18 @@ class ConfigShared {
   std::shared_ptr<KeyValueSyncInterface> config_pmc_;
   unique_ptr<Callback> callback_;
 
+  // an immutable snapshot of all options; readers load the pointer atomically and writers
+  // replace the whole map, so option reads from other threads don't take the pmc lock
+  std::shared_ptr<const std::unordered_map<string, string>> options_;
+#if !TD_HAVE_ATOMIC_SHARED_PTR
+  mutable std::mutex options_mutex_;
+#endif
+  std::mutex set_option_mutex_;
+
+  std::shared_ptr<const std::unordered_map<string, string>> get_options_snapshot() const;
+
+  void set_options_snapshot(std::shared_ptr<const std::unordered_map<string, string>> options);
+
   bool set_option(Slice name, Slice value);
 
   void on_option_updated(Slice name) const;
@@ -18,6 +18,7 @@
 #include "td/telegram/Global.h"
 #include "td/telegram/InlineQueriesManager.h"
 #include "td/telegram/logevent/LogEvent.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/MessagesManager.h"
 #include "td/telegram/misc.h"
 #include "td/telegram/net/NetQuery.h"
@@ -2369,7 +2370,7 @@ void ContactsManager::on_user_online_timeout(UserId user_id) {
   send_closure(G()->td(), &Td::send_update,
                td_api::make_object<td_api::updateUserStatus>(user_id.get(), get_user_status_object(user_id, u)));
 
-  update_user_online_member_count(u);
+  update_user_online_member_count(user_id);
 }
 
 void ContactsManager::on_channel_unban_timeout_callback(void *contacts_manager_ptr, int64 channel_id_long) {
@@ -6265,7 +6266,7 @@ void ContactsManager::update_user(User *u, UserId user_id, bool from_binlog, boo
       }
     }
 
-    add_user_photo_id(u, user_id, u->photo.id, dialog_photo_get_file_ids(u->photo));
+    add_user_photo_id(user_id, u->photo.id, dialog_photo_get_file_ids(u->photo));
 
     UserFull *user_full = get_user_full(user_id);
     if (user_full != nullptr) {
@@ -6332,7 +6333,7 @@ void ContactsManager::update_user(User *u, UserId user_id, bool from_binlog, boo
     u->is_status_changed = false;
   }
   if (u->is_online_status_changed) {
-    update_user_online_member_count(u);
+    update_user_online_member_count(user_id);
     u->is_online_status_changed = false;
   }
 
@@ -6671,7 +6672,7 @@ void ContactsManager::on_get_user_photos(UserId user_id, int32 offset, int32 lim
         }
 
         auto photo = get_photo(td_->file_manager_.get(), std::move(server_photo), DialogId());
-        add_user_photo_id(u, user_id, photo.id, photo_get_file_ids(photo));
+        add_user_photo_id(user_id, photo.id, photo_get_file_ids(photo));
       }
     }
     return;
@@ -6704,7 +6705,7 @@ void ContactsManager::on_get_user_photos(UserId user_id, int32 offset, int32 lim
     }
 
     user->photos.push_back(std::move(user_photo));
-    add_user_photo_id(u, user_id, user->photos.back().id, photo_get_file_ids(user->photos.back()));
+    add_user_photo_id(user_id, user->photos.back().id, photo_get_file_ids(user->photos.back()));
   }
 }
 
@@ -7067,8 +7068,8 @@ void ContactsManager::do_update_user_photo(User *u, UserId user_id,
   }
 }
 
-void ContactsManager::add_user_photo_id(User *u, UserId user_id, int64 photo_id, const vector<FileId> &photo_file_ids) {
-  if (photo_id > 0 && !photo_file_ids.empty() && u->photo_ids.insert(photo_id).second) {
+void ContactsManager::add_user_photo_id(UserId user_id, int64 photo_id, const vector<FileId> &photo_file_ids) {
+  if (photo_id > 0 && !photo_file_ids.empty() && user_photo_ids_[user_id].insert(photo_id).second) {
     FileSourceId file_source_id;
     auto it = user_profile_photo_file_source_ids_.find(std::make_pair(user_id, photo_id));
     if (it != user_profile_photo_file_source_ids_.end()) {
@@ -7375,14 +7376,15 @@ void ContactsManager::invalidate_user_full(UserId user_id) {
   update_user_full(user_full, user_id);
 }
 
-void ContactsManager::update_user_online_member_count(User *u) {
-  if (u->online_member_dialogs.empty()) {
+void ContactsManager::update_user_online_member_count(UserId user_id) {
+  auto online_member_dialogs_it = user_online_member_dialogs_.find(user_id);
+  if (online_member_dialogs_it == user_online_member_dialogs_.end()) {
     return;
   }
 
   auto now = G()->unix_time_cached();
   vector<DialogId> expired_dialog_ids;
-  for (auto &it : u->online_member_dialogs) {
+  for (auto &it : online_member_dialogs_it->second) {
     auto dialog_id = it.first;
     auto time = it.second;
     if (time < now - MessagesManager::ONLINE_MEMBER_COUNT_CACHE_EXPIRE_TIME) {
@@ -7411,11 +7413,14 @@ void ContactsManager::update_user_online_member_count(User *u) {
     }
   }
   for (auto &dialog_id : expired_dialog_ids) {
-    u->online_member_dialogs.erase(dialog_id);
+    online_member_dialogs_it->second.erase(dialog_id);
     if (dialog_id.get_type() == DialogType::Channel) {
       cached_channel_participants_.erase(dialog_id.get_channel_id());
     }
   }
+  if (online_member_dialogs_it->second.empty()) {
+    user_online_member_dialogs_.erase(online_member_dialogs_it);
+  }
 }
 
 void ContactsManager::update_chat_online_member_count(const ChatFull *chat_full, ChatId chat_id, bool is_from_server) {
@@ -7449,7 +7454,7 @@ void ContactsManager::update_dialog_online_member_count(const vector<DialogParti
         online_member_count++;
       }
       if (is_from_server) {
-        u->online_member_dialogs[dialog_id] = time;
+        user_online_member_dialogs_[participant.user_id][dialog_id] = time;
       }
     }
   }
@@ -9010,10 +9015,56 @@ void ContactsManager::reload_user(UserId user_id, Promise<Unit> &&promise) {
     return promise.set_error(Status::Error(6, "User info not found"));
   }
 
-  // there is no much reason to combine different requests into one request
-  vector<tl_object_ptr<telegram_api::InputUser>> users;
-  users.push_back(std::move(input_user));
-  td_->create_handler<GetUsersQuery>(std::move(promise))->send(std::move(users));
+  // combine reload requests of different users arriving before the flush into one getUsers request
+  auto &promises = pending_reload_user_queries_[user_id];
+  promises.push_back(std::move(promise));
+  if (pending_reload_user_queries_.size() == 1 && promises.size() == 1) {
+    send_closure_later(actor_id(this), &ContactsManager::flush_pending_reload_users);
+  }
+}
+
+void ContactsManager::flush_pending_reload_users() {
+  if (G()->close_flag()) {
+    for (auto &it : pending_reload_user_queries_) {
+      for (auto &promise : it.second) {
+        promise.set_error(Status::Error(500, "Request aborted"));
+      }
+    }
+    pending_reload_user_queries_.clear();
+    return;
+  }
+
+  while (!pending_reload_user_queries_.empty()) {
+    vector<tl_object_ptr<telegram_api::InputUser>> input_users;
+    vector<Promise<Unit>> promises;
+    auto it = pending_reload_user_queries_.begin();
+    while (it != pending_reload_user_queries_.end() && input_users.size() < MAX_GET_USERS) {
+      auto input_user = get_input_user(it->first);
+      if (input_user == nullptr) {
+        for (auto &promise : it->second) {
+          promise.set_error(Status::Error(6, "User info not found"));
+        }
+      } else {
+        input_users.push_back(std::move(input_user));
+        append(promises, std::move(it->second));
+      }
+      it = pending_reload_user_queries_.erase(it);
+    }
+    if (input_users.empty()) {
+      continue;
+    }
+
+    auto promise = PromiseCreator::lambda([promises = std::move(promises)](Result<Unit> result) mutable {
+      for (auto &promise : promises) {
+        if (result.is_ok()) {
+          promise.set_value(Unit());
+        } else {
+          promise.set_error(result.error().clone());
+        }
+      }
+    });
+    td_->create_handler<GetUsersQuery>(std::move(promise))->send(std::move(input_users));
+  }
 }
 
 bool ContactsManager::get_user_full(UserId user_id, Promise<Unit> &&promise) {
@@ -9144,8 +9195,8 @@ void ContactsManager::reload_user_profile_photo(UserId user_id, int64 photo_id,
 }
 
 FileSourceId ContactsManager::get_user_profile_photo_file_source_id(UserId user_id, int64 photo_id) {
-  auto u = get_user(user_id);
-  if (u != nullptr && u->photo_ids.count(photo_id) != 0) {
+  auto it = user_photo_ids_.find(user_id);
+  if (it != user_photo_ids_.end() && it->second.count(photo_id) != 0) {
     VLOG(file_references) << "Don't need to create file source for photo " << photo_id << " of " << user_id;
     // photo was already added, source id was registered and shouldn't be needed
     return FileSourceId();
@@ -10804,6 +10855,16 @@ void ContactsManager::after_get_difference() {
   get_user(get_my_id(), 3, Promise<Unit>());
 }
 
+void ContactsManager::get_memory_stats(MemoryStats &stats) const {
+  stats.add("ContactsManager", "users_", users_);
+  stats.add("ContactsManager", "users_full_", users_full_);
+  stats.add("ContactsManager", "chats_", chats_);
+  stats.add("ContactsManager", "chats_full_", chats_full_);
+  stats.add("ContactsManager", "channels_", channels_);
+  stats.add("ContactsManager", "channels_full_", channels_full_);
+  stats.add("ContactsManager", "secret_chats_", secret_chats_);
+}
+
 void ContactsManager::get_current_state(vector<td_api::object_ptr<td_api::Update>> &updates) const {
   for (auto &it : users_) {
     updates.push_back(td_api::make_object<td_api::updateUser>(get_user_object(it.first, &it.second)));
@@ -44,6 +44,8 @@ namespace td {
 
 struct BinlogEvent;
 
+class MemoryStats;
+
 class Td;
 
 struct BotData {
@@ -466,6 +468,8 @@ class ContactsManager : public Actor {
 
   void get_current_state(vector<td_api::object_ptr<td_api::Update>> &updates) const;
 
+  void get_memory_stats(MemoryStats &stats) const;
+
  private:
   enum class LinkState : uint8 { Unknown, None, KnowsPhoneNumber, Contact };
 
@@ -492,10 +496,6 @@ class ContactsManager : public Actor {
     LinkState outbound = LinkState::Unknown;
     LinkState inbound = LinkState::Unknown;
 
-    std::unordered_set<int64> photo_ids;
-
-    std::unordered_map<DialogId, int32, DialogIdHash> online_member_dialogs;  // id -> time
-
     static constexpr uint32 CACHE_VERSION = 1;
     uint32 cache_version = 0;
 
@@ -745,6 +745,7 @@ class ContactsManager : public Actor {
   static constexpr size_t MAX_DESCRIPTION_LENGTH = 255;       // server side limit for chat/channel description
   static constexpr size_t MAX_BIO_LENGTH = 70;                // server side limit
   static constexpr int32 MAX_GET_CHANNEL_PARTICIPANTS = 200;  // server side limit
+  static constexpr size_t MAX_GET_USERS = 100;                // server side limit
 
   static constexpr int32 USER_FLAG_HAS_ACCESS_HASH = 1 << 0;
   static constexpr int32 USER_FLAG_HAS_FIRST_NAME = 1 << 1;
@@ -851,6 +852,8 @@ class ContactsManager : public Actor {
   void send_get_user_full_query(UserId user_id, tl_object_ptr<telegram_api::InputUser> &&input_user,
                                 Promise<Unit> &&promise);
 
+  void flush_pending_reload_users();
+
   const Chat *get_chat(ChatId chat_id) const;
   Chat *get_chat(ChatId chat_id);
   Chat *get_chat_force(ChatId chat_id);
@@ -907,7 +910,7 @@ class ContactsManager : public Actor {
   void do_update_user_photo(User *u, UserId user_id, tl_object_ptr<telegram_api::UserProfilePhoto> &&photo,
                             const char *source);
 
-  void add_user_photo_id(User *u, UserId user_id, int64 photo_id, const vector<FileId> &photo_file_ids);
+  void add_user_photo_id(UserId user_id, int64 photo_id, const vector<FileId> &photo_file_ids);
 
   void on_update_user_full_is_blocked(UserFull *user_full, UserId user_id, bool is_blocked);
   void on_update_user_full_common_chat_count(UserFull *user_full, UserId user_id, int32 common_chat_count);
@@ -949,7 +952,7 @@ class ContactsManager : public Actor {
 
   void invalidate_chat_full(ChatId chat_id);
 
-  void update_user_online_member_count(User *u);
+  void update_user_online_member_count(UserId user_id);
   void update_chat_online_member_count(const ChatFull *chat_full, ChatId chat_id, bool is_from_server);
   void update_channel_online_member_count(ChannelId channel_id, bool is_from_server);
   void update_dialog_online_member_count(const vector<DialogParticipant> &participants, DialogId dialog_id,
@@ -1128,6 +1131,14 @@ class ContactsManager : public Actor {
   };
   std::unordered_map<std::pair<UserId, int64>, FileSourceId, UserIdPhotoIdHash> user_profile_photo_file_source_ids_;
 
+  // stored outside of User, because the containers are empty for the vast majority
+  // of known users, while their footprint would be paid in every User
+  std::unordered_map<UserId, std::unordered_set<int64>, UserIdHash> user_photo_ids_;
+  std::unordered_map<UserId, std::unordered_map<DialogId, int32, DialogIdHash>, UserIdHash>
+      user_online_member_dialogs_;  // user -> dialog -> time
+
+  std::unordered_map<UserId, vector<Promise<Unit>>, UserIdHash> pending_reload_user_queries_;
+
   std::unordered_map<ChatId, Chat, ChatIdHash> chats_;
   std::unordered_map<ChatId, ChatFull, ChatIdHash> chats_full_;
   mutable std::unordered_set<ChatId, ChatIdHash> unknown_chats_;
@@ -327,14 +327,25 @@ void DeviceTokenManager::start_up() {
 
 void DeviceTokenManager::save_info(int32 token_type) {
   LOG(INFO) << "SET device token " << token_type << "--->" << tokens_[token_type];
-  if (tokens_[token_type].token.empty()) {
-    G()->td_db()->get_binlog_pmc()->erase(get_database_key(token_type));
+  auto key = get_database_key(token_type);
+  string value;
+  if (!tokens_[token_type].token.empty()) {
+    value = "*" + serialize(tokens_[token_type]);
+  }
+  if (value == G()->td_db()->get_binlog_pmc()->get(key)) {
+    // the stored blob is unchanged; skip the binlog write and its sync, but run loop
+    // to send queries for the updated state
+    return loop();
+  }
+  if (value.empty()) {
+    G()->td_db()->get_binlog_pmc()->erase(key);
   } else {
-    G()->td_db()->get_binlog_pmc()->set(get_database_key(token_type), "*" + serialize(tokens_[token_type]));
+    G()->td_db()->get_binlog_pmc()->set(key, std::move(value));
   }
-  sync_cnt_++;
-  G()->td_db()->get_binlog_pmc()->force_sync(
-      PromiseCreator::event(self_closure(this, &DeviceTokenManager::dec_sync_cnt)));
+  // the sync is done from loop, so several token updates arriving in one event
+  // are flushed with a single binlog sync
+  need_sync_ = true;
+  yield();
 }
 
 void DeviceTokenManager::dec_sync_cnt() {
@@ -343,6 +354,12 @@ void DeviceTokenManager::dec_sync_cnt() {
 }
 
 void DeviceTokenManager::loop() {
+  if (need_sync_) {
+    need_sync_ = false;
+    sync_cnt_++;
+    G()->td_db()->get_binlog_pmc()->force_sync(
+        PromiseCreator::event(self_closure(this, &DeviceTokenManager::dec_sync_cnt)));
+  }
   if (sync_cnt_ != 0) {
     return;
   }
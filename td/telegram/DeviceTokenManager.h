@@ -71,6 +71,7 @@ class DeviceTokenManager : public NetQueryCallback {
 
   std::array<TokenInfo, TokenType::SIZE> tokens_;
   int32 sync_cnt_{0};
+  bool need_sync_{false};
 
   void start_up() override;
 
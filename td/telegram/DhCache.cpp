@@ -9,25 +9,48 @@
 #include "td/telegram/Global.h"
 #include "td/telegram/TdDb.h"
 
+#include "td/utils/base64.h"
 #include "td/utils/common.h"
+#include "td/utils/crypto.h"
 
 namespace td {
 
 static string good_prime_key(Slice prime_str) {
+  // the verdict is keyed by the hash of the prime: the full 2048-bit prime as
+  // part of a binlog_pmc key wastes space in every binlog snapshot
+  string prime_hash(32, '\0');
+  sha256(prime_str, prime_hash);
+  return PSTRING() << "good_prime:" << base64url_encode(prime_hash);
+}
+
+static string legacy_good_prime_key(Slice prime_str) {
   string key("good_prime:");
   key.append(prime_str.data(), prime_str.size());
   return key;
 }
 
 int DhCache::is_good_prime(Slice prime_str) const {
-  string value = G()->td_db()->get_binlog_pmc()->get(good_prime_key(prime_str));
+  auto *pmc = G()->td_db()->get_binlog_pmc();
+  string value = pmc->get(good_prime_key(prime_str));
   if (value == "good") {
     return 1;
   }
   if (value == "bad") {
     return 0;
   }
-  CHECK(value == "");
+  CHECK(value.empty());
+
+  // move entries stored by older versions under the full prime to the hash key
+  string legacy_value = pmc->get(legacy_good_prime_key(prime_str));
+  if (!legacy_value.empty()) {
+    pmc->set(good_prime_key(prime_str), legacy_value);
+    pmc->erase(legacy_good_prime_key(prime_str));
+    return legacy_value == "good" ? 1 : 0;
+  }
+
+  // a miss means a primality check on the caller's thread, but it happens at
+  // most once per prime per database lifetime: the verdict is persisted, and
+  // in practice all handshakes use the one well-known server prime
   return -1;
 }
 
@@ -95,9 +95,20 @@ class DialogDbImpl : public DialogDbSyncInterface {
     TRY_RESULT(delete_notification_group_stmt,
                db_.get_statement("DELETE FROM notification_groups WHERE notification_group_id = ?1"));
     TRY_RESULT(get_dialog_stmt, db_.get_statement("SELECT data FROM dialogs WHERE dialog_id = ?1"));
-    TRY_RESULT(get_dialogs_stmt, db_.get_statement("SELECT data, dialog_id, dialog_order FROM dialogs WHERE "
-                                                   "dialog_order < ?1 OR (dialog_order = ?1 AND dialog_id < ?2) ORDER "
-                                                   "BY dialog_order DESC, dialog_id DESC LIMIT ?3"));
+    // fetch the last message of each chat in the same statement to avoid a round trip
+    // to the message database per chat while the chat list is loaded
+    TRY_RESULT(has_messages_table, db_.has_table("messages"));
+    auto last_message_expr =
+        has_messages_table
+            ? CSlice("(SELECT data FROM messages WHERE messages.dialog_id = dialogs.dialog_id ORDER BY message_id "
+                     "DESC LIMIT 1)")
+            : CSlice("NULL");
+    TRY_RESULT(get_dialogs_stmt, db_.get_statement(PSLICE() << "SELECT data, dialog_id, dialog_order, "
+                                                            << last_message_expr
+                                                            << " FROM dialogs WHERE "
+                                                               "dialog_order < ?1 OR (dialog_order = ?1 AND dialog_id "
+                                                               "< ?2) ORDER BY dialog_order DESC, dialog_id DESC "
+                                                               "LIMIT ?3"));
     TRY_RESULT(
         get_notification_groups_by_last_notification_date_stmt,
         db_.get_statement("SELECT notification_group_id, dialog_id, last_notification_date FROM notification_groups "
@@ -190,7 +201,7 @@ class DialogDbImpl : public DialogDbSyncInterface {
                                 get_last_notification_date(get_notification_group_stmt_, 1));
   }
 
-  Result<vector<BufferSlice>> get_dialogs(int64 order, DialogId dialog_id, int32 limit) override {
+  Result<vector<DialogDbDialog>> get_dialogs(int64 order, DialogId dialog_id, int32 limit) override {
     SCOPE_EXIT {
       get_dialogs_stmt_.reset();
     };
@@ -199,14 +210,18 @@ class DialogDbImpl : public DialogDbSyncInterface {
     get_dialogs_stmt_.bind_int64(2, dialog_id.get()).ensure();
     get_dialogs_stmt_.bind_int32(3, limit).ensure();
 
-    vector<BufferSlice> dialogs;
+    vector<DialogDbDialog> dialogs;
     TRY_STATUS(get_dialogs_stmt_.step());
     while (get_dialogs_stmt_.has_row()) {
-      BufferSlice data(get_dialogs_stmt_.view_blob(0));
+      DialogDbDialog dialog;
+      dialog.data = BufferSlice(get_dialogs_stmt_.view_blob(0));
       auto loaded_dialog_id = get_dialogs_stmt_.view_int64(1);
       auto loaded_dialog_order = get_dialogs_stmt_.view_int64(2);
+      if (get_dialogs_stmt_.view_datatype(3) != SqliteStatement::Datatype::Null) {
+        dialog.last_message = BufferSlice(get_dialogs_stmt_.view_blob(3));
+      }
       LOG(INFO) << "Load chat " << loaded_dialog_id << " with order " << loaded_dialog_order;
-      dialogs.emplace_back(std::move(data));
+      dialogs.emplace_back(std::move(dialog));
       TRY_STATUS(get_dialogs_stmt_.step());
     }
 
@@ -305,7 +320,7 @@ class DialogDbAsync : public DialogDbAsyncInterface {
   void get_dialog(DialogId dialog_id, Promise<BufferSlice> promise) override {
     send_closure_later(impl_, &Impl::get_dialog, dialog_id, std::move(promise));
   }
-  void get_dialogs(int64 order, DialogId dialog_id, int32 limit, Promise<vector<BufferSlice>> promise) override {
+  void get_dialogs(int64 order, DialogId dialog_id, int32 limit, Promise<vector<DialogDbDialog>> promise) override {
     send_closure_later(impl_, &Impl::get_dialogs, order, dialog_id, limit, std::move(promise));
   }
   void close(Promise<> promise) override {
@@ -342,7 +357,7 @@ class DialogDbAsync : public DialogDbAsyncInterface {
       add_read_query();
       promise.set_result(sync_db_->get_dialog(dialog_id));
     }
-    void get_dialogs(int64 order, DialogId dialog_id, int32 limit, Promise<vector<BufferSlice>> promise) {
+    void get_dialogs(int64 order, DialogId dialog_id, int32 limit, Promise<vector<DialogDbDialog>> promise) {
       add_read_query();
       promise.set_result(sync_db_->get_dialogs(order, dialog_id, limit));
     }
@@ -24,6 +24,11 @@ namespace td {
 class SqliteConnectionSafe;
 class SqliteDb;
 
+struct DialogDbDialog {
+  BufferSlice data;
+  BufferSlice last_message;  // empty, if there is no known last message
+};
+
 class DialogDbSyncInterface {
  public:
   DialogDbSyncInterface() = default;
@@ -36,7 +41,7 @@ class DialogDbSyncInterface {
 
   virtual Result<BufferSlice> get_dialog(DialogId dialog_id) = 0;
 
-  virtual Result<vector<BufferSlice>> get_dialogs(int64 order, DialogId dialog_id, int32 limit) = 0;
+  virtual Result<vector<DialogDbDialog>> get_dialogs(int64 order, DialogId dialog_id, int32 limit) = 0;
 
   virtual Result<vector<NotificationGroupKey>> get_notification_groups_by_last_notification_date(
       NotificationGroupKey notification_group_key, int32 limit) = 0;
@@ -69,7 +74,7 @@ class DialogDbAsyncInterface {
 
   virtual void get_dialog(DialogId dialog_id, Promise<BufferSlice> promise) = 0;
 
-  virtual void get_dialogs(int64 order, DialogId dialog_id, int32 limit, Promise<vector<BufferSlice>> promise) = 0;
+  virtual void get_dialogs(int64 order, DialogId dialog_id, int32 limit, Promise<vector<DialogDbDialog>> promise) = 0;
 
   virtual void get_notification_groups_by_last_notification_date(NotificationGroupKey notification_group_key,
                                                                  int32 limit,
@@ -9,6 +9,7 @@
 #include "td/telegram/AnimationsManager.h"
 #include "td/telegram/BackgroundManager.h"
 #include "td/telegram/ContactsManager.h"
+#include "td/telegram/DialogId.h"
 #include "td/telegram/files/FileManager.h"
 #include "td/telegram/Global.h"
 #include "td/telegram/MessagesManager.h"
@@ -20,6 +21,9 @@
 #include "td/utils/misc.h"
 #include "td/utils/overloaded.h"
 
+#include <unordered_map>
+#include <utility>
+
 namespace td {
 
 int VERBOSITY_NAME(file_references) = VERBOSITY_NAME(INFO);
@@ -259,8 +263,12 @@ void FileReferenceManager::send_query(Destination dest, FileSourceId file_source
   CHECK(index < file_sources_.size());
   file_sources_[index].visit(overloaded(
       [&](const FileSourceMessage &source) {
-        send_closure_later(G()->messages_manager(), &MessagesManager::get_message_from_server, source.full_message_id,
-                           std::move(promise), nullptr);
+        // repairs are coalesced in flush_message_repairs, so reactivating many files from the same
+        // chat costs one getMessages query per chat instead of one query per file
+        pending_message_repairs_.emplace_back(source.full_message_id, std::move(promise));
+        if (pending_message_repairs_.size() == 1) {
+          send_closure_later(actor_id(this), &FileReferenceManager::flush_message_repairs);
+        }
       },
       [&](const FileSourceUserPhoto &source) {
         send_closure_later(G()->contacts_manager(), &ContactsManager::reload_user_profile_photo, source.user_id,
@@ -294,6 +302,43 @@ void FileReferenceManager::send_query(Destination dest, FileSourceId file_source
       }));
 }
 
+void FileReferenceManager::flush_message_repairs() {
+  auto repairs = std::move(pending_message_repairs_);
+  pending_message_repairs_.clear();
+
+  // group by dialog, because get_messages_from_server sends a separate query per channel and
+  // expects to have only one query per promise
+  std::unordered_map<DialogId, vector<std::pair<FullMessageId, Promise<>>>, DialogIdHash> repairs_by_dialog;
+  for (auto &repair : repairs) {
+    repairs_by_dialog[repair.first.get_dialog_id()].push_back(std::move(repair));
+  }
+  for (auto &it : repairs_by_dialog) {
+    auto &dialog_repairs = it.second;
+    for (size_t begin = 0; begin < dialog_repairs.size(); begin += MAX_MESSAGE_REPAIRS_PER_QUERY) {
+      auto end = td::min(begin + MAX_MESSAGE_REPAIRS_PER_QUERY, dialog_repairs.size());
+      vector<FullMessageId> full_message_ids;
+      vector<Promise<>> promises;
+      for (size_t i = begin; i < end; i++) {
+        full_message_ids.push_back(dialog_repairs[i].first);
+        promises.push_back(std::move(dialog_repairs[i].second));
+      }
+      VLOG(file_references) << "Request " << full_message_ids.size() << " messages in " << it.first
+                            << " to repair file references";
+      auto promise = PromiseCreator::lambda([promises = std::move(promises)](Result<Unit> result) mutable {
+        for (auto &promise : promises) {
+          if (result.is_ok()) {
+            promise.set_value(Unit());
+          } else {
+            promise.set_error(result.error().clone());
+          }
+        }
+      });
+      send_closure_later(G()->messages_manager(), &MessagesManager::get_messages_from_server,
+                         std::move(full_message_ids), std::move(promise), nullptr);
+    }
+  }
+}
+
 FileReferenceManager::Destination FileReferenceManager::on_query_result(Destination dest, FileSourceId file_source_id,
                                                                         Status status, int32 sub) {
   VLOG(file_references) << "Receive result of file reference repair query for file " << dest.node_id
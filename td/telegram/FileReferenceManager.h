@@ -26,6 +26,7 @@
 #include "td/utils/Variant.h"
 
 #include <unordered_map>
+#include <utility>
 
 namespace td {
 
@@ -70,6 +71,8 @@ class FileReferenceManager : public Actor {
   FileSourceId parse_file_source(Td *td, ParserT &parser);
 
  private:
+  static constexpr size_t MAX_MESSAGE_REPAIRS_PER_QUERY = 100;  // server-side limit for getMessages
+
   struct Destination {
     bool empty() const {
       return node_id.empty();
@@ -133,8 +136,11 @@ class FileReferenceManager : public Actor {
 
   std::unordered_map<NodeId, Node, FileIdHash> nodes_;
 
+  vector<std::pair<FullMessageId, Promise<>>> pending_message_repairs_;
+
   void run_node(NodeId node);
   void send_query(Destination dest, FileSourceId file_source_id);
+  void flush_message_repairs();
   Destination on_query_result(Destination dest, FileSourceId file_source_id, Status status, int32 sub = 0);
 
   template <class T>
@@ -151,9 +151,10 @@ static int32 load_database_language_key_count(SqliteKeyValue *kv) {
   if (str_key_count.empty()) {
     // calculate key count once for the database and cache it
     int key_count = 0;
-    for (auto &str : kv->get_all()) {
-      key_count += str.first[0] != '!' && (str.second[0] == '1' || str.second[0] == '2');
-    }
+    kv->get_by_prefix("", [&key_count](Slice key, Slice value) {
+      key_count += !key.empty() && key[0] != '!' && !value.empty() && (value[0] == '1' || value[0] == '2');
+      return true;
+    });
     LOG(INFO) << "Set language pack key count in database to " << key_count;
     kv->set("!key_count", to_string(key_count));
     return key_count;
@@ -502,7 +503,7 @@ LanguagePackManager::Language *LanguagePackManager::add_language(LanguageDatabas
       pack->pack_kv_.init_with_connection(database->database_.clone(), get_database_table_name(language_pack, "0"))
           .ensure();
       bool need_drop_server = false;
-      for (auto &lang : pack->pack_kv_.get_all()) {
+      pack->pack_kv_.get_by_prefix("", [&](Slice lang_code, Slice lang_value) {
         auto as_bool = [](Slice data) {
           if (data == "true") {
             return true;
@@ -513,13 +514,13 @@ LanguagePackManager::Language *LanguagePackManager::add_language(LanguageDatabas
           return false;
         };
 
-        if (lang.first == "!server") {
+        if (lang_code == "!server") {
           // legacy info format, drop cache
           need_drop_server = true;
-          continue;
+          return true;
         }
-        if (lang.first == "!server2") {
-          auto all_infos = full_split(lang.second, '\x00');
+        if (lang_code == "!server2") {
+          auto all_infos = full_split(lang_value.str(), '\x00');
           if (all_infos.size() % 11 == 0) {
             for (size_t i = 0; i < all_infos.size(); i += 11) {
               LanguageInfo info;
@@ -538,17 +539,17 @@ LanguagePackManager::Language *LanguagePackManager::add_language(LanguageDatabas
               pack->server_language_pack_infos_.emplace_back(std::move(all_infos[i]), std::move(info));
             }
           } else {
-            LOG(ERROR) << "Have wrong language pack info \"" << lang.second << "\" in the database";
+            LOG(ERROR) << "Have wrong language pack info \"" << lang_value << "\" in the database";
           }
-          continue;
+          return true;
         }
 
-        auto all_infos = full_split(lang.second, '\x00');
+        auto all_infos = full_split(lang_value.str(), '\x00');
         if (all_infos.size() < 2) {
-          LOG(ERROR) << "Have wrong custom language pack info \"" << lang.second << '"';
-          continue;
+          LOG(ERROR) << "Have wrong custom language pack info \"" << lang_value << '"';
+          return true;
         }
-        auto &info = pack->custom_language_pack_infos_[lang.first];
+        auto &info = pack->custom_language_pack_infos_[lang_code.str()];
         info.name_ = std::move(all_infos[0]);
         info.native_name_ = std::move(all_infos[1]);
         if (all_infos.size() > 2) {
@@ -563,7 +564,8 @@ LanguagePackManager::Language *LanguagePackManager::add_language(LanguageDatabas
           info.translation_url_ = std::move(all_infos[9]);
         }
         info.is_from_database_ = true;
-      }
+        return true;
+      });
       if (need_drop_server) {
         LOG(INFO) << "Drop old server language pack info cache";
         pack->pack_kv_.erase("!server");
@@ -663,17 +665,18 @@ bool LanguagePackManager::load_language_strings(LanguageDatabase *database, Lang
       return false;
     }
 
-    auto all_strings = language->kv_.get_all();
-    for (auto &str : all_strings) {
-      if (str.first[0] == '!') {
-        continue;
+    language->kv_.get_by_prefix("", [&](Slice key, Slice value) {
+      if (key.empty() || key[0] == '!') {
+        return true;
       }
 
-      if (!language_has_string_unsafe(language, str.first)) {
-        LOG(DEBUG) << "Load string with key " << str.first << " from database";
-        load_language_string_unsafe(language, str.first, str.second);
+      auto key_str = key.str();
+      if (!language_has_string_unsafe(language, key_str)) {
+        LOG(DEBUG) << "Load string with key " << key_str << " from database";
+        load_language_string_unsafe(language, key_str, value.str());
       }
-    }
+      return true;
+    });
     language->was_loaded_full_ = true;
 
     if (language->version_ == -1) {
@@ -1123,8 +1126,8 @@ void LanguagePackManager::synchronize_language_pack(string language_code, Promis
   }
 
   Language *language = add_language(database_, language_pack_, language_code);
-  load_language_strings(database_, language, vector<string>());
-
+  // the pack is served from the database string by string; synchronization only
+  // needs the version, which is known since add_language
   int32 version = language->version_.load();
   if (version == -1) {
     version = 0;
@@ -1303,7 +1306,32 @@ void LanguagePackManager::on_get_language_pack_strings(
       language = add_language(database_, language_pack, language_code);
       CHECK(language != nullptr);
     }
-    load_language_strings(database_, language, keys);
+    if (keys.empty() && is_diff) {
+      // applying a difference doesn't need the whole pack resident in memory;
+      // loading the affected keys is enough to keep the key count and
+      // deleted-string bookkeeping correct, other strings stay in the database
+      vector<string> diff_keys;
+      for (auto &result : results) {
+        CHECK(result != nullptr);
+        switch (result->get_id()) {
+          case telegram_api::langPackString::ID:
+            diff_keys.push_back(static_cast<const telegram_api::langPackString *>(result.get())->key_);
+            break;
+          case telegram_api::langPackStringPluralized::ID:
+            diff_keys.push_back(static_cast<const telegram_api::langPackStringPluralized *>(result.get())->key_);
+            break;
+          case telegram_api::langPackStringDeleted::ID:
+            diff_keys.push_back(static_cast<const telegram_api::langPackStringDeleted *>(result.get())->key_);
+            break;
+          default:
+            UNREACHABLE();
+            break;
+        }
+      }
+      load_language_strings(database_, language, diff_keys);
+    } else {
+      load_language_strings(database_, language, keys);
+    }
 
     std::lock_guard<std::mutex> lock(language->mutex_);
     int32 key_count_delta = 0;
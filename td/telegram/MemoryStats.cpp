@@ -0,0 +1,36 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/MemoryStats.h"
+
+#include "td/utils/format.h"
+#include "td/utils/logging.h"
+
+namespace td {
+
+void MemoryStats::add_entry(Slice manager, Slice name, uint64 count, uint64 approximate_size) {
+  entries_.push_back(Entry{PSTRING() << manager << '.' << name, count, approximate_size});
+}
+
+string MemoryStats::as_string() const {
+  uint64 total_count = 0;
+  uint64 total_size = 0;
+  string result;
+  for (auto &entry : entries_) {
+    if (entry.count == 0) {
+      continue;
+    }
+    total_count += entry.count;
+    total_size += entry.approximate_size;
+    result += PSTRING() << '\n'
+                        << entry.name << ": " << entry.count << " objects, >= "
+                        << format::as_size(entry.approximate_size);
+  }
+  result += PSTRING() << "\ntotal: " << total_count << " objects, >= " << format::as_size(total_size);
+  return result;
+}
+
+}  // namespace td
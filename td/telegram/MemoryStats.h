@@ -0,0 +1,39 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+
+namespace td {
+
+// Per-manager breakdown of the in-memory object caches: how many objects each
+// main container holds and a lower-bound estimate of the bytes they pin. The
+// estimate covers only the container elements themselves, not heap payloads
+// owned by them, so it is meant for trends and relative comparison rather than
+// exact RSS attribution.
+class MemoryStats {
+ public:
+  template <class ContainerT>
+  void add(Slice manager, Slice name, const ContainerT &container) {
+    add_entry(manager, name, container.size(), container.size() * sizeof(typename ContainerT::value_type));
+  }
+
+  void add_entry(Slice manager, Slice name, uint64 count, uint64 approximate_size);
+
+  string as_string() const;
+
+ private:
+  struct Entry {
+    string name;
+    uint64 count;
+    uint64 approximate_size;
+  };
+  vector<Entry> entries_;
+};
+
+}  // namespace td
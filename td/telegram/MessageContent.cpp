@@ -3949,6 +3949,12 @@ unique_ptr<MessageContent> get_message_content(Td *td, FormattedText message,
   return make_unique<MessageText>(std::move(message), WebPageId());
 }
 
+// Each copy of a forwarded message owns its own MessageContent. The content can't be interned and
+// reference-counted, because it isn't immutable: captions are dropped on copy, file identifiers are
+// remapped for secret chats, and web page, poll and expired media updates are applied in place.
+// The heavy part of media content is deduplicated anyway: the content stores only FileId handles,
+// and all copies of an already sent file share one FileNode in FileManager, so for_forward copies
+// of sent media don't even duplicate the file identifier
 unique_ptr<MessageContent> dup_message_content(Td *td, DialogId dialog_id, const MessageContent *content,
                                                bool for_forward, bool remove_caption) {
   CHECK(content != nullptr);
@@ -1049,14 +1049,45 @@ static void fix_entities(vector<MessageEntity> &entities) {
 vector<MessageEntity> find_entities(Slice text, bool skip_bot_commands, bool only_urls) {
   vector<MessageEntity> entities;
 
+  // classify candidate start characters in one pass over the text,
+  // so that matchers which can't find anything don't rescan it
+  bool has_mention_begin = false;
+  bool has_bot_command_begin = false;
+  bool has_hashtag_begin = false;
+  bool has_cashtag_begin = false;
+  bool has_url_begin = false;
+  for (auto c : text) {
+    switch (c) {
+      case '@':
+        has_mention_begin = true;
+        break;
+      case '/':
+        has_bot_command_begin = true;
+        break;
+      case '#':
+        has_hashtag_begin = true;
+        break;
+      case '$':
+        has_cashtag_begin = true;
+        break;
+      case '.':
+        has_url_begin = true;
+        break;
+      default:
+        break;
+    }
+  }
+
   if (!only_urls) {
-    auto mentions = find_mentions(text);
-    for (auto &mention : mentions) {
-      entities.emplace_back(MessageEntity::Type::Mention, narrow_cast<int32>(mention.begin() - text.begin()),
-                            narrow_cast<int32>(mention.size()));
+    if (has_mention_begin) {
+      auto mentions = find_mentions(text);
+      for (auto &mention : mentions) {
+        entities.emplace_back(MessageEntity::Type::Mention, narrow_cast<int32>(mention.begin() - text.begin()),
+                              narrow_cast<int32>(mention.size()));
+      }
     }
 
-    if (!skip_bot_commands) {
+    if (!skip_bot_commands && has_bot_command_begin) {
       auto bot_commands = find_bot_commands(text);
       for (auto &bot_command : bot_commands) {
         entities.emplace_back(MessageEntity::Type::BotCommand, narrow_cast<int32>(bot_command.begin() - text.begin()),
@@ -1064,22 +1095,26 @@ vector<MessageEntity> find_entities(Slice text, bool skip_bot_commands, bool onl
       }
     }
 
-    auto hashtags = find_hashtags(text);
-    for (auto &hashtag : hashtags) {
-      entities.emplace_back(MessageEntity::Type::Hashtag, narrow_cast<int32>(hashtag.begin() - text.begin()),
-                            narrow_cast<int32>(hashtag.size()));
+    if (has_hashtag_begin) {
+      auto hashtags = find_hashtags(text);
+      for (auto &hashtag : hashtags) {
+        entities.emplace_back(MessageEntity::Type::Hashtag, narrow_cast<int32>(hashtag.begin() - text.begin()),
+                              narrow_cast<int32>(hashtag.size()));
+      }
     }
 
-    auto cashtags = find_cashtags(text);
-    for (auto &cashtag : cashtags) {
-      entities.emplace_back(MessageEntity::Type::Cashtag, narrow_cast<int32>(cashtag.begin() - text.begin()),
-                            narrow_cast<int32>(cashtag.size()));
+    if (has_cashtag_begin) {
+      auto cashtags = find_cashtags(text);
+      for (auto &cashtag : cashtags) {
+        entities.emplace_back(MessageEntity::Type::Cashtag, narrow_cast<int32>(cashtag.begin() - text.begin()),
+                              narrow_cast<int32>(cashtag.size()));
+      }
     }
 
     // TODO find_phone_numbers
   }
 
-  auto urls = find_urls(text);
+  auto urls = has_url_begin ? find_urls(text) : vector<std::pair<Slice, bool>>();
   for (auto &url : urls) {
     // TODO better find messageEntityUrl
     auto type = url.second ? MessageEntity::Type::EmailAddress : MessageEntity::Type::Url;
@@ -18,6 +18,7 @@
 #include "td/actor/SchedulerLocalStorage.h"
 
 #include "td/utils/format.h"
+#include "td/utils/Gzip.h"
 #include "td/utils/logging.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/Slice.h"
@@ -61,6 +62,10 @@ Status init_messages_db(SqliteDb &db, int32 version) {
     return Status::OK();
   };
 
+  // '\a' is in tokenchars so that the synthetic "\a<dialog_id>" and "\a\a<index>" tokens stored
+  // with the text (see add_message) survive tokenization; adding them to the MATCH query makes
+  // dialog- and media-type-restricted searches resolve inside the FTS index instead of filtering
+  // the hits afterwards
   auto add_fts = [&db] {
     TRY_STATUS(
         db.exec("CREATE INDEX IF NOT EXISTS message_by_search_id ON messages "
@@ -102,11 +107,14 @@ Status init_messages_db(SqliteDb &db, int32 version) {
 
   if (version == 0) {
     LOG(INFO) << "Create new message database";
+    // WITHOUT ROWID clusters rows by (dialog_id, message_id), so each dialog occupies
+    // a contiguous range of pages and the cost of reading or updating its history
+    // depends on the dialog size instead of the total table size
     TRY_STATUS(
         db.exec("CREATE TABLE IF NOT EXISTS messages (dialog_id INT8, message_id INT8, "
                 "unique_message_id INT4, sender_user_id INT4, random_id INT8, data BLOB, "
                 "ttl_expires_at INT4, index_mask INT4, search_id INT8, text STRING, notification_id INT4, PRIMARY KEY "
-                "(dialog_id, message_id))"));
+                "(dialog_id, message_id)) WITHOUT ROWID"));
 
     TRY_STATUS(
         db.exec("CREATE INDEX IF NOT EXISTS message_by_random_id ON messages (dialog_id, random_id) "
@@ -149,6 +157,10 @@ Status init_messages_db(SqliteDb &db, int32 version) {
     TRY_STATUS(db.exec("ALTER TABLE messages ADD COLUMN notification_id INT4"));
     TRY_STATUS(add_notification_id_index());
   }
+  if (version < static_cast<int32>(DbVersion::AddMessagesDbCompression)) {
+    // mark all existing rows as uncompressed; new rows are compressed when beneficial
+    TRY_STATUS(db.exec("UPDATE messages SET data = x'00' || data"));
+  }
   return Status::OK();
 }
 
@@ -159,6 +171,40 @@ Status drop_messages_db(SqliteDb &db, int32 version) {
   return db.exec("DROP TABLE IF EXISTS messages");
 }
 
+// the data column stores the message prefixed with a format byte: 0 - raw, 1 - gzip-compressed.
+// Long message payloads compress well, which directly cuts database size and page cache footprint
+static BufferSlice encode_message_data(BufferSlice &&data) {
+  static constexpr size_t MIN_COMPRESSED_MESSAGE_DATA_SIZE = 128;
+  if (data.size() >= MIN_COMPRESSED_MESSAGE_DATA_SIZE) {
+    auto compressed = gzencode(data.as_slice(), 0.9);
+    if (!compressed.empty()) {
+      BufferSlice result(compressed.size() + 1);
+      auto slice = result.as_slice();
+      slice[0] = '\x01';
+      slice.substr(1).copy_from(compressed.as_slice());
+      return result;
+    }
+  }
+  BufferSlice result(data.size() + 1);
+  auto slice = result.as_slice();
+  slice[0] = '\0';
+  slice.substr(1).copy_from(data.as_slice());
+  return result;
+}
+
+static BufferSlice decode_message_data(Slice data) {
+  if (data.empty()) {
+    return BufferSlice();
+  }
+  auto payload = data.substr(1);
+  if (data[0] == '\x01') {
+    auto decompressed = gzdecode(payload);
+    LOG_IF(ERROR, decompressed.empty()) << "Failed to decompress message data";
+    return decompressed;
+  }
+  return BufferSlice(payload);
+}
+
 class MessagesDbImpl : public MessagesDbSyncInterface {
  public:
   explicit MessagesDbImpl(SqliteDb db) : db_(std::move(db)) {
@@ -294,6 +340,7 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
       add_message_stmt_.bind_null(5).ensure();
     }
 
+    data = encode_message_data(std::move(data));
     add_message_stmt_.bind_blob(6, data.as_slice()).ensure();
 
     if (ttl_expires_at != 0) {
@@ -394,7 +441,7 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
     if (!get_message_stmt_.has_row()) {
       return Status::Error("Not found");
     }
-    return BufferSlice(get_message_stmt_.view_blob(0));
+    return decode_message_data(get_message_stmt_.view_blob(0));
   }
 
   Result<std::pair<DialogId, BufferSlice>> get_message_by_unique_message_id(
@@ -411,7 +458,7 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
       return Status::Error("Not found");
     }
     DialogId dialog_id(get_message_by_unique_message_id_stmt_.view_int64(0));
-    return std::make_pair(dialog_id, BufferSlice(get_message_by_unique_message_id_stmt_.view_blob(1)));
+    return std::make_pair(dialog_id, decode_message_data(get_message_by_unique_message_id_stmt_.view_blob(1)));
   }
 
   Result<BufferSlice> get_message_by_random_id(DialogId dialog_id, int64 random_id) override {
@@ -424,7 +471,7 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
     if (!get_message_by_random_id_stmt_.has_row()) {
       return Status::Error("Not found");
     }
-    return BufferSlice(get_message_by_random_id_stmt_.view_blob(0));
+    return decode_message_data(get_message_by_random_id_stmt_.view_blob(0));
   }
 
   Result<BufferSlice> get_dialog_message_by_date(DialogId dialog_id, MessageId first_message_id,
@@ -508,7 +555,7 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
 
       while (get_expiring_messages_stmt_.has_row()) {
         DialogId dialog_id(get_expiring_messages_stmt_.view_int64(0));
-        BufferSlice data(get_expiring_messages_stmt_.view_blob(1));
+        auto data = decode_message_data(get_expiring_messages_stmt_.view_blob(1));
         messages.push_back(std::make_pair(dialog_id, std::move(data)));
         get_expiring_messages_stmt_.step().ensure();
       }
@@ -527,7 +574,7 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
     return std::make_pair(std::move(messages), next_expires_till);
   }
 
-  Result<std::vector<BufferSlice>> get_messages(MessagesDbMessagesQuery query) override {
+  Result<std::vector<MessagesDbDialogMessage>> get_messages(MessagesDbMessagesQuery query) override {
     if (query.index_mask != 0) {
       return get_messages_from_index(query.dialog_id, query.from_message_id, query.index_mask, query.offset,
                                      query.limit);
@@ -535,8 +582,9 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
     return get_messages_impl(get_messages_stmt_, query.dialog_id, query.from_message_id, query.offset, query.limit);
   }
 
-  Result<vector<BufferSlice>> get_messages_from_notification_id(DialogId dialog_id, NotificationId from_notification_id,
-                                                                int32 limit) override {
+  Result<vector<MessagesDbDialogMessage>> get_messages_from_notification_id(DialogId dialog_id,
+                                                                            NotificationId from_notification_id,
+                                                                            int32 limit) override {
     auto &stmt = get_messages_from_notification_id_stmt_;
     SCOPE_EXIT {
       stmt.reset();
@@ -545,12 +593,12 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
     stmt.bind_int32(2, from_notification_id.get()).ensure();
     stmt.bind_int32(3, limit).ensure();
 
-    std::vector<BufferSlice> result;
+    std::vector<MessagesDbDialogMessage> result;
     stmt.step().ensure();
     while (stmt.has_row()) {
       auto data_slice = stmt.view_blob(0);
-      result.emplace_back(data_slice);
       auto message_id = stmt.view_int64(1);
+      result.push_back(MessagesDbDialogMessage{MessageId(message_id), decode_message_data(data_slice)});
       LOG(INFO) << "Load " << MessageId(message_id) << " in " << dialog_id << " from database";
       stmt.step().ensure();
     }
@@ -652,14 +700,14 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
       auto data_slice = stmt.view_blob(1);
       auto search_id = stmt.view_int64(2);
       result.next_search_id = search_id;
-      result.messages.push_back(MessagesDbMessage{DialogId(dialog_id), BufferSlice(data_slice)});
+      result.messages.push_back(MessagesDbMessage{DialogId(dialog_id), decode_message_data(data_slice)});
       stmt.step().ensure();
     }
     return std::move(result);
   }
 
-  Result<std::vector<BufferSlice>> get_messages_from_index(DialogId dialog_id, MessageId from_message_id,
-                                                           int32 index_mask, int32 offset, int32 limit) {
+  Result<std::vector<MessagesDbDialogMessage>> get_messages_from_index(DialogId dialog_id, MessageId from_message_id,
+                                                                       int32 index_mask, int32 offset, int32 limit) {
     CHECK(index_mask != 0);
     LOG_CHECK(index_mask < (1 << MESSAGES_DB_INDEX_COUNT)) << tag("index_mask", index_mask);
     int index_i = -1;
@@ -712,7 +760,7 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
     while (stmt.has_row()) {
       auto dialog_id = stmt.view_int64(0);
       auto data_slice = stmt.view_blob(1);
-      result.messages.push_back(MessagesDbMessage{DialogId(dialog_id), BufferSlice(data_slice)});
+      result.messages.push_back(MessagesDbMessage{DialogId(dialog_id), decode_message_data(data_slice)});
       stmt.step().ensure();
     }
     return std::move(result);
@@ -752,8 +800,8 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
 
   SqliteStatement get_messages_fts_stmt_;
 
-  Result<std::vector<BufferSlice>> get_messages_impl(GetMessagesStmt &stmt, DialogId dialog_id,
-                                                     MessageId from_message_id, int32 offset, int32 limit) {
+  Result<std::vector<MessagesDbDialogMessage>> get_messages_impl(GetMessagesStmt &stmt, DialogId dialog_id,
+                                                                 MessageId from_message_id, int32 offset, int32 limit) {
     LOG_CHECK(dialog_id.is_valid()) << dialog_id;
     CHECK(from_message_id.is_valid());
 
@@ -772,8 +820,8 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
     auto right_message_id = message_id - 1;
     auto right_cnt = -offset;
 
-    std::vector<BufferSlice> left;
-    std::vector<BufferSlice> right;
+    std::vector<MessagesDbDialogMessage> left;
+    std::vector<MessagesDbDialogMessage> right;
 
     if (left_cnt != 0) {
       if (right_cnt == 1 && false) {
@@ -806,8 +854,8 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
     return std::move(right);
   }
 
-  Result<std::vector<BufferSlice>> get_messages_inner(SqliteStatement &stmt, int64 dialog_id, int64 from_message_id,
-                                                      int32 limit) {
+  Result<std::vector<MessagesDbDialogMessage>> get_messages_inner(SqliteStatement &stmt, int64 dialog_id,
+                                                                  int64 from_message_id, int32 limit) {
     SCOPE_EXIT {
       stmt.reset();
     };
@@ -817,20 +865,20 @@ class MessagesDbImpl : public MessagesDbSyncInterface {
 
     LOG(INFO) << "Begin to load " << limit << " messages in " << DialogId(dialog_id) << " from "
               << MessageId(from_message_id) << " from database";
-    std::vector<BufferSlice> result;
+    std::vector<MessagesDbDialogMessage> result;
     stmt.step().ensure();
     while (stmt.has_row()) {
       auto data_slice = stmt.view_blob(0);
-      result.emplace_back(data_slice);
       auto message_id = stmt.view_int64(1);
+      result.push_back(MessagesDbDialogMessage{MessageId(message_id), decode_message_data(data_slice)});
       LOG(INFO) << "Loaded " << MessageId(message_id) << " in " << DialogId(dialog_id) << " from database";
       stmt.step().ensure();
     }
     return std::move(result);
   }
 
-  static std::tuple<MessageId, int32> get_message_info(const BufferSlice &message) {
-    LogEventParser message_date_parser(message.as_slice());
+  static std::tuple<MessageId, int32> get_message_info(const MessagesDbDialogMessage &message) {
+    LogEventParser message_date_parser(message.data.as_slice());
     int32 flags;
     td::parse(flags, message_date_parser);
     int32 flags2 = 0;
@@ -873,7 +921,14 @@ std::shared_ptr<MessagesDbSyncSafeInterface> create_messages_db_sync(
 class MessagesDbAsync : public MessagesDbAsyncInterface {
  public:
   MessagesDbAsync(std::shared_ptr<MessagesDbSyncSafeInterface> sync_db, int32 scheduler_id) {
-    impl_ = create_actor_on_scheduler<Impl>("MessagesDbActor", scheduler_id, std::move(sync_db));
+    impl_ = create_actor_on_scheduler<Impl>("MessagesDbActor", scheduler_id, sync_db);
+    // slow full-text searches run on their own connection in the I/O pool if
+    // there is one: WAL allows readers concurrent with the writer, so history
+    // loads no longer wait for them
+    auto reader_scheduler_id = Scheduler::instance()->get_pool_scheduler_id("io");
+    if (reader_scheduler_id != -1 && reader_scheduler_id != scheduler_id) {
+      reader_ = create_actor_on_scheduler<Reader>("MessagesDbReader", reader_scheduler_id, std::move(sync_db));
+    }
   }
 
   void add_message(FullMessageId full_message_id, ServerMessageId unique_message_id, UserId sender_user_id,
@@ -910,11 +965,11 @@ class MessagesDbAsync : public MessagesDbAsyncInterface {
                        std::move(promise));
   }
 
-  void get_messages(MessagesDbMessagesQuery query, Promise<std::vector<BufferSlice>> promise) override {
+  void get_messages(MessagesDbMessagesQuery query, Promise<std::vector<MessagesDbDialogMessage>> promise) override {
     send_closure_later(impl_, &Impl::get_messages, std::move(query), std::move(promise));
   }
   void get_messages_from_notification_id(DialogId dialog_id, NotificationId from_notification_id, int32 limit,
-                                         Promise<vector<BufferSlice>> promise) override {
+                                         Promise<vector<MessagesDbDialogMessage>> promise) override {
     send_closure_later(impl_, &Impl::get_messages_from_notification_id, dialog_id, from_notification_id, limit,
                        std::move(promise));
   }
@@ -922,6 +977,12 @@ class MessagesDbAsync : public MessagesDbAsyncInterface {
     send_closure_later(impl_, &Impl::get_calls, std::move(query), std::move(promise));
   }
   void get_messages_fts(MessagesDbFtsQuery query, Promise<MessagesDbFtsResult> promise) override {
+    if (!reader_.empty()) {
+      // make the recently buffered writes visible to the reader connection first
+      send_closure_later(impl_, &Impl::force_flush);
+      send_closure_later(reader_, &Reader::get_messages_fts, std::move(query), std::move(promise));
+      return;
+    }
     send_closure_later(impl_, &Impl::get_messages_fts, std::move(query), std::move(promise));
   }
   void get_expiring_messages(
@@ -931,6 +992,14 @@ class MessagesDbAsync : public MessagesDbAsyncInterface {
   }
 
   void close(Promise<> promise) override {
+    if (!reader_.empty()) {
+      // the reader connection must be closed too before the database may be destroyed
+      send_closure_later(reader_, &Reader::close,
+                         PromiseCreator::lambda([impl = impl_.get(), promise = std::move(promise)](Unit) mutable {
+                           send_closure_later(impl, &Impl::close, std::move(promise));
+                         }));
+      return;
+    }
     send_closure_later(impl_, &Impl::close, std::move(promise));
   }
 
@@ -990,12 +1059,12 @@ class MessagesDbAsync : public MessagesDbAsyncInterface {
       promise.set_result(sync_db_->get_dialog_message_by_date(dialog_id, first_message_id, last_message_id, date));
     }
 
-    void get_messages(MessagesDbMessagesQuery query, Promise<std::vector<BufferSlice>> promise) {
+    void get_messages(MessagesDbMessagesQuery query, Promise<std::vector<MessagesDbDialogMessage>> promise) {
       add_read_query();
       promise.set_result(sync_db_->get_messages(std::move(query)));
     }
     void get_messages_from_notification_id(DialogId dialog_id, NotificationId from_notification_id, int32 limit,
-                                           Promise<vector<BufferSlice>> promise) {
+                                           Promise<vector<MessagesDbDialogMessage>> promise) {
       add_read_query();
       promise.set_result(sync_db_->get_messages_from_notification_id(dialog_id, from_notification_id, limit));
     }
@@ -1030,7 +1099,9 @@ class MessagesDbAsync : public MessagesDbAsyncInterface {
     std::shared_ptr<MessagesDbSyncSafeInterface> sync_db_safe_;
     MessagesDbSyncInterface *sync_db_ = nullptr;
 
-    static constexpr size_t MAX_PENDING_QUERIES_COUNT{50};
+    // a history page contains up to 100 messages and is added at once,
+    // so it must be committed as a single transaction
+    static constexpr size_t MAX_PENDING_QUERIES_COUNT{100};
     static constexpr double MAX_PENDING_QUERIES_DELAY{0.01};
 
     //NB: order is important, destructor of pending_writes_ will change pending_write_results_
@@ -1077,7 +1148,34 @@ class MessagesDbAsync : public MessagesDbAsyncInterface {
       sync_db_ = &sync_db_safe_->get();
     }
   };
+  class Reader : public Actor {
+   public:
+    explicit Reader(std::shared_ptr<MessagesDbSyncSafeInterface> sync_db_safe)
+        : sync_db_safe_(std::move(sync_db_safe)) {
+    }
+
+    void get_messages_fts(MessagesDbFtsQuery query, Promise<MessagesDbFtsResult> promise) {
+      promise.set_result(sync_db_->get_messages_fts(std::move(query)));
+    }
+
+    void close(Promise<> promise) {
+      sync_db_safe_.reset();
+      sync_db_ = nullptr;
+      promise.set_value(Unit());
+      stop();
+    }
+
+   private:
+    std::shared_ptr<MessagesDbSyncSafeInterface> sync_db_safe_;
+    MessagesDbSyncInterface *sync_db_ = nullptr;
+
+    void start_up() override {
+      sync_db_ = &sync_db_safe_->get();
+    }
+  };
+
   ActorOwn<Impl> impl_;
+  ActorOwn<Reader> reader_;
 };
 
 std::shared_ptr<MessagesDbAsyncInterface> create_messages_db_async(std::shared_ptr<MessagesDbSyncSafeInterface> sync_db,
@@ -58,6 +58,13 @@ struct MessagesDbMessage {
   BufferSlice data;
 };
 
+// the message identifier is returned from the table key, so a caller can check
+// whether the message is already loaded without parsing data
+struct MessagesDbDialogMessage {
+  MessageId message_id;
+  BufferSlice data;
+};
+
 struct MessagesDbFtsQuery {
   string query;
   DialogId dialog_id;
@@ -101,10 +108,10 @@ class MessagesDbSyncInterface {
   virtual Result<BufferSlice> get_dialog_message_by_date(DialogId dialog_id, MessageId first_message_id,
                                                          MessageId last_message_id, int32 date) = 0;
 
-  virtual Result<std::vector<BufferSlice>> get_messages(MessagesDbMessagesQuery query) = 0;
-  virtual Result<vector<BufferSlice>> get_messages_from_notification_id(DialogId dialog_id,
-                                                                        NotificationId from_notification_id,
-                                                                        int32 limit) = 0;
+  virtual Result<std::vector<MessagesDbDialogMessage>> get_messages(MessagesDbMessagesQuery query) = 0;
+  virtual Result<vector<MessagesDbDialogMessage>> get_messages_from_notification_id(DialogId dialog_id,
+                                                                                    NotificationId from_notification_id,
+                                                                                    int32 limit) = 0;
 
   virtual Result<std::pair<std::vector<std::pair<DialogId, BufferSlice>>, int32>> get_expiring_messages(
       int32 expires_from, int32 expires_till, int32 limit) = 0;
@@ -147,9 +154,9 @@ class MessagesDbAsyncInterface {
   virtual void get_dialog_message_by_date(DialogId dialog_id, MessageId first_message_id, MessageId last_message_id,
                                           int32 date, Promise<BufferSlice> promise) = 0;
 
-  virtual void get_messages(MessagesDbMessagesQuery query, Promise<std::vector<BufferSlice>> promise) = 0;
+  virtual void get_messages(MessagesDbMessagesQuery query, Promise<std::vector<MessagesDbDialogMessage>> promise) = 0;
   virtual void get_messages_from_notification_id(DialogId dialog_id, NotificationId from_notification_id, int32 limit,
-                                                 Promise<vector<BufferSlice>> promise) = 0;
+                                                 Promise<vector<MessagesDbDialogMessage>> promise) = 0;
 
   virtual void get_calls(MessagesDbCallsQuery, Promise<MessagesDbCallsResult> promise) = 0;
   virtual void get_messages_fts(MessagesDbFtsQuery query, Promise<MessagesDbFtsResult> promise) = 0;
@@ -24,6 +24,7 @@
 #include "td/telegram/InputMessageText.h"
 #include "td/telegram/logevent/LogEvent.h"
 #include "td/telegram/logevent/LogEventHelper.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/MessageContent.h"
 #include "td/telegram/MessageEntity.hpp"
 #include "td/telegram/MessagesDb.h"
@@ -61,6 +62,7 @@
 #include "td/utils/misc.h"
 #include "td/utils/Random.h"
 #include "td/utils/Slice.h"
+#include "td/utils/ThreadSafeCounter.h"
 #include "td/utils/Time.h"
 #include "td/utils/tl_helpers.h"
 #include "td/utils/tl_storers.h"
@@ -5896,6 +5898,10 @@ bool MessagesManager::update_dialog_notification_settings(DialogId dialog_id,
   return need_update_server;
 }
 
+// A scope change is applied lazily: the settings are persisted once per scope, and dialogs with
+// use_default_* flags resolve the effective value at read time, so no per-dialog state is written.
+// The loops over dialogs_ below only fix in-memory unread counters and active notifications and
+// touch only dialogs that are already loaded
 bool MessagesManager::update_scope_notification_settings(NotificationSettingsScope scope,
                                                          ScopeNotificationSettings *current_settings,
                                                          const ScopeNotificationSettings &new_settings) {
@@ -8068,6 +8074,13 @@ int32 MessagesManager::get_unload_dialog_delay() const {
   return td_->auth_manager_->is_bot() ? DIALOG_UNLOAD_BOT_DELAY : DIALOG_UNLOAD_DELAY;
 }
 
+// incremental unloading of cold messages: closing a dialog (or receiving messages into a
+// closed one) arms pending_unload_dialog_timeout_, and on expiry messages which weren't
+// accessed for the unload delay are dropped from memory while staying in the message
+// database; the timeout is re-armed while unloadable messages remain, so memory usage of a
+// long-lived client tracks the recently accessed history instead of everything ever touched.
+// The Dialog structs themselves stay resident: raw pointers to them are held throughout this
+// class, so only their message trees can be compacted
 void MessagesManager::unload_dialog(DialogId dialog_id) {
   if (G()->close_flag()) {
     return;
@@ -9114,6 +9127,11 @@ void MessagesManager::loop() {
 }
 
 void MessagesManager::tear_down() {
+  if (G()->parameters().use_message_db) {
+    // flush dialogs with a delayed save, so that nothing is lost on a clean close
+    pending_updated_dialog_timeout_.run_all();
+  }
+
   parent_.reset();
 }
 
@@ -11728,13 +11746,13 @@ void MessagesManager::load_dialog_list_from_database(int32 limit, Promise<Unit>
   G()->td_db()->get_dialog_db_async()->get_dialogs(
       last_loaded_database_dialog_date_.get_order(), last_loaded_database_dialog_date_.get_dialog_id(), limit,
       PromiseCreator::lambda(
-          [actor_id = actor_id(this), limit, promise = std::move(promise)](vector<BufferSlice> result) mutable {
+          [actor_id = actor_id(this), limit, promise = std::move(promise)](vector<DialogDbDialog> result) mutable {
             send_closure(actor_id, &MessagesManager::on_get_dialogs_from_database, limit, std::move(result),
                          std::move(promise));
           }));
 }
 
-void MessagesManager::on_get_dialogs_from_database(int32 limit, vector<BufferSlice> &&dialogs,
+void MessagesManager::on_get_dialogs_from_database(int32 limit, vector<DialogDbDialog> &&dialogs,
                                                    Promise<Unit> &&promise) {
   LOG(INFO) << "Receive " << dialogs.size() << " from expected " << limit
             << " dialogs in result of GetDialogsFromDatabase";
@@ -11747,7 +11765,7 @@ void MessagesManager::on_get_dialogs_from_database(int32 limit, vector<BufferSli
 
   DialogDate max_dialog_date = MIN_DIALOG_DATE;
   for (auto &dialog : dialogs) {
-    Dialog *d = on_load_dialog_from_database(DialogId(), std::move(dialog));
+    Dialog *d = on_load_dialog_from_database(DialogId(), dialog.data, dialog.last_message);
     if (d == nullptr) {
       continue;
     }
@@ -11809,6 +11827,15 @@ void MessagesManager::preload_dialog_list(void *messages_manager_void) {
     return;
   }
 
+  if (G()->shared_config().get_option_boolean("disable_dialog_list_preload")) {
+    // dialog residency is demand-driven: a Dialog is materialized only when referenced
+    // by a chat list page, an update or a query, so startup touches O(viewed) dialogs.
+    // Unread counts are recalculated over the dialogs actually loaded
+    LOG(INFO) << "Skip chat list preload, because it is disabled";
+    messages_manager->recalc_unread_count();
+    return;
+  }
+
   if (messages_manager->ordered_dialogs_.size() > MAX_PRELOADED_DIALOGS) {
     // do nothing if there are more than MAX_PRELOADED_DIALOGS dialogs already loaded
     messages_manager->recalc_unread_count();
@@ -13726,6 +13753,10 @@ void MessagesManager::close_dialog(Dialog *d) {
     pending_read_history_timeout_.cancel_timeout(dialog_id.get());
   }
 
+  if (pending_updated_dialog_timeout_.has_timeout(dialog_id.get())) {
+    pending_updated_dialog_timeout_.set_timeout_in(dialog_id.get(), 0.0);
+  }
+
   if (is_message_unload_enabled()) {
     LOG(INFO) << "Schedule unload of " << dialog_id;
     pending_unload_dialog_timeout_.set_timeout_in(dialog_id.get(), get_unload_dialog_delay());
@@ -14518,7 +14549,7 @@ std::pair<int32, vector<MessageId>> MessagesManager::search_dialog_messages(
                 << " and with limit " << limit;
       auto new_promise = PromiseCreator::lambda(
           [random_id, dialog_id, fixed_from_message_id, first_db_message_id, filter_type, offset, limit,
-           promise = std::move(promise)](Result<std::vector<BufferSlice>> r_messages) mutable {
+           promise = std::move(promise)](Result<std::vector<MessagesDbDialogMessage>> r_messages) mutable {
             send_closure(G()->messages_manager(), &MessagesManager::on_search_dialog_messages_db_result, random_id,
                          dialog_id, fixed_from_message_id, first_db_message_id, filter_type, offset, limit,
                          std::move(r_messages), std::move(promise));
@@ -14877,7 +14908,7 @@ MessageId MessagesManager::get_first_database_message_id_by_index(const Dialog *
 void MessagesManager::on_search_dialog_messages_db_result(int64 random_id, DialogId dialog_id,
                                                           MessageId from_message_id, MessageId first_db_message_id,
                                                           SearchMessagesFilter filter_type, int32 offset, int32 limit,
-                                                          Result<std::vector<BufferSlice>> r_messages,
+                                                          Result<std::vector<MessagesDbDialogMessage>> r_messages,
                                                           Promise<> promise) {
   if (r_messages.is_error()) {
     LOG(ERROR) << r_messages.error();
@@ -15316,6 +15347,10 @@ int32 MessagesManager::get_dialog_message_count(DialogId dialog_id,
   return -1;
 }
 
+// after a history page is served, the next pages in both scroll directions are preloaded in the
+// background once fewer than ~MAX_GET_HISTORY * 3 / 10 messages remain beyond the served range, so
+// consecutive getChatHistory requests are answered from the in-memory message tree and the database
+// read happens behind render time instead of in front of it
 void MessagesManager::preload_newer_messages(const Dialog *d, MessageId max_message_id) {
   if (td_->auth_manager_->is_bot()) {
     return;
@@ -15381,7 +15416,8 @@ unique_ptr<MessagesManager::Message> MessagesManager::parse_message(DialogId dia
 
 void MessagesManager::on_get_history_from_database(DialogId dialog_id, MessageId from_message_id, int32 offset,
                                                    int32 limit, bool from_the_end, bool only_local,
-                                                   vector<BufferSlice> &&messages, Promise<Unit> &&promise) {
+                                                   vector<MessagesDbDialogMessage> &&messages,
+                                                   Promise<Unit> &&promise) {
   CHECK(-limit < offset && offset <= 0);
   CHECK(offset < 0 || from_the_end);
 
@@ -15426,52 +15462,55 @@ void MessagesManager::on_get_history_from_database(DialogId dialog_id, MessageId
     if (!d->first_database_message_id.is_valid() && !d->have_full_history) {
       break;
     }
-    auto message = parse_message(dialog_id, std::move(message_slice));
-    if (message == nullptr) {
-      if (d->have_full_history) {
-        d->have_full_history = false;
-        on_dialog_updated(dialog_id, "drop have_full_history in on_get_history_from_database");
-      }
-      break;
-    }
-    if (message->message_id.get() >= debug_cur_message_id.get()) {
+    auto message_id = message_slice.message_id;
+    if (message_id.get() >= debug_cur_message_id.get()) {
       // TODO move to ERROR
-      LOG(FATAL) << "Receive message " << message->message_id << " after " << debug_cur_message_id
+      LOG(FATAL) << "Receive message " << message_id << " after " << debug_cur_message_id
                  << " from database in the history of " << dialog_id << " from " << from_message_id << " with offset "
                  << offset << ", limit " << limit << ", from_the_end = " << from_the_end;
       break;
     }
-    debug_cur_message_id = message->message_id;
+    debug_cur_message_id = message_id;
 
-    if (message->message_id.get() < d->first_database_message_id.get()) {
+    if (message_id.get() < d->first_database_message_id.get()) {
       if (d->have_full_history) {
-        LOG(ERROR) << "Have full history in the " << dialog_id << " and receive " << message->message_id
+        LOG(ERROR) << "Have full history in the " << dialog_id << " and receive " << message_id
                    << " from database, but first database message is " << d->first_database_message_id;
       } else {
         break;
       }
     }
-    if (!have_next &&
-        (from_the_end || (is_first && offset < -1 && message->message_id.get() <= from_message_id.get())) &&
-        message->message_id.get() < d->last_message_id.get()) {
+    if (!have_next && (from_the_end || (is_first && offset < -1 && message_id.get() <= from_message_id.get())) &&
+        message_id.get() < d->last_message_id.get()) {
       // last message in the dialog must be attached to the next local message
       have_next = true;
     }
 
-    message->have_previous = false;
-    message->have_next = have_next;
-    message->from_database = true;
+    auto old_message = get_message(d, message_id);
+    Message *m = old_message;
+    if (m == nullptr) {
+      // data in the database is always outdated, so only messages missing from
+      // the memory need to be deserialized
+      auto message = parse_message(dialog_id, std::move(message_slice.data));
+      if (message == nullptr || message->message_id != message_id) {
+        if (d->have_full_history) {
+          d->have_full_history = false;
+          on_dialog_updated(dialog_id, "drop have_full_history in on_get_history_from_database");
+        }
+        break;
+      }
 
-    auto old_message = get_message(d, message->message_id);
-    if (old_message == nullptr) {
       auto web_page_id = get_message_content_web_page_id(message->content.get());
       if (web_page_id.is_valid()) {
         td_->web_pages_manager_->have_web_page_force(web_page_id);
       }
+
+      message->have_previous = false;
+      message->have_next = have_next;
+      message->from_database = true;
+      m = add_message_to_dialog(d, std::move(message), false, &need_update, &need_update_dialog_pos,
+                                "on_get_history_from_database");
     }
-    Message *m = old_message ? old_message
-                             : add_message_to_dialog(d, std::move(message), false, &need_update,
-                                                     &need_update_dialog_pos, "on_get_history_from_database");
     if (m != nullptr) {
       if (!have_next) {
         last_added_message_id = m->message_id;
@@ -15575,7 +15614,7 @@ void MessagesManager::get_history_from_the_end(DialogId dialog_id, bool from_dat
     db_query.limit = limit;
     G()->td_db()->get_messages_db_async()->get_messages(
         db_query, PromiseCreator::lambda([dialog_id, only_local, limit, actor_id = actor_id(this),
-                                          promise = std::move(promise)](std::vector<BufferSlice> messages) mutable {
+                                          promise = std::move(promise)](std::vector<MessagesDbDialogMessage> messages) mutable {
           send_closure(actor_id, &MessagesManager::on_get_history_from_database, dialog_id, MessageId::max(), 0, limit,
                        true, only_local, std::move(messages), std::move(promise));
         }));
@@ -15611,7 +15650,7 @@ void MessagesManager::get_history(DialogId dialog_id, MessageId from_message_id,
     G()->td_db()->get_messages_db_async()->get_messages(
         db_query,
         PromiseCreator::lambda([dialog_id, from_message_id, offset, limit, only_local, actor_id = actor_id(this),
-                                promise = std::move(promise)](std::vector<BufferSlice> messages) mutable {
+                                promise = std::move(promise)](std::vector<MessagesDbDialogMessage> messages) mutable {
           send_closure(actor_id, &MessagesManager::on_get_history_from_database, dialog_id, from_message_id, offset,
                        limit, false, only_local, std::move(messages), std::move(promise));
         }));
@@ -16273,7 +16312,16 @@ void MessagesManager::add_dialog_dependencies(Dependencies &dependencies, Dialog
   }
 }
 
+// dependencies are collected over a whole page of messages and resolved here in one pass,
+// so a page with many unresident users and chats costs one batch of local point reads
+// instead of a round trip per message; entities missing from the database are only logged
+// and will be repaired by subsequent updates from the server
 void MessagesManager::resolve_dependencies_force(const Dependencies &dependencies) {
+  if (G()->parameters().use_chat_info_db) {
+    // the lookups below are point reads from the database; do them in one transaction
+    // instead of an implicit transaction per read
+    G()->td_db()->get_sqlite_sync_pmc()->begin_transaction().ensure();
+  }
   for (auto user_id : dependencies.user_ids) {
     if (user_id.is_valid() && !td_->contacts_manager_->have_user_force(user_id)) {
       LOG(ERROR) << "Can't find " << user_id;
@@ -16305,6 +16353,9 @@ void MessagesManager::resolve_dependencies_force(const Dependencies &dependencie
       td_->web_pages_manager_->have_web_page_force(web_page_id);
     }
   }
+  if (G()->parameters().use_chat_info_db) {
+    G()->td_db()->get_sqlite_sync_pmc()->commit_transaction().ensure();
+  }
 }
 
 class MessagesManager::SendMessageLogEvent {
@@ -19549,8 +19600,7 @@ vector<Notification> MessagesManager::get_message_notifications_from_database_fo
                         << " messages with notifications from database in " << group_info.group_id << '/'
                         << d->dialog_id;
     for (auto &message : messages) {
-      auto m = on_get_message_from_database(d->dialog_id, d, std::move(message),
-                                            "get_message_notifications_from_database_force");
+      auto m = on_get_message_from_database(d->dialog_id, d, message, "get_message_notifications_from_database_force");
       if (m == nullptr) {
         VLOG(notifications) << "Receive from database a broken message";
         continue;
@@ -19632,7 +19682,7 @@ vector<Notification> MessagesManager::get_message_notifications_from_database_fo
   return res;
 }
 
-Result<vector<BufferSlice>> MessagesManager::do_get_message_notifications_from_database_force(
+Result<vector<MessagesDbDialogMessage>> MessagesManager::do_get_message_notifications_from_database_force(
     Dialog *d, bool from_mentions, NotificationId from_notification_id, MessageId from_message_id, int32 limit) {
   CHECK(G()->parameters().use_message_db);
 
@@ -19747,7 +19797,7 @@ void MessagesManager::do_get_message_notifications_from_database(Dialog *d, bool
   auto dialog_id = d->dialog_id;
   auto new_promise =
       PromiseCreator::lambda([actor_id = actor_id(this), dialog_id, from_mentions, initial_from_notification_id, limit,
-                              promise = std::move(promise)](Result<vector<BufferSlice>> result) mutable {
+                              promise = std::move(promise)](Result<vector<MessagesDbDialogMessage>> result) mutable {
         send_closure(actor_id, &MessagesManager::on_get_message_notifications_from_database, dialog_id, from_mentions,
                      initial_from_notification_id, limit, std::move(result), std::move(promise));
       });
@@ -19774,7 +19824,8 @@ void MessagesManager::do_get_message_notifications_from_database(Dialog *d, bool
 
 void MessagesManager::on_get_message_notifications_from_database(DialogId dialog_id, bool from_mentions,
                                                                  NotificationId initial_from_notification_id,
-                                                                 int32 limit, Result<vector<BufferSlice>> result,
+                                                                 int32 limit,
+                                                                 Result<vector<MessagesDbDialogMessage>> result,
                                                                  Promise<vector<Notification>> promise) {
   if (result.is_error()) {
     return promise.set_error(result.move_as_error());
@@ -19796,8 +19847,7 @@ void MessagesManager::on_get_message_notifications_from_database(DialogId dialog
   VLOG(notifications) << "Loaded " << messages.size() << " messages with notifications in " << group_info.group_id
                       << '/' << dialog_id << " from database";
   for (auto &message : messages) {
-    auto m =
-        on_get_message_from_database(dialog_id, d, std::move(message), "on_get_message_notifications_from_database");
+    auto m = on_get_message_from_database(dialog_id, d, message, "on_get_message_notifications_from_database");
     if (m == nullptr) {
       VLOG(notifications) << "Receive from database a broken message";
       continue;
@@ -19918,7 +19968,8 @@ void MessagesManager::remove_message_notification(DialogId dialog_id, Notificati
     G()->td_db()->get_messages_db_async()->get_messages_from_notification_id(
         dialog_id, NotificationId(notification_id.get() + 1), 1,
         PromiseCreator::lambda(
-            [dialog_id, from_mentions, notification_id, actor_id = actor_id(this)](vector<BufferSlice> result) {
+            [dialog_id, from_mentions, notification_id,
+             actor_id = actor_id(this)](vector<MessagesDbDialogMessage> result) {
               send_closure(actor_id, &MessagesManager::do_remove_message_notification, dialog_id, from_mentions,
                            notification_id, std::move(result));
             }));
@@ -19964,7 +20015,8 @@ void MessagesManager::remove_message_notifications_by_message_ids(DialogId dialo
 }
 
 void MessagesManager::do_remove_message_notification(DialogId dialog_id, bool from_mentions,
-                                                     NotificationId notification_id, vector<BufferSlice> result) {
+                                                     NotificationId notification_id,
+                                                     vector<MessagesDbDialogMessage> result) {
   if (result.empty()) {
     return;
   }
@@ -19973,7 +20025,7 @@ void MessagesManager::do_remove_message_notification(DialogId dialog_id, bool fr
   Dialog *d = get_dialog(dialog_id);
   CHECK(d != nullptr);
 
-  auto m = on_get_message_from_database(dialog_id, d, std::move(result[0]), "do_remove_message_notification");
+  auto m = on_get_message_from_database(dialog_id, d, result[0], "do_remove_message_notification");
   if (m != nullptr && m->notification_id == notification_id &&
       is_from_mention_notification_group(d, m) == from_mentions && is_message_notification_active(d, m)) {
     remove_message_notification_id(d, m, false, false);
@@ -23117,6 +23169,31 @@ MessagesManager::Message *MessagesManager::get_message_force(Dialog *d, MessageI
   return on_get_message_from_database(d->dialog_id, d, r_value.ok(), source);
 }
 
+MessagesManager::Message *MessagesManager::on_get_message_from_database(DialogId dialog_id, Dialog *d,
+                                                                        const MessagesDbDialogMessage &message,
+                                                                        const char *source) {
+  if (d != nullptr && have_input_peer(d->dialog_id, AccessRights::Read)) {
+    auto old_message = get_message(d, message.message_id);
+    if (old_message != nullptr) {
+      // data in the database is always outdated, so the message from the memory
+      // can be returned without parsing the data at all
+      if (dialog_id.get_type() == DialogType::SecretChat) {
+        // just in case restore random_id to message_id corespondence
+        // can be needed if there was newer unloaded message with the same random_id
+        add_random_id_to_message_id_correspondence(d, old_message->random_id, old_message->message_id);
+      }
+
+      if (old_message->notification_id.is_valid()) {
+        add_notification_id_to_message_id_correspondence(d, old_message->notification_id, old_message->message_id);
+      }
+
+      return old_message;
+    }
+  }
+
+  return on_get_message_from_database(dialog_id, d, message.data, source);
+}
+
 MessagesManager::Message *MessagesManager::on_get_message_from_database(DialogId dialog_id, Dialog *d,
                                                                         const BufferSlice &value, const char *source) {
   if (value.empty()) {
@@ -23219,6 +23296,9 @@ MessagesManager::Message *MessagesManager::add_message_to_dialog(Dialog *d, uniq
   CHECK(need_update != nullptr);
   CHECK(need_update_dialog_pos != nullptr);
   CHECK(source != nullptr);
+  static auto add_message_counter = NamedThreadSafeCounter::get_default().get_counter("messages_manager_added_messages");
+  add_message_counter.add(1);
+
   debug_add_message_to_dialog_fail_reason_ = "success";
 
   auto debug_have_previous = message->have_previous;
@@ -24825,7 +24905,7 @@ MessagesManager::Dialog *MessagesManager::add_dialog(DialogId dialog_id) {
     auto r_value = G()->td_db()->get_dialog_db_sync()->get_dialog(dialog_id);
     if (r_value.is_ok()) {
       LOG(INFO) << "Synchronously loaded " << dialog_id << " from database";
-      return add_new_dialog(parse_dialog(dialog_id, r_value.ok()), true);
+      return add_new_dialog(parse_dialog(dialog_id, r_value.ok(), BufferSlice()), true);
     }
   }
 
@@ -25414,7 +25494,8 @@ bool MessagesManager::set_dialog_order(Dialog *d, int64 new_order, bool need_sen
   }
 
   if (old_date == new_date) {
-    if (new_order == DEFAULT_ORDER && ordered_dialogs_set->count(old_date) == 0) {
+    if (new_order == DEFAULT_ORDER) {
+      // the insert is a no-op if the date is already there, so a separate count is not needed
       ordered_dialogs_set->insert(new_date);
     }
     LOG(INFO) << "Dialog order is not changed: " << new_order << " from " << source;
@@ -25437,11 +25518,13 @@ bool MessagesManager::set_dialog_order(Dialog *d, int64 new_order, bool need_sen
 
   int64 updated_to = 0;
   if (new_date <= last_dialog_date_) {
-    ordered_dialogs_.insert(new_date);
+    // a new message moves the chat to the top of the list, so the hint is almost always
+    // exact and saves a tree descent on an operation performed for every incoming message
+    ordered_dialogs_.insert(ordered_dialogs_.begin(), new_date);
     need_update = true;
     updated_to = new_order;
   }
-  ordered_dialogs_set->insert(new_date);
+  ordered_dialogs_set->insert(ordered_dialogs_set->begin(), new_date);
 
   bool add_to_hints = (d->order == DEFAULT_ORDER);
   bool was_sponsored = (d->order == SPONSORED_DIALOG_ORDER);
@@ -25535,7 +25618,9 @@ void MessagesManager::update_last_dialog_date() {
       auto dialog_id = it->get_dialog_id();
       auto d = get_dialog(dialog_id);
       CHECK(d != nullptr);
-      ordered_dialogs_.insert(DialogDate(d->order, d->dialog_id));
+      // the dates are visited in ascending order past the old last date, so
+      // every insert appends at the end
+      ordered_dialogs_.insert(ordered_dialogs_.end(), DialogDate(d->order, d->dialog_id));
       send_closure(G()->td(), &Td::send_update, make_tl_object<td_api::updateChatOrder>(d->dialog_id.get(), d->order));
     }
 
@@ -25555,6 +25640,9 @@ void MessagesManager::update_last_dialog_date() {
 }
 
 uint64 MessagesManager::get_sequence_dispatcher_id(DialogId dialog_id, MessageContentType message_content_type) {
+  // the dispatcher id is the conflict scope of the query: only queries with the same id are serialized.
+  // Each dialog has two independent chains, one for messages with files and one for all other queries,
+  // so a slow media send doesn't block text messages and service queries of the dialog
   switch (message_content_type) {
     case MessageContentType::Animation:
     case MessageContentType::Audio:
@@ -25598,7 +25686,7 @@ MessagesManager::Dialog *MessagesManager::get_dialog_force(DialogId dialog_id) {
   auto r_value = G()->td_db()->get_dialog_db_sync()->get_dialog(dialog_id);
   if (r_value.is_ok()) {
     LOG(INFO) << "Loaded " << dialog_id << " from database";
-    auto d = on_load_dialog_from_database(dialog_id, r_value.move_as_ok());
+    auto d = on_load_dialog_from_database(dialog_id, r_value.move_as_ok(), BufferSlice());
     LOG_CHECK(d == nullptr || d->dialog_id == dialog_id) << d->dialog_id << " " << dialog_id;
     return d;
   } else {
@@ -25607,7 +25695,8 @@ MessagesManager::Dialog *MessagesManager::get_dialog_force(DialogId dialog_id) {
   }
 }
 
-unique_ptr<MessagesManager::Dialog> MessagesManager::parse_dialog(DialogId dialog_id, const BufferSlice &value) {
+unique_ptr<MessagesManager::Dialog> MessagesManager::parse_dialog(DialogId dialog_id, const BufferSlice &value,
+                                                                  const BufferSlice &last_database_message) {
   LOG(INFO) << "Loaded " << dialog_id << " of size " << value.size() << " from database";
   auto d = make_unique<Dialog>();
   std::fill(d->message_count_by_index.begin(), d->message_count_by_index.end(), -1);
@@ -25640,6 +25729,15 @@ unique_ptr<MessagesManager::Dialog> MessagesManager::parse_dialog(DialogId dialo
   }
   CHECK(dialog_id == d->dialog_id);
 
+  if (d->messages == nullptr && d->last_database_message_id.is_valid() && !last_database_message.empty()) {
+    // the last message wasn't in memory when the dialog was saved, but it was
+    // fetched from the message database together with the dialog
+    auto m = parse_message(dialog_id, last_database_message);
+    if (m != nullptr && m->message_id == d->last_database_message_id) {
+      d->messages = std::move(m);
+    }
+  }
+
   Dependencies dependencies;
   add_dialog_dependencies(dependencies, dialog_id);
   if (d->messages != nullptr) {
@@ -25653,7 +25751,8 @@ unique_ptr<MessagesManager::Dialog> MessagesManager::parse_dialog(DialogId dialo
   return d;
 }
 
-MessagesManager::Dialog *MessagesManager::on_load_dialog_from_database(DialogId dialog_id, const BufferSlice &value) {
+MessagesManager::Dialog *MessagesManager::on_load_dialog_from_database(DialogId dialog_id, const BufferSlice &value,
+                                                                       const BufferSlice &last_database_message) {
   CHECK(G()->parameters().use_message_db);
 
   if (!dialog_id.is_valid()) {
@@ -25674,7 +25773,7 @@ MessagesManager::Dialog *MessagesManager::on_load_dialog_from_database(DialogId
     return old_d;
   }
 
-  return add_new_dialog(parse_dialog(dialog_id, value), true);
+  return add_new_dialog(parse_dialog(dialog_id, value, last_database_message), true);
 }
 
 void MessagesManager::load_notification_settings() {
@@ -27358,6 +27457,33 @@ td_api::object_ptr<td_api::updateUnreadChatCount> MessagesManager::get_update_un
                                                             unread_unmuted_marked_count);
 }
 
+void MessagesManager::get_memory_stats(MemoryStats &stats) const {
+  uint64 message_count = 0;
+  vector<const Message *> to_count;
+  for (auto &it : dialogs_) {
+    if (it.second->messages != nullptr) {
+      to_count.push_back(it.second->messages.get());
+    }
+  }
+  while (!to_count.empty()) {
+    auto *m = to_count.back();
+    to_count.pop_back();
+    message_count++;
+    if (m->left != nullptr) {
+      to_count.push_back(m->left.get());
+    }
+    if (m->right != nullptr) {
+      to_count.push_back(m->right.get());
+    }
+  }
+  stats.add_entry("MessagesManager", "messages", message_count, message_count * sizeof(Message));
+  stats.add_entry("MessagesManager", "dialogs_", dialogs_.size(), dialogs_.size() * sizeof(Dialog));
+  stats.add("MessagesManager", "message_id_to_dialog_id_", message_id_to_dialog_id_);
+  stats.add("MessagesManager", "message_random_ids_", message_random_ids_);
+  stats.add("MessagesManager", "being_sent_messages_", being_sent_messages_);
+  stats.add("MessagesManager", "found_public_dialogs_", found_public_dialogs_);
+}
+
 void MessagesManager::get_current_state(vector<td_api::object_ptr<td_api::Update>> &updates) const {
   if (!td_->auth_manager_->is_bot()) {
     if (G()->parameters().use_message_db) {
@@ -14,6 +14,7 @@
 #include "td/telegram/ChannelId.h"
 #include "td/telegram/Dependencies.h"
 #include "td/telegram/DialogDate.h"
+#include "td/telegram/DialogDb.h"
 #include "td/telegram/DialogId.h"
 #include "td/telegram/DialogParticipant.h"
 #include "td/telegram/files/FileId.h"
@@ -44,6 +45,7 @@
 #include "td/utils/buffer.h"
 #include "td/utils/ChangesProcessor.h"
 #include "td/utils/common.h"
+#include "td/utils/HashMap.h"
 #include "td/utils/Heap.h"
 #include "td/utils/Hints.h"
 #include "td/utils/logging.h"
@@ -65,6 +67,8 @@ namespace td {
 
 struct BinlogEvent;
 
+class MemoryStats;
+
 class Td;
 
 class MultiSequenceDispatcher;
@@ -766,6 +770,8 @@ class MessagesManager : public Actor {
 
   void get_current_state(vector<td_api::object_ptr<td_api::Update>> &updates) const;
 
+  void get_memory_stats(MemoryStats &stats) const;
+
   static void add_dialog_dependencies(Dependencies &dependencies, DialogId dialog_id);
 
   void resolve_dependencies_force(const Dependencies &dependencies);
@@ -850,7 +856,10 @@ class MessagesManager : public Actor {
 
   // Do not forget to update MessagesManager::update_message when this class is changed
   struct Message {
+    // fields are ordered to avoid alignment padding: with millions of cached
+    // messages every wasted word is megabytes of RSS
     int32 random_y;
+    mutable int32 last_access_date = 0;
 
     MessageId message_id;
     UserId sender_user_id;
@@ -866,6 +875,7 @@ class MessagesManager : public Actor {
     int64 reply_to_random_id = 0;  // for send_message
 
     UserId via_bot_user_id;
+    int32 legacy_layer = 0;
 
     string author_signature;
 
@@ -898,13 +908,11 @@ class MessagesManager : public Actor {
     NotificationId removed_notification_id;
 
     int32 views = 0;
-    int32 legacy_layer = 0;
 
+    int32 ttl = 0;
     int32 send_error_code = 0;
     string send_error_message;
     double try_resend_at = 0;
-
-    int32 ttl = 0;
     double ttl_expires_at = 0;
 
     int64 media_album_id = 0;
@@ -921,8 +929,6 @@ class MessagesManager : public Actor {
     unique_ptr<Message> left;
     unique_ptr<Message> right;
 
-    mutable int32 last_access_date = 0;
-
     mutable uint64 send_message_logevent_id = 0;
 
     mutable NetQueryRef send_query_ref;
@@ -1310,7 +1316,7 @@ class MessagesManager : public Actor {
   static constexpr int32 MAX_MESSAGE_VIEW_DELAY = 1;  // seconds
   static constexpr int32 MIN_SAVE_DRAFT_DELAY = 1;    // seconds
   static constexpr int32 MIN_READ_HISTORY_DELAY = 3;  // seconds
-  static constexpr int32 MAX_SAVE_DIALOG_DELAY = 0;   // seconds
+  static constexpr int32 MAX_SAVE_DIALOG_DELAY = 2;   // seconds, coalesces dialog saves during typing bursts
 
   static constexpr int32 USERNAME_CACHE_EXPIRE_TIME = 3 * 86400;
   static constexpr int32 USERNAME_CACHE_EXPIRE_TIME_SHORT = 900;
@@ -1555,7 +1561,7 @@ class MessagesManager : public Actor {
   void preload_older_messages(const Dialog *d, MessageId min_message_id);
 
   void on_get_history_from_database(DialogId dialog_id, MessageId from_message_id, int32 offset, int32 limit,
-                                    bool from_the_end, bool only_local, vector<BufferSlice> &&messages,
+                                    bool from_the_end, bool only_local, vector<MessagesDbDialogMessage> &&messages,
                                     Promise<Unit> &&promise);
 
   void get_history_from_the_end(DialogId dialog_id, bool from_database, bool only_local, Promise<Unit> &&promise);
@@ -1672,9 +1678,8 @@ class MessagesManager : public Actor {
 
   vector<Notification> get_message_notifications_from_database_force(Dialog *d, bool from_mentions, int32 limit);
 
-  Result<vector<BufferSlice>> do_get_message_notifications_from_database_force(Dialog *d, bool from_mentions,
-                                                                               NotificationId from_notification_id,
-                                                                               MessageId from_message_id, int32 limit);
+  Result<vector<MessagesDbDialogMessage>> do_get_message_notifications_from_database_force(
+      Dialog *d, bool from_mentions, NotificationId from_notification_id, MessageId from_message_id, int32 limit);
 
   void do_get_message_notifications_from_database(Dialog *d, bool from_mentions,
                                                   NotificationId initial_from_notification_id,
@@ -1683,11 +1688,11 @@ class MessagesManager : public Actor {
 
   void on_get_message_notifications_from_database(DialogId dialog_id, bool from_mentions,
                                                   NotificationId initial_from_notification_id, int32 limit,
-                                                  Result<vector<BufferSlice>> result,
+                                                  Result<vector<MessagesDbDialogMessage>> result,
                                                   Promise<vector<Notification>> promise);
 
   void do_remove_message_notification(DialogId dialog_id, bool from_mentions, NotificationId notification_id,
-                                      vector<BufferSlice> result);
+                                      vector<MessagesDbDialogMessage> result);
 
   int32 get_dialog_pending_notification_count(const Dialog *d, bool from_mentions) const;
 
@@ -1864,9 +1869,10 @@ class MessagesManager : public Actor {
 
   Dialog *get_dialog_force(DialogId dialog_id);
 
-  Dialog *on_load_dialog_from_database(DialogId dialog_id, const BufferSlice &value);
+  Dialog *on_load_dialog_from_database(DialogId dialog_id, const BufferSlice &value,
+                                       const BufferSlice &last_database_message);
 
-  void on_get_dialogs_from_database(int32 limit, vector<BufferSlice> &&dialogs, Promise<Unit> &&promise);
+  void on_get_dialogs_from_database(int32 limit, vector<DialogDbDialog> &&dialogs, Promise<Unit> &&promise);
 
   void send_get_dialog_query(DialogId dialog_id, Promise<Unit> &&promise, uint64 logevent_id = 0);
 
@@ -1903,6 +1909,9 @@ class MessagesManager : public Actor {
 
   Message *on_get_message_from_database(DialogId dialog_id, Dialog *d, const BufferSlice &value, const char *source);
 
+  Message *on_get_message_from_database(DialogId dialog_id, Dialog *d, const MessagesDbDialogMessage &message,
+                                        const char *source);
+
   void get_dialog_message_by_date_from_server(const Dialog *d, int32 date, int64 random_id, bool after_database_search,
                                               Promise<Unit> &&promise);
 
@@ -1971,7 +1980,8 @@ class MessagesManager : public Actor {
 
   void on_search_dialog_messages_db_result(int64 random_id, DialogId dialog_id, MessageId from_message_id,
                                            MessageId first_db_message_id, SearchMessagesFilter filter_type,
-                                           int32 offset, int32 limit, Result<std::vector<BufferSlice>> r_messages,
+                                           int32 offset, int32 limit,
+                                           Result<std::vector<MessagesDbDialogMessage>> r_messages,
                                            Promise<> promise);
 
   void on_messages_db_fts_result(Result<MessagesDbFtsResult> result, int64 random_id, Promise<> &&promise);
@@ -2142,7 +2152,8 @@ class MessagesManager : public Actor {
 
   unique_ptr<Message> parse_message(DialogId dialog_id, const BufferSlice &value);
 
-  unique_ptr<Dialog> parse_dialog(DialogId dialog_id, const BufferSlice &value);
+  unique_ptr<Dialog> parse_dialog(DialogId dialog_id, const BufferSlice &value,
+                                  const BufferSlice &last_database_message);
 
   void load_calls_db_state();
   void save_calls_db_state();
@@ -2288,15 +2299,15 @@ class MessagesManager : public Actor {
   };
   std::unordered_map<int64, PendingMessageGroupSend> pending_message_group_sends_;  // media_album_id -> ...
 
-  std::unordered_map<MessageId, DialogId, MessageIdHash> message_id_to_dialog_id_;
-  std::unordered_map<MessageId, DialogId, MessageIdHash> last_clear_history_message_id_to_dialog_id_;
+  HashMap<MessageId, DialogId, MessageIdHash> message_id_to_dialog_id_;
+  HashMap<MessageId, DialogId, MessageIdHash> last_clear_history_message_id_to_dialog_id_;
 
   std::unordered_map<int64, DialogId> created_dialogs_;                                // random_id -> dialog_id
   std::unordered_map<DialogId, Promise<Unit>, DialogIdHash> pending_created_dialogs_;  // dialog_id -> promise
 
   bool running_get_difference_ = false;  // true after before_get_difference and false after after_get_difference
 
-  std::unordered_map<DialogId, unique_ptr<Dialog>, DialogIdHash> dialogs_;
+  HashMap<DialogId, unique_ptr<Dialog>, DialogIdHash> dialogs_;
   std::multimap<int32, PendingPtsUpdate> pending_updates_;
   std::multimap<int32, PendingPtsUpdate> postponed_pts_updates_;
 
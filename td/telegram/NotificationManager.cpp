@@ -954,7 +954,14 @@ void NotificationManager::add_update(int32 group_id, td_api::object_ptr<td_api::
   }
   updates.push_back(std::move(update));
   if (!running_get_difference_ && running_get_chat_difference_.count(group_id) == 0) {
-    flush_pending_updates_timeout_.add_timeout_in(group_id, MIN_UPDATE_DELAY_MS * 1e-3);
+    if (updates.size() <= 1 || updates.size() > MAX_UNFLUSHED_UPDATE_COUNT) {
+      flush_pending_updates_timeout_.add_timeout_in(group_id, MIN_UPDATE_DELAY_MS * 1e-3);
+    } else {
+      // the group is receiving a burst of updates; wait for it to quiesce, so that
+      // the whole burst is flushed as one update with the net state. The wait is
+      // bounded: after MAX_UNFLUSHED_UPDATE_COUNT updates the timeout isn't moved anymore
+      flush_pending_updates_timeout_.set_timeout_in(group_id, MIN_UPDATE_DELAY_MS * 1e-3);
+    }
   } else {
     flush_pending_updates_timeout_.set_timeout_in(group_id, MAX_UPDATE_DELAY_MS * 1e-3);
   }
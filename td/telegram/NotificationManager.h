@@ -146,6 +146,7 @@ class NotificationManager : public Actor {
 
   static constexpr int32 MIN_UPDATE_DELAY_MS = 50;
   static constexpr int32 MAX_UPDATE_DELAY_MS = 60000;
+  static constexpr size_t MAX_UNFLUSHED_UPDATE_COUNT = 100;
 
   static constexpr int32 ANNOUNCEMENT_ID_CACHE_TIME = 7 * 86400;
 
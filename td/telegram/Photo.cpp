@@ -20,10 +20,12 @@
 #include "td/utils/HttpUrl.h"
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
+#include "td/utils/port/thread_local.h"
 #include "td/utils/Random.h"
 
 #include <algorithm>
 #include <limits>
+#include <unordered_map>
 
 namespace td {
 
@@ -63,6 +65,7 @@ StringBuilder &operator<<(StringBuilder &string_builder, const Dimensions &dimen
 }
 
 td_api::object_ptr<td_api::minithumbnail> get_minithumbnail_object(const string &packed) {
+  static constexpr size_t MAX_MINITHUMBNAIL_CACHE_SIZE = 1000;
   if (packed.size() < 3) {
     return nullptr;
   }
@@ -88,8 +91,22 @@ td_api::object_ptr<td_api::minithumbnail> get_minithumbnail_object(const string
     auto result = td_api::make_object<td_api::minithumbnail>();
     result->width_ = static_cast<unsigned char>(packed[1]);
     result->height_ = static_cast<unsigned char>(packed[2]);
-    result->data_ = PSTRING() << header.substr(0, 164) << packed[1] << header[165] << packed[2] << header.substr(167)
-                              << packed.substr(3) << footer;
+
+    // the expansion is deterministic, so it is memoized by the packed bytes; hot chat scrollback
+    // creates the same minithumbnails over and over again. Unlike photoSize, which embeds live
+    // file state and therefore can't be cached, the result depends on nothing else
+    static TD_THREAD_LOCAL std::unordered_map<string, string> *cache;  // static zero-initialized
+    init_thread_local<std::unordered_map<string, string>>(cache);
+    auto it = cache->find(packed);
+    if (it == cache->end()) {
+      if (cache->size() >= MAX_MINITHUMBNAIL_CACHE_SIZE) {
+        cache->clear();
+      }
+      auto data = PSTRING() << header.substr(0, 164) << packed[1] << header[165] << packed[2] << header.substr(167)
+                            << packed.substr(3) << footer;
+      it = cache->emplace(packed, std::move(data)).first;
+    }
+    result->data_ = it->second;
     return result;
   }
   return nullptr;
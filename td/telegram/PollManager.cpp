@@ -185,6 +185,9 @@ class StopPollActor : public NetActorOnce {
 PollManager::PollManager(Td *td, ActorShared<> parent) : td_(td), parent_(std::move(parent)) {
   update_poll_timeout_.set_callback(on_update_poll_timeout_callback);
   update_poll_timeout_.set_callback_data(static_cast<void *>(this));
+
+  notify_poll_timeout_.set_callback(on_notify_poll_timeout_callback);
+  notify_poll_timeout_.set_callback_data(static_cast<void *>(this));
 }
 
 void PollManager::start_up() {
@@ -220,6 +223,15 @@ void PollManager::on_update_poll_timeout_callback(void *poll_manager_ptr, int64
   send_closure_later(poll_manager->actor_id(poll_manager), &PollManager::on_update_poll_timeout, PollId(poll_id_int));
 }
 
+void PollManager::on_notify_poll_timeout_callback(void *poll_manager_ptr, int64 poll_id_int) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  auto poll_manager = static_cast<PollManager *>(poll_manager_ptr);
+  send_closure_later(poll_manager->actor_id(poll_manager), &PollManager::on_notify_poll_timeout, PollId(poll_id_int));
+}
+
 bool PollManager::is_local_poll_id(PollId poll_id) {
   return poll_id.get() < 0 && poll_id.get() > std::numeric_limits<int32>::min();
 }
@@ -257,6 +269,23 @@ void PollManager::notify_on_poll_update(PollId poll_id) {
   }
 }
 
+void PollManager::schedule_poll_update_notification(PollId poll_id) {
+  // votes in popular polls arrive in bursts of result updates, and every
+  // notification re-serializes the content of all messages with the poll,
+  // so changes made within a short window are announced once with net totals
+  if (!notify_poll_timeout_.has_timeout(poll_id.get())) {
+    notify_poll_timeout_.set_timeout_in(poll_id.get(), POLL_UPDATE_NOTIFICATION_WINDOW);
+  }
+}
+
+void PollManager::on_notify_poll_timeout(PollId poll_id) {
+  if (G()->close_flag()) {
+    return;
+  }
+
+  notify_on_poll_update(poll_id);
+}
+
 string PollManager::get_poll_database_key(PollId poll_id) {
   return PSTRING() << "poll" << poll_id.get();
 }
@@ -984,7 +1013,7 @@ PollId PollManager::on_get_poll(PollId poll_id, tl_object_ptr<telegram_api::poll
     update_poll_timeout_.set_timeout_in(poll_id.get(), timeout);
   }
   if (is_changed) {
-    notify_on_poll_update(poll_id);
+    schedule_poll_update_notification(poll_id);
     save_poll(poll, poll_id);
   }
   if (need_update_poll && (is_changed || (poll->is_closed && being_closed_polls_.erase(poll_id) != 0))) {
@@ -109,6 +109,8 @@ class PollManager : public Actor {
 
   static void on_update_poll_timeout_callback(void *poll_manager_ptr, int64 poll_id_int);
 
+  static void on_notify_poll_timeout_callback(void *poll_manager_ptr, int64 poll_id_int);
+
   static td_api::object_ptr<td_api::pollOption> get_poll_option_object(const PollOption &poll_option);
 
   static telegram_api::object_ptr<telegram_api::pollAnswer> get_input_poll_option(const PollOption &poll_option);
@@ -125,6 +127,10 @@ class PollManager : public Actor {
 
   void notify_on_poll_update(PollId poll_id);
 
+  void schedule_poll_update_notification(PollId poll_id);
+
+  void on_notify_poll_timeout(PollId poll_id);
+
   static string get_poll_database_key(PollId poll_id);
 
   void save_poll(const Poll *poll, PollId poll_id);
@@ -151,7 +157,10 @@ class PollManager : public Actor {
   void do_stop_poll(PollId poll_id, FullMessageId full_message_id, unique_ptr<ReplyMarkup> &&reply_markup,
                     uint64 logevent_id, Promise<Unit> &&promise);
 
+  static constexpr double POLL_UPDATE_NOTIFICATION_WINDOW = 0.1;  // will be merged with updates received within it
+
   MultiTimeout update_poll_timeout_{"UpdatePollTimeout"};
+  MultiTimeout notify_poll_timeout_{"NotifyPollTimeout"};
 
   Td *td_;
   ActorShared<> parent_;
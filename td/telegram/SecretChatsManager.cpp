@@ -496,8 +496,19 @@ ActorId<SecretChatActor> SecretChatsManager::create_chat_actor_impl(int32 id, bo
   auto it_flag = id_to_actor_.emplace(id, ActorOwn<SecretChatActor>());
   if (it_flag.second) {
     LOG(INFO) << "Create SecretChatActor: " << tag("id", id);
-    it_flag.first->second =
-        create_actor<SecretChatActor>(PSLICE() << "SecretChat " << id, id, make_secret_chat_context(id), can_be_empty);
+    // AES-IGE and key derivation run inside the actor, and the actor already
+    // serializes everything per chat, so spreading the actors round-robin over
+    // the other schedulers lets independent secret chats do crypto in parallel
+    // instead of all sharing this scheduler
+    auto current_scheduler_id = Scheduler::instance()->sched_id();
+    auto scheduler_count = Scheduler::instance()->sched_count();
+    auto scheduler_id = current_scheduler_id;
+    if (scheduler_count > current_scheduler_id + 1) {
+      auto positive_id = id < 0 ? -id : id;
+      scheduler_id = current_scheduler_id + 1 + positive_id % (scheduler_count - current_scheduler_id - 1);
+    }
+    it_flag.first->second = create_actor_on_scheduler<SecretChatActor>(
+        PSLICE() << "SecretChat " << id, scheduler_id, id, make_secret_chat_context(id), can_be_empty);
     if (binlog_replay_finish_flag_) {
       send_closure(it_flag.first->second, &SecretChatActor::binlog_replay_finish);
     }
@@ -24,6 +24,7 @@
 #include "td/telegram/Global.h"
 #include "td/telegram/LanguagePackManager.h"
 #include "td/telegram/logevent/LogEvent.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/MessagesManager.h"
 #include "td/telegram/misc.h"
 #include "td/telegram/net/DcId.h"
@@ -5233,15 +5234,32 @@ string StickersManager::remove_emoji_modifiers(string emoji) {
 
 void StickersManager::after_get_difference() {
   if (td_->is_online()) {
-    get_installed_sticker_sets(false, Auto());
-    get_installed_sticker_sets(true, Auto());
-    get_featured_sticker_sets(Auto());
-    get_recent_stickers(false, Auto());
-    get_recent_stickers(true, Auto());
-    get_favorite_stickers(Auto());
+    // the sticker lists are needed only for answering future requests,
+    // so load them after all updates from the difference are processed
+    send_closure_later(actor_id(this), &StickersManager::prefetch_sticker_lists);
   }
 }
 
+void StickersManager::prefetch_sticker_lists() {
+  if (G()->close_flag()) {
+    return;
+  }
+  get_installed_sticker_sets(false, Auto());
+  get_installed_sticker_sets(true, Auto());
+  get_featured_sticker_sets(Auto());
+  get_recent_stickers(false, Auto());
+  get_recent_stickers(true, Auto());
+  get_favorite_stickers(Auto());
+}
+
+void StickersManager::get_memory_stats(MemoryStats &stats) const {
+  stats.add_entry("StickersManager", "stickers_", stickers_.size(), stickers_.size() * sizeof(Sticker));
+  stats.add_entry("StickersManager", "sticker_sets_", sticker_sets_.size(), sticker_sets_.size() * sizeof(StickerSet));
+  stats.add("StickersManager", "short_name_to_sticker_set_id_", short_name_to_sticker_set_id_);
+  stats.add("StickersManager", "found_stickers_", found_stickers_);
+  stats.add("StickersManager", "emoji_language_codes_", emoji_language_codes_);
+}
+
 void StickersManager::get_current_state(vector<td_api::object_ptr<td_api::Update>> &updates) const {
   if (td_->auth_manager_->is_bot()) {
     return;
@@ -32,6 +32,8 @@
 
 namespace td {
 
+class MemoryStats;
+
 class Td;
 
 class StickersManager : public Actor {
@@ -245,6 +247,8 @@ class StickersManager : public Actor {
 
   void get_current_state(vector<td_api::object_ptr<td_api::Update>> &updates) const;
 
+  void get_memory_stats(MemoryStats &stats) const;
+
  private:
   static constexpr int32 MAX_FEATURED_STICKER_SET_VIEW_DELAY = 5;
 
@@ -386,6 +390,8 @@ class StickersManager : public Actor {
 
   int32 get_recent_stickers_hash(const vector<FileId> &sticker_ids) const;
 
+  void prefetch_sticker_lists();
+
   void load_installed_sticker_sets(bool is_masks, Promise<Unit> &&promise);
 
   void load_featured_sticker_sets(Promise<Unit> &&promise);
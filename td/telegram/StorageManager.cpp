@@ -36,14 +36,17 @@ StorageManager::StorageManager(ActorShared<> parent, int32 scheduler_id)
 }
 
 void StorageManager::start_up() {
+  set_priority(ActorPriority::Low);
+
   load_last_gc_timestamp();
   schedule_next_gc();
 
   load_fast_stat();
 }
 
-void StorageManager::on_new_file(int64 size, int32 cnt) {
-  LOG(INFO) << "Add " << cnt << " file of size " << size << " to fast storage statistics";
+void StorageManager::on_new_file(FileType file_type, int64 size, int32 cnt) {
+  LOG(INFO) << "Add " << cnt << " file of type " << file_type << " and size " << size
+            << " to fast storage statistics";
   fast_stat_.cnt += cnt;
   fast_stat_.size += size;
 
@@ -51,6 +54,16 @@ void StorageManager::on_new_file(int64 size, int32 cnt) {
     LOG(ERROR) << "Wrong fast stat after adding size " << size << " and cnt " << cnt;
     fast_stat_ = FileTypeStat();
   }
+
+  auto &stat = fast_stat_by_type_[static_cast<size_t>(file_type)];
+  stat.cnt += cnt;
+  stat.size += size;
+  if (stat.cnt < 0 || stat.size < 0) {
+    LOG(ERROR) << "Wrong fast stat for " << file_type << " after adding size " << size << " and cnt " << cnt;
+    // the counters have drifted, for example, because files were deleted from outside;
+    // invalidate them until the next full scan reseeds them
+    have_fast_stat_by_type_ = false;
+  }
   save_fast_stat();
 }
 
@@ -59,6 +72,23 @@ void StorageManager::get_storage_stats(bool need_all_files, int32 dialog_limit,
     promise.set_error(Status::Error(500, "Request aborted"));
     return;
   }
+  if (!need_all_files && dialog_limit == 0 && have_fast_stat_by_type_) {
+    // the per-type counters are exact between full scans, so type-only statistics
+    // are answered from them without touching the file cache at all
+    FileStats stats;
+    stats.stat_by_type = fast_stat_by_type_;
+    std::vector<Promise<FileStats>> promises;
+    promises.push_back(std::move(promise));
+    return send_stats(std::move(stats), dialog_limit, std::move(promises));
+  }
+  if (!need_all_files && Time::now() - stats_cache_at_ < STATS_CACHE_TTL &&
+      (dialog_limit == 0 || stats_cache_.split_by_owner_dialog_id)) {
+    // stale-but-instant fast path: the cached result of the last scan is
+    // recent enough, so there is no need to walk the whole cache again
+    std::vector<Promise<FileStats>> promises;
+    promises.push_back(std::move(promise));
+    return send_stats(FileStats(stats_cache_), dialog_limit, std::move(promises));
+  }
   if (pending_storage_stats_.size() != 0) {
     if (stats_dialog_limit_ == dialog_limit && need_all_files == stats_need_all_files_) {
       pending_storage_stats_.emplace_back(std::move(promise));
@@ -135,7 +165,21 @@ void StorageManager::on_file_stats(Result<FileStats> r_file_stats, uint32 genera
     return;
   }
 
-  send_stats(r_file_stats.move_as_ok(), stats_dialog_limit_, std::move(pending_storage_stats_));
+  auto stats = r_file_stats.move_as_ok();
+  update_stats_cache(stats);
+  send_stats(std::move(stats), stats_dialog_limit_, std::move(pending_storage_stats_));
+}
+
+void StorageManager::update_stats_cache(const FileStats &stats) {
+  stats_cache_ = FileStats();
+  stats_cache_.split_by_owner_dialog_id = stats.split_by_owner_dialog_id;
+  stats_cache_.stat_by_type = stats.stat_by_type;
+  stats_cache_.stat_by_owner_dialog_id = stats.stat_by_owner_dialog_id;
+  stats_cache_at_ = Time::now();
+
+  // a full scan is the source of truth; reseed the incremental per-type counters from it
+  fast_stat_by_type_ = stats.stat_by_type;
+  have_fast_stat_by_type_ = true;
 }
 
 void StorageManager::create_stats_worker() {
@@ -218,11 +262,19 @@ void StorageManager::on_gc_finished(int32 dialog_limit, Result<FileStats> r_file
     return;
   }
 
-  send_stats(r_file_stats.move_as_ok(), dialog_limit, std::move(pending_run_gc_));
+  auto stats = r_file_stats.move_as_ok();
+  update_stats_cache(stats);
+  send_stats(std::move(stats), dialog_limit, std::move(pending_run_gc_));
 }
 
 void StorageManager::save_fast_stat() {
   G()->td_db()->get_binlog_pmc()->set("fast_file_stat", log_event_store(fast_stat_).as_slice().str());
+  if (have_fast_stat_by_type_) {
+    vector<FileTypeStat> stats(fast_stat_by_type_.begin(), fast_stat_by_type_.end());
+    G()->td_db()->get_binlog_pmc()->set("fast_file_stat_by_type", log_event_store(stats).as_slice().str());
+  } else {
+    G()->td_db()->get_binlog_pmc()->erase("fast_file_stat_by_type");
+  }
 }
 
 void StorageManager::load_fast_stat() {
@@ -230,6 +282,14 @@ void StorageManager::load_fast_stat() {
   if (status.is_error()) {
     fast_stat_ = FileTypeStat();
   }
+  vector<FileTypeStat> stats;
+  status = log_event_parse(stats, G()->td_db()->get_binlog_pmc()->get("fast_file_stat_by_type"));
+  if (status.is_ok() && stats.size() == static_cast<size_t>(file_type_size)) {
+    for (size_t i = 0; i < stats.size(); i++) {
+      fast_stat_by_type_[i] = stats[i];
+    }
+    have_fast_stat_by_type_ = true;
+  }
   LOG(INFO) << "Loaded fast storage statistics with " << fast_stat_.cnt << " files of total size " << fast_stat_.size;
 }
 
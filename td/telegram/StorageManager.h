@@ -38,7 +38,7 @@ class StorageManager : public Actor {
   void run_gc(FileGcParameters parameters, Promise<FileStats> promise);
   void update_use_storage_optimizer();
 
-  void on_new_file(int64 size, int32 cnt);
+  void on_new_file(FileType file_type, int64 size, int32 cnt);
 
  private:
   static constexpr uint32 GC_EACH = 60 * 60 * 24;  // 1 day
@@ -58,11 +58,23 @@ class StorageManager : public Actor {
 
   FileTypeStat fast_stat_;
 
+  // per-type counters maintained incrementally on every file add and delete and reseeded by each
+  // full scan; while they are valid, type-only statistics don't need to walk the file cache
+  FileStats::StatByType fast_stat_by_type_{};
+  bool have_fast_stat_by_type_ = false;
+
+  // result of the last full scan without the heavy all_files list; it is used
+  // to answer repeated queries instantly instead of walking the whole cache
+  static constexpr double STATS_CACHE_TTL = 60;  // 60s
+  FileStats stats_cache_;
+  double stats_cache_at_ = 0;
+
   CancellationTokenSource stats_cancellation_token_source_;
   CancellationTokenSource gc_cancellation_token_source_;
 
   void on_file_stats(Result<FileStats> r_file_stats, uint32 generation);
   void create_stats_worker();
+  void update_stats_cache(const FileStats &stats);
   void send_stats(FileStats &&stats, int32 dialog_limit, std::vector<Promise<FileStats>> promises);
 
   void save_fast_stat();
@@ -38,6 +38,7 @@
 #include "td/telegram/JsonValue.h"
 #include "td/telegram/LanguagePackManager.h"
 #include "td/telegram/Logging.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/MessageEntity.h"
 #include "td/telegram/MessageId.h"
 #include "td/telegram/MessagesManager.h"
@@ -3894,6 +3895,7 @@ void Td::on_authorization_lost() {
 
 void Td::start_up() {
   always_wait_for_mailbox();
+  set_priority(ActorPriority::High);  // requests from the client must not wait for background work
 
   uint64 check_endianness = 0x0706050403020100;
   auto check_endianness_raw = reinterpret_cast<const unsigned char *>(&check_endianness);
@@ -4512,8 +4514,8 @@ void Td::init_file_manager() {
     explicit FileManagerContext(Td *td) : td_(td) {
     }
 
-    void on_new_file(int64 size, int32 cnt) final {
-      send_closure(G()->storage_manager(), &StorageManager::on_new_file, size, cnt);
+    void on_new_file(FileType file_type, int64 size, int32 cnt) final {
+      send_closure(G()->storage_manager(), &StorageManager::on_new_file, file_type, size, cnt);
     }
 
     void on_file_updated(FileId file_id) final {
@@ -5203,6 +5205,11 @@ void Td::on_request(uint64 id, const td_api::getSecretChat &request) {
 }
 
 void Td::on_request(uint64 id, const td_api::getChat &request) {
+  DialogId dialog_id(request.chat_id_);
+  if (messages_manager_->have_dialog(dialog_id)) {
+    // the chat is already loaded in memory and can be returned right away
+    return send_closure(actor_id(this), &Td::send_result, id, messages_manager_->get_chat_object(dialog_id));
+  }
   CREATE_REQUEST(GetChatRequest, request.chat_id_);
 }
 
@@ -5281,15 +5288,30 @@ void Td::on_request(uint64 id, td_api::getStorageStatisticsFast &request) {
   });
   send_closure(storage_manager_, &StorageManager::get_storage_stats_fast, std::move(query_promise));
 }
+void Td::get_memory_stats(MemoryStats &stats) const {
+  messages_manager_->get_memory_stats(stats);
+  contacts_manager_->get_memory_stats(stats);
+  web_pages_manager_->get_memory_stats(stats);
+  stickers_manager_->get_memory_stats(stats);
+  file_manager_->get_memory_stats(stats);
+}
+
 void Td::on_request(uint64 id, td_api::getDatabaseStatistics &request) {
   CREATE_REQUEST_PROMISE();
-  auto query_promise = PromiseCreator::lambda([promise = std::move(promise)](Result<DatabaseStats> result) mutable {
-    if (result.is_error()) {
-      promise.set_error(result.move_as_error());
-    } else {
-      promise.set_value(result.ok().as_td_api());
-    }
-  });
+  // append the in-memory object cache breakdown to the database statistics,
+  // so one request covers both disk and RAM usage of the instance
+  MemoryStats memory_stats;
+  get_memory_stats(memory_stats);
+  auto query_promise = PromiseCreator::lambda(
+      [promise = std::move(promise), memory_stats = memory_stats.as_string()](Result<DatabaseStats> result) mutable {
+        if (result.is_error()) {
+          promise.set_error(result.move_as_error());
+        } else {
+          auto stats = result.ok().as_td_api();
+          stats->statistics_ += memory_stats;
+          promise.set_value(std::move(stats));
+        }
+      });
   send_closure(storage_manager_, &StorageManager::get_database_stats, std::move(query_promise));
 }
 
@@ -6880,6 +6902,9 @@ void Td::on_request(uint64 id, td_api::setOption &request) {
       if (!is_bot && set_boolean_option("disable_contact_registered_notifications")) {
         return;
       }
+      if (!is_bot && set_boolean_option("disable_dialog_list_preload")) {
+        return;
+      }
       if (!is_bot && set_boolean_option("disable_top_chats")) {
         return;
       }
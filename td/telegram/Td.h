@@ -51,6 +51,7 @@ class FileReferenceManager;
 class InlineQueriesManager;
 class HashtagHints;
 class LanguagePackManager;
+class MemoryStats;
 class MessagesManager;
 class NetStatsManager;
 class NotificationManager;
@@ -1072,6 +1073,7 @@ class Td final : public NetQueryCallback {
   void init_connection_creator();
   void init_file_manager();
   void init_managers();
+  void get_memory_stats(MemoryStats &stats) const;
   void clear();
   void close_impl(bool destroy_flag);
   static Status fix_parameters(TdParameters &parameters) TD_WARN_UNUSED_RESULT;
@@ -48,12 +48,12 @@ std::string get_sqlite_path(const TdParameters &parameters) {
 
 Result<TdDb::EncryptionInfo> check_encryption(string path) {
   Binlog binlog;
-  auto status = binlog.init(path, Binlog::Callback());
+  auto status = binlog.init_check_encryption(std::move(path));
   if (status.is_error() && status.code() != Binlog::Error::WrongPassword) {
     return Status::Error(400, status.message());
   }
   TdDb::EncryptionInfo info;
-  info.is_encrypted = binlog.get_info().wrong_password;
+  info.is_encrypted = binlog.get_info().is_encrypted;
   binlog.close(false /*need_sync*/).ensure();
   return info;
 }
@@ -139,11 +139,48 @@ Status init_db(SqliteDb &db) {
   TRY_STATUS(db.exec("PRAGMA temp_store=MEMORY"));
   TRY_STATUS(db.exec("PRAGMA secure_delete=1"));
 
+  // checkpoints are driven by TdDbWalCheckpointActor; a raised in-writer threshold
+  // is kept only as a backstop in case the timer falls behind a write burst
+  TRY_STATUS(db.exec("PRAGMA wal_autocheckpoint=4000"));
+
   return Status::OK();
 }
 
 }  // namespace
 
+// Periodically checkpoints the WAL of the main SQLite database, so WAL pages are moved
+// to the database file from a background timer instead of inside an arbitrary write
+// transaction, which may be on the critical path of a sync burst
+class TdDbWalCheckpointActor : public Actor {
+ public:
+  explicit TdDbWalCheckpointActor(std::shared_ptr<SqliteConnectionSafe> sql_connection)
+      : sql_connection_(std::move(sql_connection)) {
+  }
+
+  void close(Promise<> promise) {
+    sql_connection_.reset();
+    promise.set_value(Unit());
+    stop();
+  }
+
+ private:
+  static constexpr double WAL_CHECKPOINT_PERIOD = 30.0;
+
+  std::shared_ptr<SqliteConnectionSafe> sql_connection_;
+
+  void start_up() override {
+    set_timeout_in(WAL_CHECKPOINT_PERIOD);
+  }
+
+  void timeout_expired() override {
+    auto status = sql_connection_->get().wal_checkpoint();
+    LOG_IF(WARNING, status.is_error()) << "Failed to checkpoint WAL: " << status;
+    set_timeout_in(WAL_CHECKPOINT_PERIOD);
+  }
+};
+
+constexpr double TdDbWalCheckpointActor::WAL_CHECKPOINT_PERIOD;
+
 std::shared_ptr<FileDbInterface> TdDb::get_file_db_shared() {
   return file_db_;
 }
@@ -242,6 +279,11 @@ void TdDb::do_close(Promise<> on_finished, bool destroy_flag) {
       }));
   auto lock = mpas.get_promise();
 
+  if (!wal_checkpoint_actor_.empty()) {
+    // the actor keeps a reference to sql_connection_, it must be released before the connection is closed
+    send_closure(std::move(wal_checkpoint_actor_), &TdDbWalCheckpointActor::close, mpas.get_promise());
+  }
+
   if (file_db_) {
     file_db_->close(mpas.get_promise());
     file_db_.reset();
@@ -352,7 +394,11 @@ Status TdDb::init_sqlite(int32 scheduler_id, const TdParameters &parameters, DbK
   if (user_version == 0) {
     binlog_pmc.erase("next_contacts_sync_date");
   }
-  binlog_pmc.force_sync({});
+  if (dialog_db_was_created || user_version == 0) {
+    // don't pay for an fsync on every launch; the binlog must be synced only
+    // if the erased keys have to stay consistent with the recreated tables
+    binlog_pmc.force_sync({});
+  }
 
   TRY_STATUS(db.exec("COMMIT TRANSACTION"));
 
@@ -371,6 +417,9 @@ Status TdDb::init_sqlite(int32 scheduler_id, const TdParameters &parameters, DbK
     messages_db_async_ = create_messages_db_async(messages_db_sync_safe_, scheduler_id);
   }
 
+  wal_checkpoint_actor_ =
+      create_actor_on_scheduler<TdDbWalCheckpointActor>("TdDbWalCheckpointActor", scheduler_id, sql_connection_);
+
   return Status::OK();
 }
 
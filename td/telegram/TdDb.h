@@ -13,6 +13,7 @@
 #include "td/db/DbKey.h"
 #include "td/db/KeyValueSyncInterface.h"
 
+#include "td/actor/actor.h"
 #include "td/actor/PromiseFuture.h"
 
 #include "td/utils/Slice.h"
@@ -36,6 +37,7 @@ class MessagesDbSyncSafeInterface;
 class MessagesDbAsyncInterface;
 class SqliteConnectionSafe;
 class SqliteKeyValueSafe;
+class TdDbWalCheckpointActor;
 class SqliteKeyValueAsyncInterface;
 class SqliteKeyValue;
 
@@ -104,6 +106,7 @@ class TdDb {
  private:
   string sqlite_path_;
   std::shared_ptr<SqliteConnectionSafe> sql_connection_;
+  ActorOwn<TdDbWalCheckpointActor> wal_checkpoint_actor_;
 
   std::shared_ptr<FileDbInterface> file_db_;
 
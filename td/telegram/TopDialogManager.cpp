@@ -161,6 +161,12 @@ void TopDialogManager::on_dialog_used(TopDialogCategory category, DialogId dialo
     it = next;
   }
 
+  if (top_dialogs.dialogs.size() > MAX_TOP_DIALOG_COUNT) {
+    // the server keeps the authoritative ratings, so the lowest rated dialogs
+    // can be simply dropped from the local cache
+    top_dialogs.dialogs.resize(MAX_TOP_DIALOG_COUNT);
+  }
+
   LOG(INFO) << "Update " << top_dialog_category_name(category) << " rating of " << dialog_id << " by " << delta;
 
   if (!first_unsync_change_) {
@@ -63,6 +63,7 @@ class TopDialogManager : public NetQueryCallback {
 
  private:
   static constexpr size_t MAX_TOP_DIALOGS_LIMIT = 30;
+  static constexpr size_t MAX_TOP_DIALOG_COUNT = 300;  // the server remembers at most 100 top dialogs per category
   static constexpr int32 SERVER_SYNC_DELAY = 86400;      // seconds
   static constexpr int32 SERVER_SYNC_RESEND_DELAY = 60;  // seconds
   static constexpr int32 DB_SYNC_DELAY = 5;              // seconds
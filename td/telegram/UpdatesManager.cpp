@@ -1059,6 +1059,13 @@ void UpdatesManager::after_get_difference() {
     return;
   }
 
+  if (postponed_updates_dropped_) {
+    postponed_updates_dropped_ = false;
+    VLOG(get_difference) << "Repeat getDifference to receive dropped postponed updates";
+    get_difference("after postponed updates were dropped");
+    return;
+  }
+
   if (postponed_updates_.size()) {
     VLOG(get_difference) << "Begin to apply postponed updates";
     while (!postponed_updates_.empty()) {
@@ -1068,6 +1075,7 @@ void UpdatesManager::after_get_difference() {
       auto updates_seq_end = it->second.seq_end;
       // ignore it->second.date, because it may be too old
       postponed_updates_.erase(it);
+      postponed_update_count_ -= updates.size();
       on_pending_updates(std::move(updates), updates_seq_begin, updates_seq_end, 0, "postponed updates");
       if (running_get_difference_) {
         VLOG(get_difference) << "Finish to apply postponed updates because forced to run getDifference";
@@ -1109,9 +1117,7 @@ void UpdatesManager::on_pending_updates(vector<tl_object_ptr<telegram_api::Updat
   }
 
   if (running_get_difference_) {
-    LOG(INFO) << "Postpone " << updates.size() << " updates [" << seq_begin << ", " << seq_end
-              << "] with date = " << date << " from " << source;
-    postponed_updates_.emplace(seq_begin, PendingUpdates(seq_begin, seq_end, date, std::move(updates)));
+    postpone_pending_updates(std::move(updates), seq_begin, seq_end, date, source);
     return;
   }
 
@@ -1206,9 +1212,7 @@ void UpdatesManager::on_pending_updates(vector<tl_object_ptr<telegram_api::Updat
   }
 
   if (running_get_difference_) {
-    LOG(INFO) << "Postpone " << updates.size() << " updates [" << seq_begin << ", " << seq_end
-              << "] with date = " << date << " from " << source;
-    postponed_updates_.emplace(seq_begin, PendingUpdates(seq_begin, seq_end, date, std::move(updates)));
+    postpone_pending_updates(std::move(updates), seq_begin, seq_end, date, source);
     return;
   }
 
@@ -1246,10 +1250,34 @@ void UpdatesManager::on_pending_updates(vector<tl_object_ptr<telegram_api::Updat
   LOG_IF(WARNING, pending_seq_updates_.find(seq_begin) != pending_seq_updates_.end())
       << "Already have pending updates with seq = " << seq_begin << ", but receive it again from " << source;
 
+  pending_seq_update_count_ += updates.size();
   pending_seq_updates_.emplace(seq_begin, PendingUpdates(seq_begin, seq_end, date, std::move(updates)));
+  if (pending_seq_update_count_ > MAX_POSTPONED_UPDATES) {
+    // don't wait for the gap timeout if too many updates were already buffered; getDifference
+    // closes the gap and the buffered updates are then applied or discarded as already received,
+    // so catch-up memory usage stays flat even on very busy accounts
+    return get_difference("pending seq updates overflow");
+  }
   set_seq_gap_timeout(MAX_UNFILLED_GAP_TIME);
 }
 
+void UpdatesManager::postpone_pending_updates(vector<tl_object_ptr<telegram_api::Update>> &&updates, int32 seq_begin,
+                                              int32 seq_end, int32 date, const char *source) {
+  CHECK(running_get_difference_);
+  LOG(INFO) << "Postpone " << updates.size() << " updates [" << seq_begin << ", " << seq_end
+            << "] with date = " << date << " from " << source;
+  postponed_update_count_ += updates.size();
+  postponed_updates_.emplace(seq_begin, PendingUpdates(seq_begin, seq_end, date, std::move(updates)));
+  if (postponed_update_count_ > MAX_POSTPONED_UPDATES) {
+    // keep memory usage bounded during a long catch-up; the dropped updates will be received
+    // from the server again by the getDifference run after the current one finishes
+    VLOG(get_difference) << "Drop " << postponed_update_count_ << " postponed updates";
+    postponed_updates_.clear();
+    postponed_update_count_ = 0;
+    postponed_updates_dropped_ = true;
+  }
+}
+
 void UpdatesManager::process_updates(vector<tl_object_ptr<telegram_api::Update>> &&updates, bool force_apply) {
   tl_object_ptr<telegram_api::updatePtsChanged> update_pts_changed;
   /*
@@ -1298,7 +1326,9 @@ void UpdatesManager::process_seq_updates(int32 seq_end, int32 date,
   // TODO remove after bugs will be fixed
   for (auto &update : updates) {
     if (update != nullptr) {
-      serialized_updates += oneline(to_string(update));
+      // the date source is needed only for wrong date diagnostics, so remember only
+      // update types instead of serializing all the updates on every applied batch
+      serialized_updates += PSTRING() << update->get_id() << ' ';
     }
   }
   process_updates(std::move(updates), false);
@@ -1317,6 +1347,7 @@ void UpdatesManager::process_pending_seq_updates() {
     if (seq_begin > seq_ + 1) {
       break;
     }
+    pending_seq_update_count_ -= update_it->second.updates.size();
     if (seq_begin == seq_ + 1) {
       process_seq_updates(update_it->second.seq_end, update_it->second.date, std::move(update_it->second.updates));
     } else {
@@ -83,6 +83,7 @@ class UpdatesManager : public Actor {
 
  private:
   static constexpr int32 FORCED_GET_DIFFERENCE_PTS_DIFF = 100000;
+  static constexpr size_t MAX_POSTPONED_UPDATES = 10000;  // bounds both update buffers below
 
   friend class OnUpdate;
 
@@ -110,7 +111,10 @@ class UpdatesManager : public Actor {
   int32 short_update_date_ = 0;
 
   std::multimap<int32, PendingUpdates> postponed_updates_;    // updates received during getDifference
+  size_t postponed_update_count_ = 0;
+  bool postponed_updates_dropped_ = false;
   std::multimap<int32, PendingUpdates> pending_seq_updates_;  // updates with too big seq
+  size_t pending_seq_update_count_ = 0;
 
   Timeout seq_gap_timeout_;
 
@@ -142,6 +146,9 @@ class UpdatesManager : public Actor {
   void on_pending_updates(vector<tl_object_ptr<telegram_api::Update>> &&updates, int32 seq_begin, int32 seq_end,
                           int32 date, const char *source);
 
+  void postpone_pending_updates(vector<tl_object_ptr<telegram_api::Update>> &&updates, int32 seq_begin, int32 seq_end,
+                                int32 date, const char *source);
+
   void process_updates(vector<tl_object_ptr<telegram_api::Update>> &&updates, bool force_apply);
 
   void process_seq_updates(int32 seq_end, int32 date, vector<tl_object_ptr<telegram_api::Update>> &&updates);
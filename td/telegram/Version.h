@@ -45,6 +45,7 @@ enum class DbVersion : int32 {
   MessagesCallIndex,
   FixFileRemoteLocationKeyBug,
   AddNotificationsSupport,
+  AddMessagesDbCompression,
   Next
 };
 
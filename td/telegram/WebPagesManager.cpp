@@ -19,6 +19,7 @@
 #include "td/telegram/files/FileSourceId.h"
 #include "td/telegram/Global.h"
 #include "td/telegram/logevent/LogEvent.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/MessageEntity.h"
 #include "td/telegram/MessagesManager.h"
 #include "td/telegram/Photo.h"
@@ -46,6 +47,8 @@
 #include "td/utils/StringBuilder.h"
 #include "td/utils/tl_helpers.h"
 
+#include <algorithm>
+
 namespace td {
 
 class GetWebPagePreviewQuery : public Td::ResultHandler {
@@ -203,6 +206,7 @@ class WebPagesManager::WebPage {
   FileSourceId file_source_id;
 
   mutable uint64 logevent_id = 0;
+  mutable int32 last_access_date = 0;
 
   template <class StorerT>
   void store(StorerT &storer) const {
@@ -519,6 +523,44 @@ void WebPagesManager::update_web_page(unique_ptr<WebPage> web_page, WebPageId we
   if (!from_database) {
     save_web_page(page.get(), web_page_id, from_binlog);
   }
+
+  evict_web_pages();
+}
+
+void WebPagesManager::evict_web_pages() {
+  if (!G()->parameters().use_message_db || web_pages_.size() <= MAX_CACHED_WEB_PAGES) {
+    // without the database an unloaded web page can't be restored
+    return;
+  }
+
+  vector<std::pair<int32, WebPageId>> pages;
+  pages.reserve(web_pages_.size());
+  for (auto &it : web_pages_) {
+    auto web_page_id = it.first;
+    if (it.second->logevent_id != 0 || pending_web_pages_.count(web_page_id) != 0 ||
+        pending_get_web_pages_.count(web_page_id) != 0 ||
+        load_web_page_instant_view_queries_.count(web_page_id) != 0) {
+      // the web page is awaited by some query or isn't yet surely saved to the database
+      continue;
+    }
+    pages.emplace_back(it.second->last_access_date, web_page_id);
+  }
+
+  auto evict_count = web_pages_.size() - MAX_CACHED_WEB_PAGES / 10 * 9;
+  if (pages.size() > evict_count) {
+    std::nth_element(pages.begin(), pages.begin() + evict_count, pages.end(),
+                     [](const std::pair<int32, WebPageId> &lhs, const std::pair<int32, WebPageId> &rhs) {
+                       return lhs.first < rhs.first;
+                     });
+    pages.resize(evict_count);
+  }
+
+  for (auto &page : pages) {
+    LOG(INFO) << "Unload " << page.second << " last accessed at " << page.first;
+    web_pages_.erase(page.second);
+    // the web page must be reloaded from the database when it is needed next time
+    loaded_from_database_web_pages_.erase(page.second);
+  }
 }
 
 void WebPagesManager::update_web_page_instant_view(WebPageId web_page_id, WebPageInstantView &new_instant_view,
@@ -1136,6 +1178,7 @@ const WebPagesManager::WebPage *WebPagesManager::get_web_page(WebPageId web_page
   if (p == web_pages_.end()) {
     return nullptr;
   } else {
+    p->second->last_access_date = G()->unix_time_cached();
     return p->second.get();
   }
 }
@@ -1476,6 +1519,14 @@ FileSourceId WebPagesManager::get_url_file_source_id(const string &url) {
   return url_to_file_source_id_[url] = td_->file_reference_manager_->create_web_page_file_source(url);
 }
 
+void WebPagesManager::get_memory_stats(MemoryStats &stats) const {
+  stats.add_entry("WebPagesManager", "web_pages_", web_pages_.size(), web_pages_.size() * sizeof(WebPage));
+  stats.add("WebPagesManager", "loaded_from_database_web_pages_", loaded_from_database_web_pages_);
+  stats.add("WebPagesManager", "url_to_web_page_id_", url_to_web_page_id_);
+  stats.add("WebPagesManager", "url_to_file_source_id_", url_to_file_source_id_);
+  stats.add("WebPagesManager", "pending_web_pages_", pending_web_pages_);
+}
+
 string WebPagesManager::get_web_page_search_text(WebPageId web_page_id) const {
   const WebPage *web_page = get_web_page(web_page_id);
   if (web_page == nullptr) {
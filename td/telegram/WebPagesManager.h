@@ -31,6 +31,8 @@ namespace td {
 
 struct BinlogEvent;
 
+class MemoryStats;
+
 class Td;
 
 class WebPagesManager : public Actor {
@@ -83,6 +85,8 @@ class WebPagesManager : public Actor {
 
   string get_web_page_search_text(WebPageId web_page_id) const;
 
+  void get_memory_stats(MemoryStats &stats) const;
+
  private:
   static constexpr int32 WEBPAGE_FLAG_HAS_TYPE = 1;
   static constexpr int32 WEBPAGE_FLAG_HAS_SITE_NAME = 2;
@@ -96,6 +100,8 @@ class WebPagesManager : public Actor {
   static constexpr int32 WEBPAGE_FLAG_HAS_DOCUMENT = 512;
   static constexpr int32 WEBPAGE_FLAG_HAS_INSTANT_VIEW = 1024;
 
+  static constexpr size_t MAX_CACHED_WEB_PAGES = 20000;  // some reasonable limit
+
   class WebPage;
 
   class WebPageInstantView;
@@ -104,6 +110,10 @@ class WebPagesManager : public Actor {
 
   void update_web_page(unique_ptr<WebPage> web_page, WebPageId web_page_id, bool from_binlog, bool from_database);
 
+  // evicts the least recently used web pages back to the database-only state,
+  // so the number of web pages kept in memory stays bounded
+  void evict_web_pages();
+
   void update_web_page_instant_view(WebPageId web_page_id, WebPageInstantView &new_instant_view,
                                     WebPageInstantView &&old_instant_view);
 
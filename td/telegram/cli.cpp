@@ -6,6 +6,7 @@
 //
 #include "td/telegram/ClientActor.h"
 #include "td/telegram/Log.h"
+#include "td/telegram/net/NetQueryStats.h"
 
 #include "td/telegram/td_api_json.h"
 
@@ -3979,6 +3980,7 @@ void main(int argc, char **argv) {
   SET_VERBOSITY_LEVEL(new_verbosity_level);
   ClientActor::execute(td_api::make_object<td_api::setLogTagVerbosityLevel>("update_file", 2));
   ClientActor::execute(td_api::make_object<td_api::setLogTagVerbosityLevel>("file_reference", 2));
+  NetQueryStats::get_default().set_query_tracking(true);  // for DumpNetQueries
 
   {
     ConcurrentScheduler scheduler;
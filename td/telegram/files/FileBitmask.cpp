@@ -6,6 +6,7 @@
 //
 #include "td/telegram/files/FileBitmask.h"
 
+#include "td/utils/bits.h"
 #include "td/utils/common.h"
 #include "td/utils/misc.h"
 #include "td/utils/ScopeGuard.h"
@@ -15,9 +16,9 @@ namespace td {
 Bitmask::Bitmask(Decode, Slice data) : data_(zero_one_decode(data)) {
 }
 
-Bitmask::Bitmask(Ones, int64 count) : data_(narrow_cast<size_t>((count + 7) / 8), '\0') {
-  for (int64 i = 0; i < count; i++) {
-    set(i);
+Bitmask::Bitmask(Ones, int64 count) : data_(narrow_cast<size_t>((count + 7) / 8), static_cast<char>(0xff)) {
+  if (count % 8 != 0) {
+    data_.back() = static_cast<char>(0xff >> (8 - count % 8));
   }
 }
 
@@ -88,16 +89,25 @@ int64 Bitmask::get_ready_prefix_size(int64 offset, int64 part_size, int64 file_s
 }
 
 int64 Bitmask::get_total_size(int64 part_size, int64 file_size) const {
-  int64 res = 0;
-  for (int64 i = 0; i < size(); i++) {
-    if (get(i)) {
-      auto from = i * part_size;
-      auto to = from + part_size;
-      if (file_size != 0 && file_size < to) {
-        to = file_size;
-      }
-      if (from < to) {
-        res += to - from;
+  if (part_size == 0) {
+    return 0;
+  }
+  CHECK(part_size > 0);
+  int64 ones = 0;
+  for (auto c : data_) {
+    ones += count_bits32(static_cast<uint8>(c));
+  }
+  auto res = ones * part_size;
+  if (file_size != 0) {
+    // parts behind the end of the file contribute nothing,
+    // and the last part of the file may be shorter than part_size
+    for (int64 i = file_size / part_size; i < size(); i++) {
+      if (get(i)) {
+        res -= part_size;
+        auto from = i * part_size;
+        if (from < file_size) {
+          res += file_size - from;
+        }
       }
     }
   }
@@ -116,11 +126,25 @@ bool Bitmask::get(int64 offset_part) const {
 }
 
 int64 Bitmask::get_ready_parts(int64 offset_part) const {
-  int64 res = 0;
-  while (get(offset_part + res)) {
+  if (offset_part < 0) {
+    return 0;
+  }
+  auto res = offset_part;
+  // finish the current byte bit by bit, then skip whole ready bytes at once
+  while (res % 8 != 0 && get(res)) {
     res++;
   }
-  return res;
+  if (res % 8 == 0) {
+    auto index = narrow_cast<size_t>(res / 8);
+    while (index < data_.size() && static_cast<uint8>(data_[index]) == 0xff) {
+      index++;
+      res += 8;
+    }
+    while (get(res)) {
+      res++;
+    }
+  }
+  return res - offset_part;
 }
 
 std::vector<int32> Bitmask::as_vector() const {
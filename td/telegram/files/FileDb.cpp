@@ -31,8 +31,103 @@
 #include "td/utils/tl_parsers.h"
 #include "td/utils/tl_storers.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace td {
 
+namespace {
+FileData clone_file_data(const FileData &data) {
+  FileData res;
+  res.owner_dialog_id_ = data.owner_dialog_id_;
+  res.pmc_id_ = data.pmc_id_;
+  res.remote_ = data.remote_;
+  res.local_ = data.local_;
+  if (data.generate_ != nullptr) {
+    res.generate_ = make_unique<FullGenerateFileLocation>(*data.generate_);
+  }
+  res.size_ = data.size_;
+  res.expected_size_ = data.expected_size_;
+  res.remote_name_ = data.remote_name_;
+  res.url_ = data.url_;
+  res.encryption_key_ = data.encryption_key_;
+  res.file_source_ids_ = data.file_source_ids_;
+  return res;
+}
+
+// Bounded cache of decoded FileData in front of the database, so lookups of hot
+// files (stickers, avatars) don't parse the same value from SQLite over and over.
+// It is shared between the caller threads and FileDbActor; the generation counter
+// guarantees that a load racing with a write can't insert an already stale value.
+class FileDataCache {
+ public:
+  bool get(FileDbId id, FileData &data) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = entries_.find(id.get());
+    if (it == entries_.end()) {
+      return false;
+    }
+    it->second.used_at = ++usage_;
+    data = clone_file_data(it->second.data);
+    return true;
+  }
+
+  uint64 generation() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return generation_;
+  }
+
+  void set(FileDbId id, FileDbId main_id, const FileData &data, uint64 generation) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (generation != generation_) {
+      // the value was loaded before some write and may be stale already
+      return;
+    }
+    auto &entry = entries_[id.get()];
+    entry.main_id = main_id.get();
+    entry.data = clone_file_data(data);
+    entry.used_at = ++usage_;
+    if (entries_.size() > MAX_SIZE) {
+      auto lru_it = entries_.begin();
+      for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->second.used_at < lru_it->second.used_at) {
+          lru_it = it;
+        }
+      }
+      entries_.erase(lru_it);
+    }
+  }
+
+  void erase(FileDbId id) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    generation_++;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      // entries of merged records share the data of their main id and must be
+      // dropped together with it
+      if (it->first == id.get() || it->second.main_id == id.get()) {
+        it = entries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t MAX_SIZE = 128;
+
+  struct Entry {
+    uint64 main_id{0};
+    FileData data;
+    uint64 used_at{0};
+  };
+
+  std::mutex mutex_;
+  std::unordered_map<uint64, Entry> entries_;
+  uint64 usage_{0};
+  uint64 generation_{0};
+};
+}  // namespace
+
 Status drop_file_db(SqliteDb &db, int32 version) {
   LOG(WARNING) << "Drop file_db " << tag("version", version) << tag("current_db_version", current_db_version());
   TRY_STATUS(SqliteKeyValue::drop(db, "files"));
@@ -65,8 +160,11 @@ class FileDb : public FileDbInterface {
  public:
   class FileDbActor : public Actor {
    public:
-    FileDbActor(FileDbId current_pmc_id, std::shared_ptr<SqliteKeyValueSafe> file_kv_safe)
-        : current_pmc_id_(current_pmc_id), file_kv_safe_(std::move(file_kv_safe)) {
+    FileDbActor(FileDbId current_pmc_id, std::shared_ptr<SqliteKeyValueSafe> file_kv_safe,
+                std::shared_ptr<FileDataCache> file_data_cache)
+        : current_pmc_id_(current_pmc_id)
+        , file_kv_safe_(std::move(file_kv_safe))
+        , file_data_cache_(std::move(file_data_cache)) {
     }
 
     void close(Promise<> promise) {
@@ -77,7 +175,7 @@ class FileDb : public FileDbInterface {
     }
 
     void load_file_data(const string &key, Promise<FileData> promise) {
-      promise.set_result(load_file_data_impl(actor_id(this), file_pmc(), key));
+      promise.set_result(load_file_data_impl(actor_id(this), file_pmc(), key, *file_data_cache_));
     }
 
     void clear_file_data(FileDbId id, const string &remote_key, const string &local_key, const string &generate_key) {
@@ -85,6 +183,7 @@ class FileDb : public FileDbInterface {
       pmc.begin_transaction().ensure();
       SCOPE_EXIT {
         pmc.commit_transaction().ensure();
+        file_data_cache_->erase(id);
       };
 
       if (id > current_pmc_id_) {
@@ -113,6 +212,7 @@ class FileDb : public FileDbInterface {
       pmc.begin_transaction().ensure();
       SCOPE_EXIT {
         pmc.commit_transaction().ensure();
+        file_data_cache_->erase(id);
       };
 
       if (id > current_pmc_id_) {
@@ -137,6 +237,7 @@ class FileDb : public FileDbInterface {
       pmc.begin_transaction().ensure();
       SCOPE_EXIT {
         pmc.commit_transaction().ensure();
+        file_data_cache_->erase(id);
       };
 
       if (id > current_pmc_id_) {
@@ -162,6 +263,7 @@ class FileDb : public FileDbInterface {
    private:
     FileDbId current_pmc_id_;
     std::shared_ptr<SqliteKeyValueSafe> file_kv_safe_;
+    std::shared_ptr<FileDataCache> file_data_cache_;
 
     SqliteKeyValue &file_pmc() {
       return file_kv_safe_->get();
@@ -175,9 +277,10 @@ class FileDb : public FileDbInterface {
   explicit FileDb(std::shared_ptr<SqliteKeyValueSafe> kv_safe, int scheduler_id = -1) {
     file_kv_safe_ = std::move(kv_safe);
     CHECK(file_kv_safe_);
+    file_data_cache_ = std::make_shared<FileDataCache>();
     current_pmc_id_ = FileDbId(to_integer<uint64>(file_kv_safe_->get().get("file_id")));
-    file_db_actor_ =
-        create_actor_on_scheduler<FileDbActor>("FileDbActor", scheduler_id, current_pmc_id_, file_kv_safe_);
+    file_db_actor_ = create_actor_on_scheduler<FileDbActor>("FileDbActor", scheduler_id, current_pmc_id_,
+                                                            file_kv_safe_, file_data_cache_);
   }
 
   FileDbId create_pmc_id() override {
@@ -194,7 +297,7 @@ class FileDb : public FileDbInterface {
   }
 
   Result<FileData> get_file_data_sync_impl(string key) override {
-    return load_file_data_impl(file_db_actor_.get(), file_kv_safe_->get(), key);
+    return load_file_data_impl(file_db_actor_.get(), file_kv_safe_->get(), key, *file_data_cache_);
   }
 
   void clear_file_data(FileDbId id, const FileData &file_data) override {
@@ -245,11 +348,19 @@ class FileDb : public FileDbInterface {
   ActorOwn<FileDbActor> file_db_actor_;
   FileDbId current_pmc_id_;
   std::shared_ptr<SqliteKeyValueSafe> file_kv_safe_;
+  std::shared_ptr<FileDataCache> file_data_cache_;
 
   static Result<FileData> load_file_data_impl(ActorId<FileDbActor> file_db_actor_id, SqliteKeyValue &pmc,
-                                              const string &key) {
+                                              const string &key, FileDataCache &file_data_cache) {
     //LOG(DEBUG) << "Load by key " << format::as_hex_dump<4>(Slice(key));
     TRY_RESULT(id, get_id(pmc, key));
+    auto requested_id = id;
+
+    FileData cached_data;
+    if (file_data_cache.get(requested_id, cached_data)) {
+      return std::move(cached_data);
+    }
+    auto generation = file_data_cache.generation();
 
     vector<FileDbId> ids;
     string data_str;
@@ -286,6 +397,7 @@ class FileDb : public FileDbInterface {
     if (status.is_error()) {
       return std::move(status);
     }
+    file_data_cache.set(requested_id, id, data, generation);
     return std::move(data);
   }
 
@@ -401,6 +401,11 @@ Status FileDownloader::process_check_query(NetQueryPtr net_query) {
   return Status::OK();
 }
 
+// Verification is interleaved with the download: this is called after every batch of completed
+// parts, and each server-defined hash range is checked as soon as the ready prefix covers it, so
+// there is no hashing pass left to do when the last part arrives. The server provides a separate
+// hash per range, which is why the ranges can't be folded into one running digest; the read-back
+// of a just-written range is served from the page cache
 Result<FileLoader::CheckInfo> FileDownloader::check_loop(int64 checked_prefix_size, int64 ready_prefix_size,
                                                          bool is_ready) {
   if (!need_check_) {
@@ -494,6 +499,14 @@ Status FileDownloader::acquire_fd() {
     if (path_.empty()) {
       TRY_RESULT(file_path, open_temp_file(remote_.file_type_));
       std::tie(fd_, path_) = std::move(file_path);
+      if (size_ > 0) {
+        // pre-allocate the whole file, so parts written at random offsets
+        // don't fragment it; the file is fully overwritten before it is used
+        auto status = fd_.pre_allocate(size_);
+        if (status.is_error()) {
+          LOG(INFO) << "Failed to pre-allocate " << size_ << " bytes: " << status;
+        }
+      }
     } else {
       TRY_RESULT(fd, FileFd::open(path_, (only_check_ ? 0 : FileFd::Write) | FileFd::Read));
       fd_ = std::move(fd);
@@ -26,6 +26,10 @@ namespace td {
 
 int VERBOSITY_NAME(file_gc) = VERBOSITY_NAME(INFO);
 
+void FileGcWorker::start_up() {
+  set_priority(ActorPriority::Low);
+}
+
 void FileGcWorker::do_remove_file(const FullFileInfo &info) {
   // LOG(WARNING) << "Gc remove file: " << tag("path", file) << tag("mtime", stat.mtime_nsec_ / 1000000000)
   // << tag("atime", stat.atime_nsec_ / 1000000000);
@@ -38,7 +42,9 @@ void FileGcWorker::do_remove_file(const FullFileInfo &info) {
 
 void FileGcWorker::run_gc(const FileGcParameters &parameters, std::vector<FullFileInfo> files,
                           Promise<FileStats> promise) {
-  auto begin_time = Time::now();
+  CHECK(to_remove_.empty());
+  begin_time_ = Time::now();
+  total_removed_size_ = 0;
   VLOG(file_gc) << "Start files gc with " << parameters;
   // quite stupid implementations
   // needs a lot of memory
@@ -127,7 +133,7 @@ void FileGcWorker::run_gc(const FileGcParameters &parameters, std::vector<FullFi
             }
 
             if (static_cast<double>(info.atime_nsec / 1000000000) < now - parameters.max_time_from_last_access) {
-              do_remove_file(info);
+              to_remove_.push_back(info);
               total_removed_size += info.size;
               remove_by_atime_cnt++;
               return true;
@@ -136,6 +142,7 @@ void FileGcWorker::run_gc(const FileGcParameters &parameters, std::vector<FullFi
           }),
       files.end());
   if (token_) {
+    to_remove_.clear();
     return promise.set_error(Status::Error(500, "Request aborted"));
   }
 
@@ -155,9 +162,6 @@ void FileGcWorker::run_gc(const FileGcParameters &parameters, std::vector<FullFi
 
   size_t pos = 0;
   while (pos < files.size() && (remove_count > 0 || remove_size > 0)) {
-    if (token_) {
-      return promise.set_error(Status::Error(500, "Request aborted"));
-    }
     if (remove_count > 0) {
       remove_by_count_cnt++;
     } else {
@@ -170,7 +174,7 @@ void FileGcWorker::run_gc(const FileGcParameters &parameters, std::vector<FullFi
     remove_size -= files[pos].size;
 
     total_removed_size += files[pos].size;
-    do_remove_file(files[pos]);
+    to_remove_.push_back(std::move(files[pos]));
     pos++;
   }
 
@@ -179,18 +183,40 @@ void FileGcWorker::run_gc(const FileGcParameters &parameters, std::vector<FullFi
     pos++;
   }
 
-  auto end_time = Time::now();
-
-  VLOG(file_gc) << "Finish files gc: " << tag("time", end_time - begin_time) << tag("total", file_cnt)
-                << tag("removed", remove_by_atime_cnt + remove_by_count_cnt + remove_by_size_cnt)
-                << tag("total_size", format::as_size(total_size))
-                << tag("total_removed_size", format::as_size(total_removed_size))
+  VLOG(file_gc) << "Select files to remove: " << tag("time", Time::now() - begin_time_) << tag("total", file_cnt)
+                << tag("to_remove", to_remove_.size()) << tag("total_size", format::as_size(total_size))
+                << tag("size_to_remove", format::as_size(total_removed_size))
                 << tag("by_atime", remove_by_atime_cnt) << tag("by_count", remove_by_count_cnt)
                 << tag("by_size", remove_by_size_cnt) << tag("type_immunity", type_immunity_ignored_cnt)
                 << tag("time_immunity", time_immunity_ignored_cnt)
                 << tag("owner_dialog_id_immunity", owner_dialog_id_ignored_cnt)
                 << tag("exclude_owner_dialog_id_immunity", exclude_owner_dialog_id_ignored_cnt);
 
-  promise.set_value(std::move(new_stats));
+  new_stats_ = std::move(new_stats);
+  promise_ = std::move(promise);
+  remove_pos_ = 0;
+  timeout_expired();
+}
+
+void FileGcWorker::timeout_expired() {
+  auto round_end = min(remove_pos_ + MAX_REMOVES_PER_ROUND, to_remove_.size());
+  for (; remove_pos_ < round_end; remove_pos_++) {
+    if (token_) {
+      to_remove_.clear();
+      return promise_.set_error(Status::Error(500, "Request aborted"));
+    }
+    total_removed_size_ += to_remove_[remove_pos_].size;
+    do_remove_file(to_remove_[remove_pos_]);
+  }
+  if (remove_pos_ < to_remove_.size()) {
+    VLOG(file_gc) << "Continue files gc: " << tag("removed", remove_pos_) << tag("left", to_remove_.size() - remove_pos_);
+    set_timeout_in(ROUND_DELAY);
+    return;
+  }
+
+  VLOG(file_gc) << "Finish files gc: " << tag("time", Time::now() - begin_time_) << tag("removed", remove_pos_)
+                << tag("total_removed_size", format::as_size(total_removed_size_));
+  to_remove_.clear();
+  promise_.set_value(std::move(new_stats_));
 }
 }  // namespace td
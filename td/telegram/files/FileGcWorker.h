@@ -26,8 +26,25 @@ class FileGcWorker : public Actor {
   void run_gc(const FileGcParameters &parameters, std::vector<FullFileInfo> files, Promise<FileStats> promise);
 
  private:
+  // removals are spread over time: at most MAX_REMOVES_PER_ROUND files are
+  // unlinked per round, so a gc over a huge cache doesn't slow down concurrent
+  // file transfers with one long I/O burst
+  static constexpr size_t MAX_REMOVES_PER_ROUND = 100;
+  static constexpr double ROUND_DELAY = 0.1;  // 100ms
+
+  void start_up() override;
+  void timeout_expired() override;
+
   ActorShared<> parent_;
   CancellationToken token_;
+
+  std::vector<FullFileInfo> to_remove_;
+  size_t remove_pos_ = 0;
+  FileStats new_stats_;
+  Promise<FileStats> promise_;
+  double begin_time_ = 0;
+  int64 total_removed_size_ = 0;
+
   void do_remove_file(const FullFileInfo &info);
 };
 
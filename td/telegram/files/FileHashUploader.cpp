@@ -10,9 +10,12 @@
 
 #include "td/telegram/files/FileType.h"
 #include "td/telegram/Global.h"
+#include "td/telegram/logevent/LogEvent.h"
 #include "td/telegram/net/DcId.h"
 #include "td/telegram/net/NetQueryDispatcher.h"
+#include "td/telegram/TdDb.h"
 
+#include "td/utils/base64.h"
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
 #include "td/utils/crypto.h"
@@ -67,9 +70,24 @@ Status FileHashUploader::loop_impl() {
     TRY_STATUS(loop_sha());
   }
   if (state_ == State::NetRequest) {
+    hash_ = string(32, '\0');
+    sha256_state_.extract(hash_, true);
+
+    // documents previously found by content hash are remembered in the database,
+    // so re-sending the same content skips the server request
+    auto value = G()->td_db()->get_binlog_pmc()->get(get_hash_key());
+    if (!value.empty()) {
+      FullRemoteFileLocation remote;
+      if (log_event_parse(remote, value).is_ok()) {
+        LOG(INFO) << "Found document by hash in the database";
+        callback_->on_ok(remote);
+        stop_flag_ = true;
+        return Status::OK();
+      }
+    }
+
     // messages.getDocumentByHash#338e2464 sha256:bytes size:int mime_type:string = Document;
-    auto hash = BufferSlice(32);
-    sha256_state_.extract(hash.as_slice(), true);
+    auto hash = BufferSlice(hash_);
     auto mime_type = MimeType::from_extension(PathView(local_.path_).extension(), "image/gif");
     auto query =
         telegram_api::messages_getDocumentByHash(std::move(hash), static_cast<int32>(size_), std::move(mime_type));
@@ -115,6 +133,10 @@ Status FileHashUploader::loop_sha() {
   return Status::OK();
 }
 
+string FileHashUploader::get_hash_key() const {
+  return PSTRING() << "file_hash" << size_ << '_' << base64url_encode(hash_);
+}
+
 void FileHashUploader::on_result(NetQueryPtr net_query) {
   auto status = on_result_impl(std::move(net_query));
   if (status.is_error()) {
@@ -138,9 +160,12 @@ Status FileHashUploader::on_result_impl(NetQueryPtr net_query) {
       if (!DcId::is_valid(document->dc_id_)) {
         return Status::Error("Found document has invalid DcId");
       }
-      callback_->on_ok(FullRemoteFileLocation(FileType::Document, document->id_, document->access_hash_,
-                                              DcId::internal(document->dc_id_),
-                                              document->file_reference_.as_slice().str()));
+      FullRemoteFileLocation remote(FileType::Document, document->id_, document->access_hash_,
+                                    DcId::internal(document->dc_id_), document->file_reference_.as_slice().str());
+      // the stored file reference may expire, but it will be repaired
+      // the same way as for any other remote location
+      G()->td_db()->get_binlog_pmc()->set(get_hash_key(), log_event_store(remote).as_slice().str());
+      callback_->on_ok(remote);
 
       stop_flag_ = true;
       return Status::OK();
@@ -65,6 +65,9 @@ class FileHashUploader : public FileLoaderActor {
   enum class State : int32 { CalcSha, NetRequest, WaitNetResult } state_ = State::CalcSha;
   bool stop_flag_ = false;
   Sha256State sha256_state_;
+  string hash_;
+
+  string get_hash_key() const;
 
   void start_up() override;
   Status init();
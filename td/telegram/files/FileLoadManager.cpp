@@ -27,6 +27,16 @@ void FileLoadManager::start_up() {
                                                                  : ResourceManager::Mode::Baseline);
 }
 
+int32 FileLoadManager::get_loader_scheduler_id() {
+  // place loaders into the dedicated I/O pool if there is one, so that heavy file transfers
+  // don't steal cycles from the Td/Session schedulers
+  auto sched_id = Scheduler::instance()->get_pool_scheduler_id("io");
+  if (sched_id == -1) {
+    sched_id = Scheduler::instance()->sched_id();
+  }
+  return sched_id;
+}
+
 ActorOwn<ResourceManager> &FileLoadManager::get_download_resource_manager(bool is_small, DcId dc_id) {
   auto &actor = is_small ? download_small_resource_manager_map_[dc_id] : download_resource_manager_map_[dc_id];
   if (actor.empty()) {
@@ -51,9 +61,9 @@ void FileLoadManager::download(QueryId id, const FullRemoteFileLocation &remote_
   node->query_id_ = id;
   auto callback = make_unique<FileDownloaderCallback>(actor_shared(this, node_id));
   bool is_small = size < 20 * 1024;
-  node->loader_ =
-      create_actor<FileDownloader>("Downloader", remote_location, local, size, std::move(name), encryption_key,
-                                   is_small, search_file, offset, limit, std::move(callback));
+  node->loader_ = create_actor_on_scheduler<FileDownloader>(
+      "Downloader", get_loader_scheduler_id(), remote_location, local, size, std::move(name), encryption_key, is_small,
+      search_file, offset, limit, std::move(callback));
   DcId dc_id = remote_location.is_web() ? G()->get_webfile_dc_id() : remote_location.get_dc_id();
   auto &resource_manager = get_download_resource_manager(is_small, dc_id);
   send_closure(resource_manager, &ResourceManager::register_worker,
@@ -73,8 +83,9 @@ void FileLoadManager::upload(QueryId id, const LocalFileLocation &local_location
   CHECK(node);
   node->query_id_ = id;
   auto callback = make_unique<FileUploaderCallback>(actor_shared(this, node_id));
-  node->loader_ = create_actor<FileUploader>("Uploader", local_location, remote_location, expected_size, encryption_key,
-                                             std::move(bad_parts), std::move(callback));
+  node->loader_ =
+      create_actor_on_scheduler<FileUploader>("Uploader", get_loader_scheduler_id(), local_location, remote_location,
+                                              expected_size, encryption_key, std::move(bad_parts), std::move(callback));
   send_closure(upload_resource_manager_, &ResourceManager::register_worker,
                ActorShared<FileLoaderActor>(node->loader_.get(), static_cast<uint64>(-1)), priority);
   query_id_to_node_id_[id] = node_id;
@@ -91,7 +102,8 @@ void FileLoadManager::upload_by_hash(QueryId id, const FullLocalFileLocation &lo
   CHECK(node);
   node->query_id_ = id;
   auto callback = make_unique<FileHashUploaderCallback>(actor_shared(this, node_id));
-  node->loader_ = create_actor<FileHashUploader>("HashUploader", local_location, size, std::move(callback));
+  node->loader_ = create_actor_on_scheduler<FileHashUploader>("HashUploader", get_loader_scheduler_id(), local_location,
+                                                              size, std::move(callback));
   send_closure(upload_resource_manager_, &ResourceManager::register_worker,
                ActorShared<FileLoaderActor>(node->loader_.get(), static_cast<uint64>(-1)), priority);
   query_id_to_node_id_[id] = node_id;
@@ -87,6 +87,7 @@ class FileLoadManager final : public Actor {
 
   void close_node(NodeId node_id);
   ActorOwn<ResourceManager> &get_download_resource_manager(bool is_small, DcId dc_id);
+  int32 get_loader_scheduler_id();
 
   void on_start_download();
   void on_partial_download(const PartialLocalFileLocation &partial_local, int64 ready_size, int64 size);
@@ -68,9 +68,13 @@ void FileLoader::update_local_file_location(const LocalFileLocation &local) {
 void FileLoader::update_download_offset(int64 offset) {
   if (parts_manager_.get_streaming_offset() != offset) {
     parts_manager_.set_streaming_offset(offset);
-    //TODO: cancel only some queries
+    auto head_part_i = narrow_cast<int32>(parts_manager_.get_streaming_offset() / parts_manager_.get_part_size());
+    // cancel only the queries deprioritized by the seek; parts after the new
+    // offset are still wanted and will arrive sooner than a restarted query
     for (auto &it : part_map_) {
-      it.second.second.reset();  // cancel_query(it.second.second);
+      if (it.first < head_part_i || !parts_manager_.is_part_in_streaming_limit(it.first)) {
+        it.second.second.reset();  // cancel_query(it.second.second);
+      }
     }
   }
   update_estimated_limit();
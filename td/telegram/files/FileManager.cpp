@@ -16,6 +16,7 @@
 #include "td/telegram/files/FileLocation.h"
 #include "td/telegram/files/FileLocation.hpp"
 #include "td/telegram/Global.h"
+#include "td/telegram/MemoryStats.h"
 #include "td/telegram/logevent/LogEvent.h"
 #include "td/telegram/misc.h"
 #include "td/telegram/SecureStorage.h"
@@ -35,6 +36,7 @@
 #include "td/utils/port/Stat.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/StringBuilder.h"
+#include "td/utils/ThreadSafeCounter.h"
 #include "td/utils/tl_helpers.h"
 #include "td/utils/tl_parsers.h"
 
@@ -988,6 +990,9 @@ void FileManager::on_file_unlink(const FullLocalFileLocation &location) {
 
 Result<FileId> FileManager::register_local(FullLocalFileLocation location, DialogId owner_dialog_id, int64 size,
                                            bool get_by_hash, bool force) {
+  static auto register_local_counter = NamedThreadSafeCounter::get_default().get_counter("file_manager_local_files");
+  register_local_counter.add(1);
+
   // TODO: use get_by_hash
   FileData data;
   data.local_ = LocalFileLocation(std::move(location));
@@ -998,6 +1003,9 @@ Result<FileId> FileManager::register_local(FullLocalFileLocation location, Dialo
 
 FileId FileManager::register_remote(const FullRemoteFileLocation &location, FileLocationSource file_location_source,
                                     DialogId owner_dialog_id, int64 size, int64 expected_size, string name) {
+  static auto register_remote_counter = NamedThreadSafeCounter::get_default().get_counter("file_manager_remote_files");
+  register_remote_counter.add(1);
+
   FileData data;
   data.remote_ = RemoteFileLocation(location);
   data.owner_dialog_id_ = owner_dialog_id;
@@ -1964,7 +1972,7 @@ void FileManager::delete_file(FileId file_id, Promise<Unit> promise, const char
       clear_from_pmc(node);
 
       unlink(file_view.local_location().path_).ignore();
-      context_->on_new_file(-file_view.size(), -1);
+      context_->on_new_file(file_view.get_type(), -file_view.size(), -1);
       node->drop_local_location();
       try_flush_node(node, "delete_file 1");
     }
@@ -2765,6 +2773,14 @@ FileView FileManager::get_sync_file_view(FileId file_id) {
   return FileView(file_node);
 }
 
+void FileManager::get_memory_stats(MemoryStats &stats) const {
+  stats.add("FileManager", "file_id_info_", file_id_info_);
+  stats.add_entry("FileManager", "file_nodes_", file_nodes_.size(), file_nodes_.size() * sizeof(FileNode));
+  stats.add("FileManager", "local_location_to_file_id_", local_location_to_file_id_);
+  stats.add("FileManager", "generate_location_to_file_id_", generate_location_to_file_id_);
+  stats.add("FileManager", "pmc_id_to_file_node_id_", pmc_id_to_file_node_id_);
+}
+
 td_api::object_ptr<td_api::file> FileManager::get_file_object(FileId file_id, bool with_main_file_id) {
   auto file_view = get_sync_file_view(file_id);
 
@@ -3187,7 +3203,7 @@ void FileManager::on_download_ok(QueryId query_id, const FullLocalFileLocation &
     LOG(ERROR) << "Can't register local file after download: " << r_new_file_id.error();
   } else {
     if (is_new) {
-      context_->on_new_file(size, 1);
+      context_->on_new_file(local.file_type_, size, 1);
     }
     LOG_STATUS(merge(r_new_file_id.ok(), file_id));
   }
@@ -3354,7 +3370,7 @@ void FileManager::on_generate_ok(QueryId query_id, const FullLocalFileLocation &
 
   FileView file_view(file_node);
   if (!file_view.has_generate_location() || !begins_with(file_view.generate_location().conversion_, "#file_id#")) {
-    context_->on_new_file(file_view.size(), 1);
+    context_->on_new_file(file_view.get_type(), file_view.size(), 1);
   }
 
   run_upload(file_node, {});
@@ -47,6 +47,8 @@ extern int VERBOSITY_NAME(update_file);
 class FileData;
 class FileDbInterface;
 
+class MemoryStats;
+
 enum class FileLocationSource : int8 { None, FromUser, FromBinlog, FromDatabase, FromServer };
 
 struct NewRemoteFileLocation {
@@ -355,7 +357,7 @@ class FileManager : public FileLoadManager::Callback {
 
   class Context {
    public:
-    virtual void on_new_file(int64 size, int32 cnt) = 0;
+    virtual void on_new_file(FileType file_type, int64 size, int32 cnt) = 0;
 
     virtual void on_file_updated(FileId size) = 0;
 
@@ -440,6 +442,8 @@ class FileManager : public FileLoadManager::Callback {
   td_api::object_ptr<td_api::file> get_file_object(FileId file_id, bool with_main_file_id = true);
   vector<int32> get_file_ids_object(const vector<FileId> &file_ids, bool with_main_file_id = true);
 
+  void get_memory_stats(MemoryStats &stats) const;
+
   Result<FileId> get_input_thumbnail_file_id(const tl_object_ptr<td_api::InputFile> &thumb_input_file,
                                              DialogId owner_dialog_id, bool is_encrypted) TD_WARN_UNUSED_RESULT;
   Result<FileId> get_input_file_id(FileType type, const tl_object_ptr<td_api::InputFile> &file,
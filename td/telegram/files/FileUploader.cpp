@@ -160,6 +160,8 @@ Result<FileLoader::PrefixInfo> FileUploader::on_update_local_location(const Loca
       return res_fd.move_as_error();
     }
 
+    file_mapping_ = nullptr;
+    file_mapping_failed_ = false;
     fd_.close();
     fd_ = res_fd.move_as_ok();
     fd_path_ = path;
@@ -197,6 +199,7 @@ Result<FileLoader::PrefixInfo> FileUploader::on_update_local_location(const Loca
 }
 
 Status FileUploader::on_ok(int64 size) {
+  file_mapping_ = nullptr;
   fd_.close();
   if (is_temp_) {
     LOG(INFO) << "UNLINK " << fd_path_;
@@ -206,6 +209,7 @@ Status FileUploader::on_ok(int64 size) {
 }
 
 void FileUploader::on_error(Status status) {
+  file_mapping_ = nullptr;
   fd_.close();
   if (is_temp_) {
     LOG(INFO) << "UNLINK " << fd_path_;
@@ -214,7 +218,7 @@ void FileUploader::on_error(Status status) {
   callback_->on_error(std::move(status));
 }
 
-Status FileUploader::generate_iv_map() {
+Status FileUploader::generate_iv_map(int32 part_id) {
   LOG(INFO) << "Generate iv_map " << generate_offset_ << " " << local_size_;
   auto part_size = get_part_size();
   auto encryption_key = FileEncryptionKey(encryption_key_.key_slice(), generate_iv_);
@@ -223,7 +227,7 @@ Status FileUploader::generate_iv_map() {
     iv_map_.push_back(encryption_key.mutable_iv());
   }
   CHECK(!fd_.empty());
-  for (; generate_offset_ + static_cast<int64>(part_size) < local_size_;
+  for (; static_cast<int32>(iv_map_.size()) <= part_id && generate_offset_ + static_cast<int64>(part_size) < local_size_;
        generate_offset_ += static_cast<int64>(part_size)) {
     TRY_RESULT(read_size, fd_.pread(bytes.as_slice(), generate_offset_));
     if (read_size != part_size) {
@@ -248,25 +252,72 @@ void FileUploader::after_start_parts() {
   try_release_fd();
 }
 
+Slice FileUploader::get_mapped_part(Part part) {
+  if (!encryption_key_.is_secret() || !local_is_ready_) {
+    return Slice();
+  }
+  if (part.size % 16 != 0) {
+    // the last short part needs padding and is read the usual way
+    return Slice();
+  }
+  if (file_mapping_ == nullptr && !file_mapping_failed_) {
+    auto r_mapping = MemoryMapping::create_from_file(fd_, MemoryMapping::Options().with_sequential_access());
+    if (r_mapping.is_ok()) {
+      file_mapping_ = make_unique<MemoryMapping>(r_mapping.move_as_ok());
+    } else {
+      LOG(INFO) << "Can't mmap file: " << r_mapping.error();
+      file_mapping_failed_ = true;
+    }
+  }
+  if (file_mapping_ == nullptr) {
+    return Slice();
+  }
+  auto data = file_mapping_->as_slice();
+  if (part.offset + static_cast<int64>(part.size) > static_cast<int64>(data.size())) {
+    return Slice();
+  }
+  return data.substr(narrow_cast<size_t>(part.offset), part.size);
+}
+
 Result<std::pair<NetQueryPtr, bool>> FileUploader::start_part(Part part, int32 part_count) {
   auto padded_size = part.size;
   if (encryption_key_.is_secret()) {
     padded_size = (padded_size + 15) & ~15;
   }
   BufferSlice bytes(padded_size);
-  TRY_RESULT(size, fd_.pread(bytes.as_slice().truncate(part.size), part.offset));
+  // for secret files the part can be encrypted directly from the page cache
+  // into the outgoing buffer, skipping the pread copy
+  auto file_part = get_mapped_part(part);
+  size_t size = part.size;
+  if (file_part.empty()) {
+    TRY_RESULT(read_size, fd_.pread(bytes.as_slice().truncate(part.size), part.offset));
+    size = read_size;
+  }
   if (encryption_key_.is_secret()) {
+    auto from = file_part.empty() ? Slice(bytes.as_slice()) : file_part;
     Random::secure_bytes(bytes.as_slice().substr(part.size));
     if (next_offset_ == part.offset) {
-      aes_ige_encrypt(as_slice(encryption_key_.key()), as_slice(iv_), bytes.as_slice(), bytes.as_slice());
+      // remember the IV of every part encrypted in order: if the part is resent
+      // later, there will be no need to re-encrypt the whole prefix just to
+      // recover its IV
+      if (static_cast<int32>(iv_map_.size()) == part.id) {
+        iv_map_.push_back(iv_);
+      }
+      aes_ige_encrypt(as_slice(encryption_key_.key()), as_slice(iv_), from, bytes.as_slice());
       next_offset_ += static_cast<int64>(bytes.size());
+      if (static_cast<int32>(iv_map_.size()) == part.id + 1) {
+        iv_map_.push_back(iv_);
+        // keep generate_iv_map in sync, so it can continue the chain from here
+        generate_iv_ = as_slice(iv_).str();
+        generate_offset_ = next_offset_;
+      }
     } else {
       if (part.id >= static_cast<int32>(iv_map_.size())) {
-        TRY_STATUS(generate_iv_map());
+        TRY_STATUS(generate_iv_map(part.id));
       }
       CHECK(part.id < static_cast<int32>(iv_map_.size()) && part.id >= 0);
       auto iv = iv_map_[part.id];
-      aes_ige_encrypt(as_slice(encryption_key_.key()), as_slice(iv), bytes.as_slice(), bytes.as_slice());
+      aes_ige_encrypt(as_slice(encryption_key_.key()), as_slice(iv), from, bytes.as_slice());
     }
   }
 
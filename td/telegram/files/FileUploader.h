@@ -12,6 +12,8 @@
 #include "td/telegram/files/FileType.h"
 
 #include "td/utils/port/FileFd.h"
+#include "td/utils/port/MemoryMapping.h"
+#include "td/utils/Slice.h"
 #include "td/utils/Status.h"
 #include "td/utils/UInt.h"
 
@@ -58,6 +60,9 @@ class FileUploader : public FileLoader {
   int64 file_id_;
   bool big_flag_;
 
+  unique_ptr<MemoryMapping> file_mapping_;
+  bool file_mapping_failed_ = false;
+
   Result<FileInfo> init() override TD_WARN_UNUSED_RESULT;
   Status on_ok(int64 size) override TD_WARN_UNUSED_RESULT;
   void on_error(Status status) override;
@@ -70,7 +75,8 @@ class FileUploader : public FileLoader {
   Result<PrefixInfo> on_update_local_location(const LocalFileLocation &location,
                                               int64 file_size) override TD_WARN_UNUSED_RESULT;
 
-  Status generate_iv_map();
+  Status generate_iv_map(int32 part_id);
+  Slice get_mapped_part(Part part);
 
   bool keep_fd_ = false;
   void keep_fd_flag(bool keep_fd) override;
@@ -120,8 +120,12 @@ Status PartsManager::init(int64 size, int64 expected_size, bool is_size_final, s
       return Status::Error("FILE_UPLOAD_RESTART");
     }
   } else {
-    // TODO choose part_size_ depending on size
+    // choose part_size_ depending on size: bigger parts on big files cut per-part
+    // round trips, while small files still get a low-latency first part
     part_size_ = 64 * (1 << 10);
+    while (part_size_ < MAX_PART_SIZE && calc_part_count(expected_size_, part_size_) > DESIRED_PART_COUNT) {
+      part_size_ *= 2;
+    }
     while (use_part_count_limit && calc_part_count(expected_size_, part_size_) > MAX_PART_COUNT) {
       part_size_ *= 2;
       CHECK(part_size_ <= MAX_PART_SIZE);
@@ -53,8 +53,11 @@ class PartsManager {
   int64 get_streaming_offset() const;
   string get_bitmask();
 
+  bool is_part_in_streaming_limit(int part_i) const;
+
  private:
   static constexpr int MAX_PART_COUNT = 3000;
+  static constexpr int DESIRED_PART_COUNT = 128;
   static constexpr int MAX_PART_SIZE = 512 * (1 << 10);
   static constexpr int64 MAX_FILE_SIZE = MAX_PART_SIZE * MAX_PART_COUNT;
 
@@ -100,7 +103,6 @@ class PartsManager {
   void update_first_not_ready_part();
 
   bool is_streaming_limit_reached();
-  bool is_part_in_streaming_limit(int part_i) const;
 };
 
 }  // namespace td
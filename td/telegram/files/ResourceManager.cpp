@@ -98,7 +98,7 @@ void ResourceManager::add_to_heap(Node *node) {
   }
 }
 
-bool ResourceManager::satisfy_node(NodeId file_node_id) {
+bool ResourceManager::satisfy_node(NodeId file_node_id, int64 &budget) {
   auto file_node_ptr = nodes_container_.get(file_node_id);
   CHECK(file_node_ptr);
   auto file_node = (*file_node_ptr).get();
@@ -111,13 +111,14 @@ bool ResourceManager::satisfy_node(NodeId file_node_id) {
   if (need == 0) {
     return true;
   }
-  auto give = resource_state_.unused();
+  auto give = min(budget, resource_state_.unused());
   give = min(need, give);
   give -= give % part_size;
   VLOG(files) << tag("give", give);
   if (give == 0) {
     return false;
   }
+  budget -= give;
   resource_state_.start_use(give);
   file_node->resource_state_.update_limit(give);
   send_closure(file_node->callback_, &FileLoaderActor::update_resources, file_node->resource_state_);
@@ -132,9 +133,10 @@ void ResourceManager::loop() {
     return;
   }
   auto active_limit = resource_state_.active_limit();
-  resource_state_.update_limit(2 * 1024 * (1 << 10) - active_limit);
+  resource_state_.update_limit(resource_limit_ - active_limit);
   LOG(INFO) << tag("unused", resource_state_.unused());
 
+  bool hungry = false;
   if (mode_ == Mode::Greedy) {
     std::vector<Node *> to_add;
     while (!by_estimated_extra_.empty()) {
@@ -142,7 +144,9 @@ void ResourceManager::loop() {
       SCOPE_EXIT {
         to_add.push_back(node);
       };
-      if (!satisfy_node(node->node_id)) {
+      auto budget = resource_state_.unused();
+      if (!satisfy_node(node->node_id, budget)) {
+        hungry = true;
         break;
       }
     }
@@ -150,13 +154,51 @@ void ResourceManager::loop() {
       add_to_heap(node);
     }
   } else if (mode_ == Mode::Baseline) {
-    // plain
+    // interactive loads go first, in priority order, and may take the whole window
+    bool interactive_hungry = false;
     for (auto &it : to_xload_) {
-      auto file_node_id = it.second;
-      if (!satisfy_node(file_node_id)) {
+      if (get_priority_class(it.first) != PriorityClass::Interactive) {
+        continue;
+      }
+      auto budget = resource_state_.unused();
+      if (!satisfy_node(it.second, budget)) {
+        interactive_hungry = true;
         break;
       }
     }
+    // the remainder is split between the lower classes by weight; a hungry
+    // interactive load strictly preempts bulk, which then gets nothing at all
+    auto prefetch_budget = resource_state_.unused();
+    auto bulk_budget = interactive_hungry ? 0 : prefetch_budget;
+    if (prefetch_budget > 0 && bulk_budget > 0) {
+      prefetch_budget = prefetch_budget * PREFETCH_WEIGHT / (PREFETCH_WEIGHT + 1);
+      bulk_budget -= prefetch_budget;
+    }
+    for (auto &it : to_xload_) {
+      auto priority_class = get_priority_class(it.first);
+      if (priority_class == PriorityClass::Interactive) {
+        continue;
+      }
+      auto &budget = priority_class == PriorityClass::Prefetch ? prefetch_budget : bulk_budget;
+      if (!satisfy_node(it.second, budget)) {
+        // do not break: the other class may still have budget left
+        budget = 0;
+        hungry = true;
+      }
+    }
+    hungry |= interactive_hungry;
+  }
+
+  if (hungry) {
+    // the whole window is in flight and there is still demand, so the window is
+    // the bottleneck: widen it and distribute the surplus
+    if (resource_limit_ < MAX_RESOURCE_LIMIT) {
+      resource_limit_ = min(2 * resource_limit_, MAX_RESOURCE_LIMIT);
+      yield();
+    }
+  } else if (resource_limit_ > DEFAULT_RESOURCE_LIMIT && resource_state_.unused() >= resource_limit_ / 2) {
+    // demand has dropped; shrink back, so slow links aren't flooded
+    resource_limit_ = max(resource_limit_ / 2, DEFAULT_RESOURCE_LIMIT);
   }
 }
 void ResourceManager::add_node(NodeId node_id, int8 priority) {
@@ -31,6 +31,22 @@ class ResourceManager : public Actor {
  private:
   Mode mode_;
   using NodeId = uint64;
+
+  // loads are split into classes by their priority (1..32): user-visible loads
+  // must get their first bytes quickly, whatever background work is going on
+  enum class PriorityClass : int8 { Interactive, Prefetch, Bulk };
+  static PriorityClass get_priority_class(int8 priority) {
+    if (priority >= 16) {
+      return PriorityClass::Interactive;
+    }
+    if (priority >= 8) {
+      return PriorityClass::Prefetch;
+    }
+    return PriorityClass::Bulk;
+  }
+  // prefetch loads get PREFETCH_WEIGHT bytes for every byte given to bulk loads
+  static constexpr int64 PREFETCH_WEIGHT = 3;
+
   struct Node : public HeapNode {
     NodeId node_id;
 
@@ -45,10 +61,16 @@ class ResourceManager : public Actor {
     }
   };
 
+  // window of bytes the workers may keep in flight; it grows while it is the
+  // bottleneck, so one big file transfer can saturate a fast connection
+  static constexpr int64 DEFAULT_RESOURCE_LIMIT = 2 * 1024 * (1 << 10);
+  static constexpr int64 MAX_RESOURCE_LIMIT = 32 * 1024 * (1 << 10);
+
   Container<unique_ptr<Node>> nodes_container_;
   vector<std::pair<int8, NodeId>> to_xload_;
   KHeap<int64> by_estimated_extra_;
   ResourceState resource_state_;
+  int64 resource_limit_ = DEFAULT_RESOURCE_LIMIT;
 
   ActorShared<> parent_;
   bool stop_flag_ = false;
@@ -58,7 +80,7 @@ class ResourceManager : public Actor {
   void loop() override;
 
   void add_to_heap(Node *node);
-  bool satisfy_node(NodeId file_node_id);
+  bool satisfy_node(NodeId file_node_id, int64 &budget);
   void add_node(NodeId node_id, int8 priority);
   bool remove_node(NodeId node_id);
 };
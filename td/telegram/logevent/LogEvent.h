@@ -22,6 +22,7 @@
 #include "td/utils/tl_parsers.h"
 #include "td/utils/tl_storers.h"
 
+#include <limits>
 #include <type_traits>
 
 namespace td {
@@ -167,13 +168,16 @@ class StorerImpl : public Storer {
   }
 
   size_t size() const override {
-    WithContext<TlStorerCalcLength, Global *> storer;
-    storer.set_context(G());
-
-    storer.store_int(T::version());
-    td::store(magic(event_), storer);
-    td::store(event_, storer);
-    return storer.get_length();
+    if (size_ == std::numeric_limits<size_t>::max()) {
+      WithContext<TlStorerCalcLength, Global *> storer;
+      storer.set_context(G());
+
+      storer.store_int(T::version());
+      td::store(magic(event_), storer);
+      td::store(event_, storer);
+      size_ = storer.get_length();
+    }
+    return size_;
   }
   size_t store(uint8 *ptr) const override {
     WithContext<TlStorerUnsafe, Global *> storer(ptr);
@@ -186,6 +190,7 @@ class StorerImpl : public Storer {
   }
 
  private:
+  mutable size_t size_ = std::numeric_limits<size_t>::max();
   const T &event_;
 };
 
@@ -253,9 +258,12 @@ class LogEventStorerImpl : public Storer {
   }
 
   size_t size() const override {
-    LogEventStorerCalcLength storer;
-    td::store(event_, storer);
-    return storer.get_length();
+    if (size_ == std::numeric_limits<size_t>::max()) {
+      LogEventStorerCalcLength storer;
+      td::store(event_, storer);
+      size_ = storer.get_length();
+    }
+    return size_;
   }
   size_t store(uint8 *ptr) const override {
     LogEventStorerUnsafe storer(ptr);
@@ -268,6 +276,7 @@ class LogEventStorerImpl : public Storer {
   }
 
  private:
+  mutable size_t size_ = std::numeric_limits<size_t>::max();
   const T &event_;
 };
 
@@ -286,6 +286,10 @@ ActorId<GetHostByNameActor> ConnectionCreator::get_dns_resolver() {
       VLOG(connections) << "Init DNS resolver";
       GetHostByNameActor::Options options;
       options.scheduler_id = G()->get_gc_scheduler_id();
+      // fall back to DNS over HTTPS when plain DNS fails: in networks which silently
+      // filter DNS this is the difference between connecting and running through the
+      // whole reconnect backoff ladder
+      options.resolver_types = {GetHostByNameActor::ResolverType::Native, GetHostByNameActor::ResolverType::Google};
       options.ok_timeout = 5 * 60 - 1;
       options.error_timeout = 0;
       get_host_by_name_actor_ = create_actor<GetHostByNameActor>("DnsResolverActor", std::move(options));
@@ -586,6 +590,44 @@ void ConnectionCreator::on_pong(size_t hash) {
       save_proxy_last_used_date(MAX_PROXY_LAST_USED_SAVE_DELAY);
     }
   }
+  save_dc_options_stats();
+}
+
+void ConnectionCreator::save_dc_options_stats() {
+  string value;
+  for (auto &ip_address : dc_options_set_.get_ok_ip_addresses()) {
+    value += PSTRING() << ip_address.get_ip_str() << ' ' << ip_address.get_port() << '\n';
+  }
+  if (value == saved_dc_options_stats_) {
+    return;
+  }
+  saved_dc_options_stats_ = std::move(value);
+  G()->td_db()->get_binlog_pmc()->set("dc_options_stats", saved_dc_options_stats_);
+}
+
+void ConnectionCreator::load_dc_options_stats() {
+  saved_dc_options_stats_ = G()->td_db()->get_binlog_pmc()->get("dc_options_stats");
+  vector<IPAddress> ip_addresses;
+  for (auto line : full_split(Slice(saved_dc_options_stats_), '\n')) {
+    auto space_pos = line.find(' ');
+    if (space_pos == Slice::npos) {
+      continue;
+    }
+    auto r_port = to_integer_safe<int32>(line.substr(space_pos + 1));
+    if (r_port.is_error()) {
+      continue;
+    }
+    auto ip_str = line.substr(0, space_pos).str();
+    IPAddress ip_address;
+    auto status = ip_str.find(':') != string::npos ? ip_address.init_ipv6_port(ip_str, r_port.ok())
+                                                  : ip_address.init_ipv4_port(ip_str, r_port.ok());
+    if (status.is_error()) {
+      continue;
+    }
+    ip_addresses.push_back(ip_address);
+  }
+  // let the first connection after launch prefer the previously working options
+  dc_options_set_.restore_ok_ip_addresses(ip_addresses);
 }
 
 void ConnectionCreator::on_mtproto_error(size_t hash) {
@@ -851,9 +893,18 @@ void ConnectionCreator::client_loop(ClientInfo &client) {
         return;
       }
     } else {
-      if (client.pending_connections >= client.queries.size()) {
+      if (client.pending_connections >= client.queries.size() + ClientInfo::MAX_EXTRA_PENDING_CONNECTIONS) {
         return;
       }
+      if (client.pending_connections >= client.queries.size()) {
+        // all queries have a pending connection; if it doesn't succeed quickly,
+        // race an additional staggered attempt through another DC option
+        // instead of waiting out the timeout of a possibly blackholed one
+        auto extra_connection_at = client.last_connection_start_time + ClientInfo::EXTRA_CONNECTION_DELAY;
+        if (extra_connection_at > Time::now()) {
+          return client_set_timeout_at(client, extra_connection_at);
+        }
+      }
     }
 
     // Check flood
@@ -893,6 +944,7 @@ void ConnectionCreator::client_loop(ClientInfo &client) {
     }
 
     client.pending_connections++;
+    client.last_connection_start_time = Time::now();
     if (check_mode) {
       if (extra.stat) {
         extra.stat->on_check();
@@ -1016,6 +1068,15 @@ void ConnectionCreator::client_wakeup(size_t hash) {
 void ConnectionCreator::on_dc_options(DcOptions new_dc_options) {
   LOG(INFO) << "SAVE " << new_dc_options;
   G()->td_db()->get_binlog_pmc()->set("dc_options", serialize(new_dc_options));
+  // register known media DCs right away: DcAuthManager then exports and imports authorization
+  // for them in the background once the main DC is authorized, so the first file query to such
+  // a DC doesn't pay for the key exchange and the authorization round trips
+  for (auto &dc_option : new_dc_options.dc_options) {
+    auto dc_id = dc_option.get_dc_id();
+    if (dc_id.is_internal() && dc_option.is_media_only()) {
+      G()->net_query_dispatcher().update_valid_dc(dc_id);
+    }
+  }
   dc_options_set_.reset();
   dc_options_set_.add_dc_options(get_default_dc_options(G()->is_test_dc()));
 #if !TD_EMSCRIPTEN  // FIXME
@@ -1074,6 +1135,7 @@ void ConnectionCreator::start_up() {
   } else {
     on_dc_options(std::move(dc_options));
   }
+  load_dc_options_stats();
 
   auto proxy_info = G()->td_db()->get_binlog_pmc()->prefix_get("proxy");
   auto it = proxy_info.find("proxy_max_id");
@@ -101,6 +101,7 @@ class ConnectionCreator : public NetQueryCallback {
  private:
   ActorShared<> parent_;
   DcOptionsSet dc_options_set_;
+  string saved_dc_options_stats_;
   bool network_flag_ = false;
   uint32 network_generation_ = 0;
   bool online_flag_ = false;
@@ -156,10 +157,13 @@ class ConnectionCreator : public NetQueryCallback {
     Slot slot;
     size_t pending_connections{0};
     size_t checking_connections{0};
+    double last_connection_start_time{0};
     std::vector<std::pair<unique_ptr<mtproto::RawConnection>, double>> ready_connections;
     std::vector<Promise<unique_ptr<mtproto::RawConnection>>> queries;
 
     static constexpr double READY_CONNECTIONS_TIMEOUT = 10;
+    static constexpr double EXTRA_CONNECTION_DELAY = 0.25;
+    static constexpr size_t MAX_EXTRA_PENDING_CONNECTIONS = 2;
 
     bool inited{false};
     size_t hash{0};
@@ -210,6 +214,8 @@ class ConnectionCreator : public NetQueryCallback {
   void on_result(NetQueryPtr query) override;
 
   void save_dc_options();
+  void save_dc_options_stats();
+  void load_dc_options_stats();
   Result<SocketFd> do_request_connection(DcId dc_id, bool allow_media_only);
   Result<std::pair<unique_ptr<mtproto::RawConnection>, bool>> do_request_raw_connection(DcId dc_id,
                                                                                         bool allow_media_only,
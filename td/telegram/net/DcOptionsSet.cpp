@@ -166,6 +166,26 @@ void DcOptionsSet::reset() {
   ordered_options_.clear();
 }
 
+vector<IPAddress> DcOptionsSet::get_ok_ip_addresses() {
+  vector<IPAddress> result;
+  for (auto &it : option_to_stat_id_) {
+    if ((*option_stats_.get(it.second))->tcp_stat.is_ok()) {
+      result.push_back(it.first);
+    }
+  }
+  return result;
+}
+
+void DcOptionsSet::restore_ok_ip_addresses(const vector<IPAddress> &ip_addresses) {
+  for (auto &ip_address : ip_addresses) {
+    auto it_ok = option_to_stat_id_.insert(std::make_pair(ip_address, 0));
+    if (it_ok.second) {
+      it_ok.first->second = option_stats_.create(make_unique<OptionStat>());
+    }
+    (*option_stats_.get(it_ok.first->second))->tcp_stat.on_ok();
+  }
+}
+
 DcOptionsSet::DcOptionInfo *DcOptionsSet::register_dc_option(DcOption &&option) {
   auto info = make_unique<DcOptionInfo>(std::move(option), options_.size());
   init_option_stat(info.get());
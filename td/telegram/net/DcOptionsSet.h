@@ -68,6 +68,11 @@ class DcOptionsSet {
                                          bool only_http);
   void reset();
 
+  // the stats are kept only in memory; these methods allow the owner to save
+  // the addresses of the known good options and to restore them after restart
+  vector<IPAddress> get_ok_ip_addresses();
+  void restore_ok_ip_addresses(const vector<IPAddress> &ip_addresses);
+
  private:
   enum class State : int32 { Error, Ok, Checking };
 
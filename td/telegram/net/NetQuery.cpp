@@ -7,6 +7,7 @@
 #include "td/telegram/net/NetQuery.h"
 
 #include "td/telegram/Global.h"
+#include "td/telegram/net/NetQueryStats.h"
 #include "td/telegram/telegram_api.h"
 
 #include "td/utils/as.h"
@@ -15,8 +16,6 @@
 
 namespace td {
 
-ListNode net_query_list_;
-
 int32 NetQuery::get_my_id() {
   return G()->get_my_id();
 }
@@ -64,29 +63,29 @@ void NetQuery::set_error(Status status, string source) {
   set_error_impl(std::move(status), std::move(source));
 }
 
+void NetQuery::on_answered() {
+  answer_timestamp_ = Time::now();
+  if (state_ == State::Error && status_.code() >= 200 && status_.code() <= Error::ResendInvokeAfter) {
+    // resends and cancellations aren't server answers
+    return;
+  }
+  NetQueryStats::get_default().on_query_answered(*this);
+}
+
+void NetQuery::register_in_stats() {
+  NetQueryStats::get_default().register_query(this);
+}
+
+void NetQuery::unregister_from_stats() {
+  NetQueryStats::get_default().unregister_query(this);
+}
+
 void dump_pending_network_queries() {
-  auto n = NetQueryCounter::get_count();
-  LOG(WARNING) << tag("pending net queries", n);
+  LOG(WARNING) << tag("pending net queries", NetQueryCounter::get_count());
 
-  decltype(n) i = 0;
-  bool was_gap = false;
-  for (auto end = &net_query_list_, cur = end->prev; cur != end; cur = cur->prev, i++) {
-    if (i < 20 || i + 20 > n || i % (n / 20 + 1) == 0) {
-      if (was_gap) {
-        LOG(WARNING) << "...";
-        was_gap = false;
-      }
-      auto nq = &static_cast<NetQuery &>(*cur);
-      LOG(WARNING) << tag("id", nq->my_id_) << *nq << tag("total_flood", format::as_time(nq->total_timeout)) << " "
-                   << tag("since start", format::as_time(Time::now_cached() - nq->start_timestamp_))
-                   << tag("state", nq->debug_str_)
-                   << tag("since state", format::as_time(Time::now_cached() - nq->debug_timestamp_))
-                   << tag("resend_cnt", nq->debug_resend_cnt_) << tag("fail_cnt", nq->debug_send_failed_cnt_)
-                   << tag("ack", nq->debug_ack) << tag("unknown", nq->debug_unknown);
-    } else {
-      was_gap = true;
-    }
-  }
+  auto &stats = NetQueryStats::get_default();
+  stats.dump_pending_queries();
+  stats.dump();
 }
 
 }  // namespace td
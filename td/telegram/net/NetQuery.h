@@ -40,8 +40,6 @@ class NetQueryCallback : public Actor {
   virtual void on_result_resendable(NetQueryPtr query, Promise<NetQueryPtr> promise);
 };
 
-extern ListNode net_query_list_;
-
 class NetQuery : public ListNode {
  public:
   NetQuery() = default;
@@ -128,6 +126,7 @@ class NetQuery : public ListNode {
     CHECK(state_ == State::Query);
     answer_ = std::move(slice);
     state_ = State::OK;
+    on_answered();
   }
 
   void on_net_write(size_t size);
@@ -215,6 +214,7 @@ class NetQuery : public ListNode {
   void clear() {
     LOG_IF(ERROR, !is_ready()) << "Destroy not ready query " << *this << " " << tag("debug", debug_str_);
     // TODO: CHECK if net_query is lost here
+    unregister_from_stats();
     cancel_slot_.close();
     *this = NetQuery();
   }
@@ -224,7 +224,7 @@ class NetQuery : public ListNode {
 
   void stop_track() {
     nq_counter_ = NetQueryCounter();
-    remove();
+    unregister_from_stats();
   }
 
   void debug_send_failed() {
@@ -303,8 +303,13 @@ class NetQuery : public ListNode {
     status_ = std::move(status);
     state_ = State::Error;
     source_ = std::move(source);
+    on_answered();
   }
 
+  void on_answered();
+  void register_in_stats();
+  void unregister_from_stats();
+
  public:
   double next_timeout = 1;
   double total_timeout = 0;
@@ -326,6 +331,10 @@ class NetQuery : public ListNode {
   int32 file_type_ = -1;
 
   double start_timestamp_ = 0;
+  double dispatch_timestamp_ = 0;
+  double send_timestamp_ = 0;
+  double ack_timestamp_ = 0;
+  double answer_timestamp_ = 0;
   int32 my_id_ = 0;
   NetQueryCounter nq_counter_;
 
@@ -345,7 +354,7 @@ class NetQuery : public ListNode {
     my_id_ = get_my_id();
     start_timestamp_ = Time::now();
     LOG(INFO) << *this;
-    // net_query_list_.put(this);
+    register_in_stats();
   }
 };
 
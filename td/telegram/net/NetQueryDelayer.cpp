@@ -13,8 +13,10 @@
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
+#include "td/utils/Random.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
+#include "td/utils/Time.h"
 
 namespace td {
 
@@ -52,6 +54,19 @@ void NetQueryDelayer::delay(NetQueryPtr query) {
   } else {
     query->next_timeout = 1;
   }
+
+  if (code == 420) {
+    // queries of one method which trip the same limit must not retry in lockstep;
+    // share the latest flood wait window between them and spread the wakeups
+    auto &flood_wait_until = flood_wait_until_[{query->tl_constructor(), query->dc_id().get_raw_id()}];
+    auto now = Time::now();
+    if (now + timeout >= flood_wait_until) {
+      flood_wait_until = now + timeout;
+    } else {
+      timeout = flood_wait_until - now;
+    }
+    timeout += Random::fast(0, 1000) * 0.001;
+  }
   query->total_timeout += timeout;
   query->last_timeout = timeout;
 
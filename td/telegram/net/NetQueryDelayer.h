@@ -13,6 +13,9 @@
 
 #include "td/utils/Container.h"
 
+#include <map>
+#include <utility>
+
 namespace td {
 
 class NetQueryDelayer : public Actor {
@@ -27,6 +30,7 @@ class NetQueryDelayer : public Actor {
     Slot timeout_;
   };
   Container<QuerySlot> container_;
+  std::map<std::pair<int32, int32>, double> flood_wait_until_;  // (tl_constructor, DC) -> window end time
   ActorShared<> parent_;
   void wakeup() override;
 
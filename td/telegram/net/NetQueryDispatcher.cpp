@@ -25,6 +25,7 @@
 #include "td/utils/misc.h"
 #include "td/utils/port/thread.h"
 #include "td/utils/Slice.h"
+#include "td/utils/Time.h"
 
 namespace td {
 
@@ -41,6 +42,7 @@ void NetQueryDispatcher::complete_net_query(NetQueryPtr net_query) {
 
 void NetQueryDispatcher::dispatch(NetQueryPtr net_query) {
   net_query->debug("dispatch");
+  net_query->dispatch_timestamp_ = Time::now();
   if (stop_flag_.load(std::memory_order_relaxed)) {
     if (net_query->id() != 0) {
       net_query->set_error(Status::Error(500, "Request aborted"));
@@ -122,7 +124,9 @@ Status NetQueryDispatcher::wait_dc_init(DcId dc_id, bool force) {
   auto &dc = dcs_[pos];
 
   bool should_init = false;
-  if (!dc.is_valid_) {
+  // the fast path for an already inited DC is lock-free: it only needs to observe
+  // the sessions published by the release store to is_inited_ below
+  if (!dc.is_valid_.load(std::memory_order_acquire)) {
     if (!force) {
       return Status::Error("Invalid DC");
     }
@@ -170,12 +174,12 @@ Status NetQueryDispatcher::wait_dc_init(DcId dc_id, bool force) {
     dc.download_small_session_ = create_actor_on_scheduler<SessionMultiProxy>(
         PSLICE() << "SessionMultiProxy:" << raw_dc_id << ":download_small", slow_net_scheduler_id,
         download_small_session_count, auth_data, false, use_pfs, true, true, is_cdn, need_destroy_key);
-    dc.is_inited_ = true;
+    dc.is_inited_.store(true, std::memory_order_release);
     if (dc_id.is_internal()) {
       send_closure_later(dc_auth_manager_, &DcAuthManager::add_dc, std::move(auth_data));
     }
   } else {
-    while (!dc.is_inited_) {
+    while (!dc.is_inited_.load(std::memory_order_acquire)) {
       if (stop_flag_.load(std::memory_order_relaxed)) {
         return Status::Error("Closing");
       }
@@ -0,0 +1,130 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/net/NetQueryStats.h"
+
+#include "td/telegram/net/NetQuery.h"
+
+#include "td/utils/format.h"
+#include "td/utils/logging.h"
+#include "td/utils/Time.h"
+
+namespace td {
+
+NetQueryStats &NetQueryStats::get_default() {
+  static NetQueryStats stats;
+  return stats;
+}
+
+static size_t get_latency_bucket(double latency, size_t bucket_count) {
+  auto ms = latency * 1e3;
+  size_t pos = 0;
+  while (pos + 1 < bucket_count && ms >= 1) {
+    ms *= 0.5;
+    pos++;
+  }
+  return pos;
+}
+
+void NetQueryStats::on_query_answered(const NetQuery &query) {
+  auto tl_constructor = query.tl_constructor();
+  if (tl_constructor == 0 || query.start_timestamp_ <= 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto &stats = stats_[tl_constructor];
+  stats.count++;
+  if (query.dispatch_timestamp_ > 0) {
+    stats.dispatch_total += query.dispatch_timestamp_ - query.start_timestamp_;
+    if (query.send_timestamp_ > 0) {
+      stats.send_total += query.send_timestamp_ - query.dispatch_timestamp_;
+      if (query.ack_timestamp_ > 0) {
+        stats.ack_total += query.ack_timestamp_ - query.send_timestamp_;
+      }
+      stats.answer_total += query.answer_timestamp_ - query.send_timestamp_;
+    }
+  }
+  stats.buckets[get_latency_bucket(query.answer_timestamp_ - query.start_timestamp_, BUCKET_COUNT)]++;
+}
+
+void NetQueryStats::dump() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (const auto &it : stats_) {
+    const auto &stats = it.second;
+    auto count = static_cast<double>(stats.count);
+    uint64 answered = 0;
+    size_t p99_bucket = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+      answered += stats.buckets[i];
+      if (answered * 100 >= stats.count * 99) {
+        p99_bucket = i;
+        break;
+      }
+    }
+    LOG(WARNING) << tag("method", format::as_hex(it.first)) << tag("count", stats.count)
+                 << tag("avg dispatch", format::as_time(stats.dispatch_total / count))
+                 << tag("avg send", format::as_time(stats.send_total / count))
+                 << tag("avg ack", format::as_time(stats.ack_total / count))
+                 << tag("avg answer", format::as_time(stats.answer_total / count))
+                 << tag("p99", format::as_time((1 << p99_bucket) * 1e-3));
+  }
+}
+
+void NetQueryStats::set_query_tracking(bool is_enabled) {
+  track_queries_.store(is_enabled, std::memory_order_relaxed);
+}
+
+void NetQueryStats::register_query(NetQuery *query) {
+  if (!track_queries_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(queries_mutex_);
+  queries_.put(query);
+}
+
+void NetQueryStats::unregister_query(NetQuery *query) {
+  if (!track_queries_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(queries_mutex_);
+  query->remove();
+}
+
+void NetQueryStats::dump_pending_queries() {
+  if (!track_queries_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(queries_mutex_);
+  uint64 n = 0;
+  for (auto end = &queries_, cur = end->prev; cur != end; cur = cur->prev) {
+    n++;
+  }
+  LOG(WARNING) << tag("tracked pending net queries", n);
+
+  uint64 i = 0;
+  bool was_gap = false;
+  for (auto end = &queries_, cur = end->prev; cur != end; cur = cur->prev, i++) {
+    if (i < DUMP_LIMIT || i + DUMP_LIMIT > n || i % (n / DUMP_LIMIT + 1) == 0) {
+      if (was_gap) {
+        LOG(WARNING) << "...";
+        was_gap = false;
+      }
+      auto nq = &static_cast<NetQuery &>(*cur);
+      LOG(WARNING) << tag("id", nq->my_id_) << *nq << tag("dc", nq->dc_id())
+                   << tag("total_flood", format::as_time(nq->total_timeout)) << " "
+                   << tag("since start", format::as_time(Time::now_cached() - nq->start_timestamp_))
+                   << tag("state", nq->debug_str_)
+                   << tag("since state", format::as_time(Time::now_cached() - nq->debug_timestamp_))
+                   << tag("resend_cnt", nq->debug_resend_cnt_) << tag("fail_cnt", nq->debug_send_failed_cnt_)
+                   << tag("ack", nq->debug_ack) << tag("unknown", nq->debug_unknown);
+    } else {
+      was_gap = true;
+    }
+  }
+}
+
+}  // namespace td
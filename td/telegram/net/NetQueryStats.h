@@ -0,0 +1,68 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/FlatHashMap.h"
+#include "td/utils/List.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace td {
+
+class NetQuery;
+
+// Aggregates latency of answered network queries by TL method. Every query
+// carries timestamps of its creation, dispatch, send, ack and answer, so the
+// per-method averages show whether time is lost before the dispatcher, in the
+// session queue, on the wire or in server processing, and the histogram of
+// creation-to-answer latency gives percentiles. Updated once per answer under
+// a mutex and queryable at any time through dump_pending_network_queries.
+class NetQueryStats {
+ public:
+  static NetQueryStats &get_default();
+
+  void on_query_answered(const NetQuery &query);
+
+  void dump() const;
+
+  // Keeps a linked list of all live queries, so a stuck query can be found by
+  // method, DC, state and age without a debugger. Must be enabled before the
+  // first query is created and not changed afterwards; tracked queries
+  // unregister through the same mutex, untracked ones never touch it.
+  void set_query_tracking(bool is_enabled);
+
+  void register_query(NetQuery *query);
+  void unregister_query(NetQuery *query);
+
+  void dump_pending_queries();
+
+ private:
+  static constexpr uint64 DUMP_LIMIT = 20;  // full head and tail, the middle is sampled
+
+  static constexpr size_t BUCKET_COUNT = 20;  // bucket i holds latencies below 2^i milliseconds
+
+  struct MethodStats {
+    uint64 count = 0;
+    double dispatch_total = 0;  // creation -> dispatch
+    double send_total = 0;      // dispatch -> send
+    double ack_total = 0;       // send -> ack
+    double answer_total = 0;    // send -> answer
+    std::array<uint64, BUCKET_COUNT> buckets{};
+  };
+
+  mutable std::mutex mutex_;
+  FlatHashMap<int32, MethodStats> stats_;
+
+  std::atomic<bool> track_queries_{false};
+  std::mutex queries_mutex_;
+  ListNode queries_;
+};
+
+}  // namespace td
@@ -30,6 +30,7 @@
 #include "td/utils/misc.h"
 #include "td/utils/Random.h"
 #include "td/utils/Slice.h"
+#include "td/utils/ThreadSafeCounter.h"
 #include "td/utils/Time.h"
 #include "td/utils/Timer.h"
 #include "td/utils/tl_parsers.h"
@@ -188,6 +189,10 @@ void Session::on_network(bool network_flag, uint32 network_generation) {
   network_flag_ = network_flag;
   if (network_generation_ != network_generation) {
     network_generation_ = network_generation;
+    // only the transports are dropped on a network switch: auth_data_ keeps the auth keys,
+    // server salts, time difference and session_id, on_closed re-queues the queries that were
+    // sent without an ack, and loop() reconnects, so recovery costs a socket setup, not a
+    // re-handshake
     connection_close(&main_connection_);
     connection_close(&long_poll_connection_);
   }
@@ -369,6 +374,8 @@ Status Session::on_pong() {
           if (status.is_ok()) {
             status = Status::Error(PSLICE() << "No answer for " << query->query << " for "
                                             << format::as_time(Time::now_cached() - query->sent_at_));
+            // timeouts are the strongest congestion signal there is
+            query_window_ = td::max(QUERY_WINDOW_MIN, query_window_ / 2);
           }
           query->ack = false;
         } else {
@@ -549,8 +556,10 @@ void Session::on_message_ack_impl_inner(uint64 id, int32 type, bool in_container
     return;
   }
   VLOG(net_query) << "Ack " << tag("msg_id", id) << it->second.query;
+  on_query_acked(&it->second);
   it->second.ack = true;
   it->second.query->debug_ack |= type;
+  it->second.query->ack_timestamp_ = Time::now_cached();
   it->second.query->quick_ack_promise_.set_value(Unit());
   if (!in_container) {
     cleanup_container(id, &it->second);
@@ -558,6 +567,31 @@ void Session::on_message_ack_impl_inner(uint64 id, int32 type, bool in_container
   mark_as_known(it->first, &it->second);
 }
 
+void Session::on_query_acked(Query *query) {
+  if (query->ack) {
+    return;
+  }
+  auto rtt = Time::now_cached() - query->sent_at_;
+  if (rtt < 0) {
+    return;
+  }
+  if (min_rtt_ < 0 || rtt < min_rtt_) {
+    min_rtt_ = rtt;
+  }
+  if (rtt > 2 * min_rtt_ + 0.1) {
+    // the queueing delay is growing, so the link can't keep up with the current window.
+    // Back off, but at most once per round trip
+    if (Time::now_cached() - last_query_window_decrease_at_ > rtt) {
+      last_query_window_decrease_at_ = Time::now_cached();
+      query_window_ = td::max(QUERY_WINDOW_MIN, query_window_ * 3 / 4);
+      VLOG(net_query) << "Decrease query window to " << query_window_ << tag("rtt", rtt) << tag("min_rtt", min_rtt_);
+    }
+  } else if (sent_queries_.size() + 1 >= query_window_ && query_window_ < QUERY_WINDOW_MAX) {
+    // the window is the bottleneck and the link keeps up: probe for more
+    query_window_++;
+  }
+}
+
 void Session::dec_container(uint64 message_id, Query *query) {
   if (query->container_id == message_id) {
     // message was sent without any container
@@ -608,6 +642,9 @@ void Session::mark_as_unknown(uint64 id, Query *query) {
 }
 
 Status Session::on_message_result_ok(uint64 id, BufferSlice packet, size_t original_size) {
+  static auto result_ok_counter = NamedThreadSafeCounter::get_default().get_counter("session_query_results_ok");
+  result_ok_counter.add(1);
+
   // Steal authorization information.
   // It is a dirty hack, yep.
   TlParser parser(packet.as_slice());
@@ -659,6 +696,9 @@ Status Session::on_message_result_ok(uint64 id, BufferSlice packet, size_t origi
 }
 
 void Session::on_message_result_error(uint64 id, int error_code, BufferSlice message) {
+  static auto result_error_counter = NamedThreadSafeCounter::get_default().get_counter("session_query_results_error");
+  result_error_counter.add(1);
+
   // UNAUTHORIZED
   if (error_code == 401 && message.as_slice() != CSlice("SESSION_PASSWORD_NEEDED")) {
     if (auth_data_.use_pfs() && message.as_slice() == CSlice("AUTH_KEY_PERM_EMPTY")) {
@@ -820,6 +860,9 @@ void Session::add_query(NetQueryPtr &&net_query) {
 }
 
 void Session::connection_send_query(ConnectionInfo *info, NetQueryPtr &&net_query, uint64 message_id) {
+  static auto send_query_counter = NamedThreadSafeCounter::get_default().get_counter("session_queries_sent");
+  send_query_counter.add(1);
+
   net_query->debug("Session: trying to send to mtproto::connection");
   CHECK(info->state == ConnectionInfo::State::Ready);
   current_info_ = info;
@@ -860,6 +903,7 @@ void Session::connection_send_query(ConnectionInfo *info, NetQueryPtr &&net_quer
   LOG_CHECK(sent_queries_.find(message_id) == sent_queries_.end()) << message_id;
   net_query->debug_unknown = false;
   net_query->debug_ack = 0;
+  net_query->send_timestamp_ = Time::now_cached();
   if (!net_query->cancel_slot_.empty()) {
     LOG(DEBUG) << "Set event for net_query cancellation " << tag("message_id", format::as_hex(message_id));
     net_query->cancel_slot_.set_event(EventCreator::raw(actor_id(), message_id));
@@ -1200,12 +1244,14 @@ void Session::loop() {
     while (main_connection_.state == ConnectionInfo::State::Ready) {
       if (auth_data_.is_ready(Time::now_cached())) {
         if (need_send_query()) {
-          while (!pending_queries_.empty()) {
+          // the query window limits how deep the pipe is: big enough to keep a high-latency
+          // link busy, but not so deep that a congested link runs into timeouts
+          while (!pending_queries_.empty() && sent_queries_.size() < query_window_) {
             auto &query = pending_queries_.front();
             connection_send_query(&main_connection_, std::move(query));
             pending_queries_.pop_front();
+            need_flush = true;
           }
-          need_flush = true;
         }
         if (need_send_bind_key()) {
           // send auth.bindTempAuthKey
@@ -126,6 +126,13 @@ class Session final
   std::deque<NetQueryPtr> pending_invoke_after_queries_;
   ListNode sent_queries_list_;
 
+  // congestion-window-style limit on the number of queries in flight
+  static constexpr size_t QUERY_WINDOW_MIN = 16;
+  static constexpr size_t QUERY_WINDOW_MAX = 1024;
+  size_t query_window_ = QUERY_WINDOW_MIN;
+  double min_rtt_ = -1;
+  double last_query_window_decrease_at_ = 0;
+
   struct ConnectionInfo {
     int8 connection_id;
     Mode mode;
@@ -208,6 +215,7 @@ class Session final
 
   void on_message_ack_impl(uint64 id, int32 type);
   void on_message_ack_impl_inner(uint64 id, int32 type, bool in_container);
+  void on_query_acked(Query *query);
   void on_message_failed_inner(uint64 id, bool in_container);
 
   // send NetQueryPtr to parent
@@ -12,6 +12,7 @@
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/Slice.h"
+#include "td/utils/Time.h"
 
 #include <algorithm>
 
@@ -40,16 +41,24 @@ void SessionMultiProxy::send(NetQueryPtr query) {
   size_t pos = 0;
   // TODO temporary hack with total_timeout_limit
   if (query->auth_flag() == NetQuery::AuthFlag::On && query->total_timeout_limit > 50) {
+    auto min_pos = static_cast<size_t>(
+        std::min_element(sessions_.begin(), sessions_.end(),
+                         [](const auto &a, const auto &b) { return a.queries_count < b.queries_count; }) -
+        sessions_.begin());
+    if (sessions_[min_pos].queries_count >= QUERIES_PER_SESSION &&
+        static_cast<int32>(sessions_.size()) < max_session_count()) {
+      add_session();
+      min_pos = sessions_.size() - 1;
+    }
     if (query->session_rand()) {
       pos = query->session_rand() % sessions_.size();
     } else {
-      pos = std::min_element(sessions_.begin(), sessions_.end(),
-                             [](const auto &a, const auto &b) { return a.queries_count < b.queries_count; }) -
-            sessions_.begin();
+      pos = min_pos;
     }
   }
   query->debug(PSTRING() << get_name() << ": send to proxy #" << pos);
   sessions_[pos].queries_count++;
+  sessions_[pos].last_activity_at = Time::now();
   send_closure(sessions_[pos].proxy, &SessionProxy::send, std::move(query));
 }
 
@@ -114,35 +123,65 @@ bool SessionMultiProxy::get_pfs_flag() const {
   return use_pfs_;
 }
 
+int32 SessionMultiProxy::min_session_count() const {
+  return is_main_ ? session_count_ : 1;
+}
+
+int32 SessionMultiProxy::max_session_count() const {
+  return session_count_;
+}
+
 void SessionMultiProxy::init() {
   sessions_generation_++;
   sessions_.clear();
   if (is_main_) {
     LOG(WARNING) << tag("session_count", session_count_);
   }
-  for (int32 i = 0; i < session_count_; i++) {
-    string name = PSTRING() << "Session" << get_name().substr(Slice("SessionMulti").size())
-                            << format::cond(session_count_ > 1, format::concat("#", i));
-
-    SessionInfo info;
-    class Callback : public SessionProxy::Callback {
-     public:
-      Callback(ActorId<SessionMultiProxy> parent, uint32 generation, int32 session_id)
-          : parent_(parent), generation_(generation), session_id_(session_id) {
-      }
-      void on_query_finished() override {
-        send_closure(parent_, &SessionMultiProxy::on_query_finished, generation_, session_id_);
-      }
-
-     private:
-      ActorId<SessionMultiProxy> parent_;
-      uint32 generation_;
-      int32 session_id_;
-    };
-    info.proxy = create_actor<SessionProxy>(name, make_unique<Callback>(actor_id(this), sessions_generation_, i),
-                                            auth_data_, is_main_, allow_media_only_, is_media_, get_pfs_flag(), is_cdn_,
-                                            need_destroy_auth_key_ && i == 0);
-    sessions_.push_back(std::move(info));
+  for (int32 i = 0; i < min_session_count(); i++) {
+    add_session();
+  }
+}
+
+void SessionMultiProxy::add_session() {
+  auto session_id = static_cast<int32>(sessions_.size());
+  string name = PSTRING() << "Session" << get_name().substr(Slice("SessionMulti").size())
+                          << format::cond(session_count_ > 1, format::concat("#", session_id));
+
+  SessionInfo info;
+  class Callback : public SessionProxy::Callback {
+   public:
+    Callback(ActorId<SessionMultiProxy> parent, uint32 generation, int32 session_id)
+        : parent_(parent), generation_(generation), session_id_(session_id) {
+    }
+    void on_query_finished() override {
+      send_closure(parent_, &SessionMultiProxy::on_query_finished, generation_, session_id_);
+    }
+
+   private:
+    ActorId<SessionMultiProxy> parent_;
+    uint32 generation_;
+    int32 session_id_;
+  };
+  info.proxy = create_actor<SessionProxy>(name, make_unique<Callback>(actor_id(this), sessions_generation_, session_id),
+                                          auth_data_, is_main_, allow_media_only_, is_media_, get_pfs_flag(), is_cdn_,
+                                          need_destroy_auth_key_ && session_id == 0);
+  info.last_activity_at = Time::now();
+  sessions_.push_back(std::move(info));
+  if (session_id >= min_session_count()) {
+    LOG(INFO) << "Add session #" << session_id << " to " << get_name();
+    set_timeout_in(SESSION_IDLE_TIMEOUT);
+  }
+}
+
+void SessionMultiProxy::timeout_expired() {
+  auto now = Time::now();
+  while (static_cast<int32>(sessions_.size()) > min_session_count() && sessions_.back().queries_count == 0 &&
+         now - sessions_.back().last_activity_at >= SESSION_IDLE_TIMEOUT) {
+    LOG(INFO) << "Close idle session #" << sessions_.size() - 1 << " of " << get_name();
+    sessions_.pop_back();
+  }
+  if (static_cast<int32>(sessions_.size()) > min_session_count()) {
+    set_timeout_in(SESSION_IDLE_TIMEOUT);
   }
 }
 
@@ -37,6 +37,10 @@ class SessionMultiProxy : public Actor {
   void update_destroy_auth_key(bool need_destroy_auth_key);
 
  private:
+  // grow while even the least loaded session has that many queries in flight
+  static constexpr int QUERIES_PER_SESSION = 2;
+  static constexpr double SESSION_IDLE_TIMEOUT = 60;  // 60s
+
   int32 session_count_ = 0;
   std::shared_ptr<AuthDataShared> auth_data_;
   bool is_main_ = false;
@@ -48,12 +52,20 @@ class SessionMultiProxy : public Actor {
   struct SessionInfo {
     ActorOwn<SessionProxy> proxy;
     int queries_count{0};
+    double last_activity_at{0};
   };
   uint32 sessions_generation_{0};
   std::vector<SessionInfo> sessions_;
 
   void start_up() override;
+  void timeout_expired() override;
   void init();
+  void add_session();
+
+  // session_count_ is treated as the maximum: except for the main proxy, sessions are
+  // opened on demand and closed after being idle for a while
+  int32 min_session_count() const;
+  int32 max_session_count() const;
 
   bool get_pfs_flag() const;
 
@@ -11,6 +11,7 @@
 #include "td/telegram/net/DcId.h"
 #include "td/telegram/net/NetQueryDispatcher.h"
 #include "td/telegram/net/Session.h"
+#include "td/telegram/TdDb.h"
 #include "td/telegram/UniqueId.h"
 
 #include "td/actor/PromiseFuture.h"
@@ -18,6 +19,8 @@
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
 #include "td/utils/Slice.h"
+#include "td/utils/Time.h"
+#include "td/utils/tl_helpers.h"
 
 #include <functional>
 
@@ -104,9 +107,49 @@ void SessionProxy::start_up() {
   };
   auth_key_state_ = auth_data_->get_auth_key_state().first;
   auth_data_->add_auth_key_listener(make_unique<Listener>(actor_shared(this)));
+  load_tmp_auth_key();
   open_session();
 }
 
+string SessionProxy::tmp_auth_key_key() const {
+  return PSTRING() << "tmp_auth" << get_name().substr(Slice("SessionProxy").size());
+}
+
+void SessionProxy::load_tmp_auth_key() {
+  if (!use_pfs_) {
+    return;
+  }
+  auto value = G()->td_db()->get_binlog_pmc()->get(tmp_auth_key_key());
+  if (value.empty()) {
+    return;
+  }
+  mtproto::AuthKey tmp_auth_key;
+  if (unserialize(tmp_auth_key, value).is_error()) {
+    return;
+  }
+  // expires_at is saved in server time and have to be converted back to the local monotonic clock
+  tmp_auth_key.set_expires_at(G()->from_server_time(tmp_auth_key.expires_at()));
+  if (Time::now() > tmp_auth_key.expires_at() - 60 * 60 * 2 /*2 hours*/) {
+    G()->td_db()->get_binlog_pmc()->erase(tmp_auth_key_key());
+    return;
+  }
+  LOG(WARNING) << "Restore tmp_auth_key " << tmp_auth_key.id();
+  tmp_auth_key_ = std::move(tmp_auth_key);
+}
+
+void SessionProxy::save_tmp_auth_key() {
+  if (!use_pfs_) {
+    return;
+  }
+  if (tmp_auth_key_.empty()) {
+    G()->td_db()->get_binlog_pmc()->erase(tmp_auth_key_key());
+    return;
+  }
+  auto tmp_auth_key = tmp_auth_key_;
+  tmp_auth_key.set_expires_at(G()->to_server_time(tmp_auth_key.expires_at()));
+  G()->td_db()->get_binlog_pmc()->set(tmp_auth_key_key(), serialize(tmp_auth_key));
+}
+
 void SessionProxy::tear_down() {
   for (auto &query : pending_queries_) {
     query->resend();
@@ -233,6 +276,7 @@ void SessionProxy::on_tmp_auth_key_updated(mtproto::AuthKey auth_key) {
   }
   LOG(WARNING) << "Have tmp_auth_key " << auth_key.id() << ": " << state;
   tmp_auth_key_ = std::move(auth_key);
+  save_tmp_auth_key();
 }
 void SessionProxy::on_server_salt_updated(std::vector<mtproto::ServerSalt> server_salts) {
   server_salts_ = std::move(server_salts);
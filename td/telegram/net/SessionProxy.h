@@ -58,6 +58,10 @@ class SessionProxy : public Actor {
   void close_session();
   void open_session(bool force = false);
 
+  string tmp_auth_key_key() const;
+  void load_tmp_auth_key();
+  void save_tmp_auth_key();
+
   void update_auth_key_state();
   void on_tmp_auth_key_updated(mtproto::AuthKey auth_key);
   void on_server_salt_updated(std::vector<mtproto::ServerSalt> server_salts);
@@ -28,6 +28,10 @@ class TlStorerToString;
 
 /**
  * This class is a base class for all TDLib TL-objects.
+ *
+ * TL-objects are move-only and expose their fields directly, so response assembly
+ * can steal subobjects with std::move instead of cloning them; no copy of an
+ * object or of a vector of object_ptr can be made accidentally.
  */
 class TlObject {
  public:
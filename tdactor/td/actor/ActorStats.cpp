@@ -0,0 +1,90 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/actor/ActorStats.h"
+
+#include "td/utils/logging.h"
+#include "td/utils/port/thread_local.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace td {
+
+std::atomic<bool> ActorStats::is_enabled_;
+
+namespace {
+
+struct StatsShard {
+  std::mutex mutex;
+  std::unordered_map<string, ActorStats::Stat> stats;
+};
+
+std::mutex shards_mutex;
+vector<unique_ptr<StatsShard>> shards;
+
+TD_THREAD_LOCAL StatsShard *shard_tls;  // static zero-initialized
+
+StatsShard *get_shard() {
+  if (shard_tls == nullptr) {
+    // the shard is owned by the global list and outlives the thread
+    std::lock_guard<std::mutex> guard(shards_mutex);
+    shards.push_back(make_unique<StatsShard>());
+    shard_tls = shards.back().get();
+  }
+  return shard_tls;
+}
+
+}  // namespace
+
+void ActorStats::on_actor_run(CSlice name, uint64 event_count, double cpu_time, size_t mailbox_size) {
+  auto *shard = get_shard();
+  std::lock_guard<std::mutex> guard(shard->mutex);
+  auto &stat = shard->stats[name.str()];
+  stat.event_count += event_count;
+  stat.cpu_time += cpu_time;
+  stat.max_mailbox_size = td::max(stat.max_mailbox_size, mailbox_size);
+}
+
+vector<std::pair<string, ActorStats::Stat>> ActorStats::dump() {
+  std::unordered_map<string, Stat> merged;
+  {
+    std::lock_guard<std::mutex> guard(shards_mutex);
+    for (auto &shard : shards) {
+      std::lock_guard<std::mutex> shard_guard(shard->mutex);
+      for (auto &it : shard->stats) {
+        auto &stat = merged[it.first];
+        stat.event_count += it.second.event_count;
+        stat.cpu_time += it.second.cpu_time;
+        stat.max_mailbox_size = td::max(stat.max_mailbox_size, it.second.max_mailbox_size);
+      }
+    }
+  }
+  vector<std::pair<string, Stat>> res(merged.begin(), merged.end());
+  std::sort(res.begin(), res.end(), [](const auto &a, const auto &b) { return a.second.cpu_time > b.second.cpu_time; });
+  return res;
+}
+
+string ActorStats::dump_str() {
+  string res = "Actor stats:\n";
+  for (auto &it : dump()) {
+    res += PSTRING() << (it.first.empty() ? Slice("<unnamed>") : Slice(it.first)) << ": events "
+                     << it.second.event_count << ", cpu_time " << it.second.cpu_time << ", max_mailbox_size "
+                     << it.second.max_mailbox_size << '\n';
+  }
+  return res;
+}
+
+void ActorStats::clear() {
+  std::lock_guard<std::mutex> guard(shards_mutex);
+  for (auto &shard : shards) {
+    std::lock_guard<std::mutex> shard_guard(shard->mutex);
+    shard->stats.clear();
+  }
+}
+
+}  // namespace td
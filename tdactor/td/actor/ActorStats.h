@@ -0,0 +1,51 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+
+#include <atomic>
+#include <utility>
+
+namespace td {
+
+// Opt-in per-actor statistics, aggregated by actor name. While enabled, every
+// scheduler reports events processed, consumed CPU time and the mailbox depth
+// of each actor it runs. Reports go to a per-thread shard, so the overhead on
+// the event loop is one uncontended lock and a hash lookup per mailbox flush
+class ActorStats {
+ public:
+  struct Stat {
+    uint64 event_count = 0;
+    double cpu_time = 0;
+    size_t max_mailbox_size = 0;
+  };
+
+  static void set_enabled(bool is_enabled) {
+    is_enabled_.store(is_enabled, std::memory_order_relaxed);
+  }
+  static bool is_enabled() {
+    return is_enabled_.load(std::memory_order_relaxed);
+  }
+
+  // called by Scheduler after each mailbox flush
+  static void on_actor_run(CSlice name, uint64 event_count, double cpu_time, size_t mailbox_size);
+
+  // stats merged over all threads, sorted by cpu_time in descending order
+  static vector<std::pair<string, Stat>> dump();
+
+  // human-readable dump for logs and signal handlers
+  static string dump_str();
+
+  static void clear();
+
+ private:
+  static std::atomic<bool> is_enabled_;
+};
+
+}  // namespace td
@@ -0,0 +1,82 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+// co_await adapter for FutureActor. It is only available when TDLib is compiled
+// with C++ coroutine support; the rest of the library doesn't depend on it
+
+#include "td/utils/config.h"
+
+#if TD_HAVE_COROUTINES
+
+#include "td/actor/actor.h"
+#include "td/actor/PromiseFuture.h"
+
+#include "td/utils/Status.h"
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace td {
+
+// Return type for fire-and-forget coroutines running inside actor events.
+// The coroutine body is executed eagerly until its first suspension point
+class CoroutineTask {
+ public:
+  struct promise_type {
+    CoroutineTask get_return_object() {
+      return {};
+    }
+    std::suspend_never initial_suspend() noexcept {
+      return {};
+    }
+    std::suspend_never final_suspend() noexcept {
+      return {};
+    }
+    void return_void() {
+    }
+    void unhandled_exception() {
+      std::terminate();
+    }
+  };
+};
+
+// Awaiter resuming the coroutine as an event of the given actor, so the continuation
+// runs in the actor's context on its scheduler without PromiseCreator allocations.
+// If the actor dies before the future is ready, the coroutine is never resumed
+template <class T>
+class FutureAwaiter {
+ public:
+  FutureAwaiter(ActorRef actor_ref, FutureActor<T> future) : actor_ref_(actor_ref), future_(std::move(future)) {
+  }
+
+  bool await_ready() const {
+    return future_.is_ready();
+  }
+
+  void await_suspend(std::coroutine_handle<> handle) {
+    future_.set_event(EventCreator::lambda(actor_ref_, [handle] { handle.resume(); }));
+  }
+
+  Result<T> await_resume() {
+    return future_.move_as_result();
+  }
+
+ private:
+  ActorRef actor_ref_;
+  FutureActor<T> future_;
+};
+
+template <class T>
+FutureAwaiter<T> await_future(ActorRef actor_ref, FutureActor<T> future) {
+  return FutureAwaiter<T>(actor_ref, std::move(future));
+}
+
+}  // namespace td
+
+#endif  // TD_HAVE_COROUTINES
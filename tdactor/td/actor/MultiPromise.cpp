@@ -6,8 +6,104 @@
 //
 #include "td/actor/MultiPromise.h"
 
+#include <atomic>
+#include <mutex>
+
 namespace td {
 
+struct MultiPromiseAtomic::State {
+  std::atomic<int32> ref_cnt{1};  // one reference is held by MultiPromiseAtomic itself
+  bool ignore_errors = false;
+  vector<Promise<Unit>> promises;  // never accessed after the own reference is released
+
+  std::mutex error_mutex;
+  Status error;
+
+  void on_error(Status &&status) {
+    std::lock_guard<std::mutex> guard(error_mutex);
+    if (error.is_ok()) {
+      error = std::move(status);
+    }
+  }
+
+  void release() {
+    if (ref_cnt.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+    // the last reference is gone, so no concurrent access is possible
+    Result<Unit> result;
+    if (!ignore_errors && error.is_error()) {
+      result = std::move(error);
+    } else {
+      result = Unit();
+    }
+    if (!promises.empty()) {
+      for (size_t i = 0; i + 1 < promises.size(); i++) {
+        promises[i].set_result(result.clone());
+      }
+      promises.back().set_result(std::move(result));
+    }
+    promises.clear();
+  }
+};
+
+class MultiPromiseAtomic::SubPromise : public PromiseInterface<Unit> {
+ public:
+  explicit SubPromise(std::shared_ptr<State> state) : state_(std::move(state)) {
+  }
+  SubPromise(SubPromise &&) = default;
+  SubPromise &operator=(SubPromise &&) = default;
+  ~SubPromise() override {
+    if (state_ != nullptr) {
+      // the promise was lost without being set
+      state_->on_error(Status::Error("Lost promise"));
+      release();
+    }
+  }
+
+  void set_value(Unit &&) override {
+    release();
+  }
+  void set_error(Status &&error) override {
+    state_->on_error(std::move(error));
+    release();
+  }
+
+ private:
+  std::shared_ptr<State> state_;
+
+  void release() {
+    auto state = std::move(state_);
+    state->release();
+  }
+};
+
+MultiPromiseAtomic::MultiPromiseAtomic() : state_(std::make_shared<State>()) {
+}
+
+MultiPromiseAtomic::~MultiPromiseAtomic() {
+  if (state_ != nullptr) {
+    state_->release();
+  }
+}
+
+void MultiPromiseAtomic::add_promise(Promise<Unit> &&promise) {
+  state_->promises.emplace_back(std::move(promise));
+}
+
+Promise<Unit> MultiPromiseAtomic::get_promise() {
+  state_->ref_cnt.fetch_add(1, std::memory_order_relaxed);
+  return Promise<Unit>(td::make_unique<SubPromise>(state_));
+}
+
+void MultiPromiseAtomic::set_ignore_errors(bool ignore_errors) {
+  state_->ignore_errors = ignore_errors;
+}
+
+size_t MultiPromiseAtomic::promise_count() const {
+  return state_->promises.size();
+}
+
 void MultiPromiseActor::add_promise(Promise<Unit> &&promise) {
   promises_.emplace_back(std::move(promise));
 }
@@ -12,6 +12,8 @@
 #include "td/utils/common.h"
 #include "td/utils/Status.h"
 
+#include <memory>
+
 namespace td {
 
 class MultiPromiseInterface {
@@ -88,6 +90,31 @@ class MultiPromiseActor final
   }
 };
 
+// Lock-free MultiPromiseInterface implementation. Every sub-promise shares an
+// atomic reference counter, and the thread releasing the last reference fires
+// the result promises directly, without a scheduler hop per sub-promise. The
+// result is Unit unless errors are not ignored, in which case the first
+// received error is returned. Unlike MultiPromiseActor it may be used and
+// completed outside of any scheduler
+class MultiPromiseAtomic : public MultiPromiseInterface {
+ public:
+  MultiPromiseAtomic();
+  MultiPromiseAtomic(MultiPromiseAtomic &&) = default;
+  MultiPromiseAtomic &operator=(MultiPromiseAtomic &&) = default;
+  ~MultiPromiseAtomic() override;
+
+  void add_promise(Promise<Unit> &&promise) override;
+  Promise<Unit> get_promise() override;
+  void set_ignore_errors(bool ignore_errors) override;
+  size_t promise_count() const override;
+
+ private:
+  struct State;
+  class SubPromise;
+
+  std::shared_ptr<State> state_;
+};
+
 class MultiPromiseActorSafe : public MultiPromiseInterface {
  public:
   void add_promise(Promise<Unit> &&promise) override;
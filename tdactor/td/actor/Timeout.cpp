@@ -18,6 +18,18 @@ bool MultiTimeout::has_timeout(int64 key) const {
 void MultiTimeout::set_timeout_at(int64 key, double timeout) {
   LOG(DEBUG) << "Set " << get_name() << " for " << key << " in " << timeout - Time::now();
   auto item = items_.emplace(key);
+  if (use_timer_wheel_) {
+    auto wheel_node = static_cast<TimerWheelNode *>(const_cast<Item *>(&*item.first));
+    if (wheel_node->in_wheel()) {
+      CHECK(!item.second);
+      timer_wheel_.fix(timeout, wheel_node);
+    } else {
+      CHECK(item.second);
+      timer_wheel_.insert(timeout, wheel_node);
+    }
+    update_wheel_timeout();
+    return;
+  }
   auto heap_node = static_cast<HeapNode *>(const_cast<Item *>(&*item.first));
   if (heap_node->in_heap()) {
     CHECK(!item.second);
@@ -38,6 +50,13 @@ void MultiTimeout::set_timeout_at(int64 key, double timeout) {
 void MultiTimeout::add_timeout_at(int64 key, double timeout) {
   LOG(DEBUG) << "Add " << get_name() << " for " << key << " in " << timeout - Time::now();
   auto item = items_.emplace(key);
+  if (use_timer_wheel_) {
+    if (item.second) {
+      timer_wheel_.insert(timeout, static_cast<TimerWheelNode *>(const_cast<Item *>(&*item.first)));
+      update_wheel_timeout();
+    }
+    return;
+  }
   auto heap_node = static_cast<HeapNode *>(const_cast<Item *>(&*item.first));
   if (heap_node->in_heap()) {
     CHECK(!item.second);
@@ -53,6 +72,18 @@ void MultiTimeout::add_timeout_at(int64 key, double timeout) {
 void MultiTimeout::cancel_timeout(int64 key) {
   LOG(DEBUG) << "Cancel " << get_name() << " for " << key;
   auto item = items_.find(Item(key));
+  if (use_timer_wheel_) {
+    if (item != items_.end()) {
+      timer_wheel_.erase(static_cast<TimerWheelNode *>(const_cast<Item *>(&*item)));
+      items_.erase(item);
+      if (items_.empty() && Actor::has_timeout()) {
+        // the actor timeout is kept armed after other cancellations and produces
+        // a cheap spurious wakeup instead of a heap erase
+        Actor::cancel_timeout();
+      }
+    }
+    return;
+  }
   if (item != items_.end()) {
     auto heap_node = static_cast<HeapNode *>(const_cast<Item *>(&*item));
     CHECK(heap_node->in_heap());
@@ -66,6 +97,16 @@ void MultiTimeout::cancel_timeout(int64 key) {
   }
 }
 
+void MultiTimeout::update_wheel_timeout() {
+  CHECK(!items_.empty());
+  double wakeup_at = timer_wheel_.get_wakeup_timestamp();
+  if (!Actor::has_timeout() || wakeup_at < wakeup_at_) {
+    LOG(DEBUG) << "Set timeout of " << get_name() << " in " << wakeup_at - Time::now_cached();
+    wakeup_at_ = wakeup_at;
+    Actor::set_timeout_at(wakeup_at);
+  }
+}
+
 void MultiTimeout::update_timeout() {
   if (items_.empty()) {
     LOG(DEBUG) << "Cancel timeout of " << get_name();
@@ -80,6 +121,14 @@ void MultiTimeout::update_timeout() {
 
 vector<int64> MultiTimeout::get_expired_keys(double now) {
   vector<int64> expired_keys;
+  if (use_timer_wheel_) {
+    timer_wheel_.run_expired(now, [&](TimerWheelNode *wheel_node) {
+      int64 key = static_cast<Item *>(wheel_node)->key;
+      items_.erase(Item(key));
+      expired_keys.push_back(key);
+    });
+    return expired_keys;
+  }
   while (!timeout_queue_.empty() && timeout_queue_.top_key() < now) {
     int64 key = static_cast<Item *>(timeout_queue_.pop())->key;
     items_.erase(Item(key));
@@ -91,7 +140,11 @@ vector<int64> MultiTimeout::get_expired_keys(double now) {
 void MultiTimeout::timeout_expired() {
   vector<int64> expired_keys = get_expired_keys(Time::now_cached());
   if (!items_.empty()) {
-    update_timeout();
+    if (use_timer_wheel_) {
+      update_wheel_timeout();
+    } else {
+      update_timeout();
+    }
   }
   for (auto key : expired_keys) {
     callback_(data_, key);
@@ -99,6 +152,23 @@ void MultiTimeout::timeout_expired() {
 }
 
 void MultiTimeout::run_all() {
+  if (use_timer_wheel_) {
+    vector<int64> expired_keys;
+    expired_keys.reserve(items_.size());
+    for (auto &item : items_) {
+      timer_wheel_.erase(static_cast<TimerWheelNode *>(const_cast<Item *>(&item)));
+      expired_keys.push_back(item.key);
+    }
+    items_.clear();
+    if (!expired_keys.empty() && Actor::has_timeout()) {
+      Actor::cancel_timeout();
+    }
+    for (auto key : expired_keys) {
+      callback_(data_, key);
+    }
+    return;
+  }
+
   vector<int64> expired_keys = get_expired_keys(Time::now_cached() + 1e10);
   if (!expired_keys.empty()) {
     update_timeout();
@@ -12,6 +12,7 @@
 #include "td/utils/Heap.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Time.h"
+#include "td/utils/TimerWheel.h"
 
 #include <set>
 
@@ -68,9 +69,10 @@ class Timeout final : public Actor {
   }
 };
 
-// TODO optimize
 class MultiTimeout final : public Actor {
-  struct Item : public HeapNode {
+  struct Item
+      : public HeapNode
+      , public TimerWheelNode {
     int64 key;
 
     explicit Item(int64 key) : key(key) {
@@ -84,7 +86,9 @@ class MultiTimeout final : public Actor {
  public:
   using Data = void *;
   using Callback = void (*)(Data, int64);
-  explicit MultiTimeout(Slice name) {
+  // with use_timer_wheel timeouts are kept in a hierarchical timer wheel with O(1) insert and
+  // cancel instead of a binary heap, at the price of 0.1 second timeout granularity
+  explicit MultiTimeout(Slice name, bool use_timer_wheel = false) : use_timer_wheel_(use_timer_wheel) {
     register_actor(name, this).release();
   }
 
@@ -119,11 +123,16 @@ class MultiTimeout final : public Actor {
   Callback callback_;
   Data data_;
 
+  bool use_timer_wheel_ = false;
   KHeap<double> timeout_queue_;
+  TimerWheel timer_wheel_{Time::now()};
+  double wakeup_at_ = 0;
   std::set<Item> items_;
 
   void update_timeout();
 
+  void update_wheel_timeout();
+
   void timeout_expired() override;
 
   vector<int64> get_expired_keys(double now);
@@ -79,6 +79,15 @@ class Actor : public ObserverBase {
 
   void always_wait_for_mailbox();
 
+  // allow the actor to be migrated to an idle scheduler by work stealing
+  void set_migratable(bool is_migratable = true);
+
+  // process at most mailbox_batch_size events per actor activation; 0 means unlimited
+  void set_mailbox_batch_size(size_t mailbox_batch_size);
+
+  // put the actor into the given scheduling lane
+  void set_priority(ActorPriority priority);
+
   // for ActorInfo mostly
   void init(ObjectPool<ActorInfo>::OwnerPtr &&info);
   ActorInfo *get_info();
@@ -157,4 +157,15 @@ inline void Actor::always_wait_for_mailbox() {
   info_->always_wait_for_mailbox();
 }
 
+inline void Actor::set_migratable(bool is_migratable) {
+  info_->set_migratable(is_migratable);
+}
+
+inline void Actor::set_mailbox_batch_size(size_t mailbox_batch_size) {
+  info_->set_mailbox_batch_size(mailbox_batch_size);
+}
+inline void Actor::set_priority(ActorPriority priority) {
+  info_->set_priority(priority);
+}
+
 }  // namespace td
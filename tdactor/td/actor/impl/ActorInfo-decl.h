@@ -24,6 +24,10 @@ namespace td {
 
 class Actor;
 
+// scheduling lane of the actor; ready actors from a higher lane are run before
+// actors from lower lanes
+enum class ActorPriority : uint8 { High, Normal, Low };
+
 class ActorContext {
  public:
   ActorContext() = default;
@@ -104,19 +108,31 @@ class ActorInfo
   bool must_wait(uint32 wait_generation) const;
   void always_wait_for_mailbox();
 
+  void set_migratable(bool is_migratable);
+  bool is_migratable() const;
+
+  void set_mailbox_batch_size(size_t mailbox_batch_size);
+  size_t get_mailbox_batch_size() const;
+
+  void set_priority(ActorPriority priority);
+  ActorPriority get_priority() const;
+
  private:
   Deleter deleter_ = Deleter::None;
   bool is_lite_ = false;
   bool is_running_ = false;
   bool always_wait_for_mailbox_{false};
+  bool is_migratable_{false};
+  ActorPriority priority_{ActorPriority::Normal};
+  size_t mailbox_batch_size_{0};  // 0 means unlimited
   uint32 wait_generation_{0};
 
   std::atomic<int32> sched_id_{0};
   Actor *actor_ = nullptr;
 
-#ifdef TD_DEBUG
+  // always filled in debug builds; filled while ActorStats collection is
+  // enabled in release builds
   string name_;
-#endif
   std::shared_ptr<ActorContext> context_;
 };
 
@@ -6,6 +6,7 @@
 //
 #pragma once
 
+#include "td/actor/ActorStats.h"
 #include "td/actor/impl/Actor-decl.h"
 #include "td/actor/impl/ActorInfo-decl.h"
 #include "td/actor/impl/Scheduler-decl.h"
@@ -42,6 +43,10 @@ inline void ActorInfo::init(int32 sched_id, Slice name, ObjectPool<ActorInfo>::O
     context_ = Scheduler::context()->this_ptr_.lock();
 #ifdef TD_DEBUG
     name_ = name.str();
+#else
+    if (ActorStats::is_enabled()) {
+      name_ = name.str();
+    }
 #endif
   }
 
@@ -49,6 +54,9 @@ inline void ActorInfo::init(int32 sched_id, Slice name, ObjectPool<ActorInfo>::O
   deleter_ = deleter;
   is_lite_ = is_lite;
   is_running_ = false;
+  is_migratable_ = false;
+  priority_ = ActorPriority::Normal;
+  mailbox_batch_size_ = 0;
   wait_generation_ = 0;
 }
 inline bool ActorInfo::is_lite() const {
@@ -63,6 +71,24 @@ inline bool ActorInfo::must_wait(uint32 wait_generation) const {
 inline void ActorInfo::always_wait_for_mailbox() {
   always_wait_for_mailbox_ = true;
 }
+inline void ActorInfo::set_migratable(bool is_migratable) {
+  is_migratable_ = is_migratable;
+}
+inline bool ActorInfo::is_migratable() const {
+  return is_migratable_;
+}
+inline void ActorInfo::set_priority(ActorPriority priority) {
+  priority_ = priority;
+}
+inline ActorPriority ActorInfo::get_priority() const {
+  return priority_;
+}
+inline void ActorInfo::set_mailbox_batch_size(size_t mailbox_batch_size) {
+  mailbox_batch_size_ = mailbox_batch_size;
+}
+inline size_t ActorInfo::get_mailbox_batch_size() const {
+  return mailbox_batch_size_;
+}
 inline void ActorInfo::on_actor_moved(Actor *actor_new_ptr) {
   actor_ = actor_new_ptr;
 }
@@ -161,11 +187,7 @@ inline ActorContext *ActorInfo::get_context() {
 }
 
 inline CSlice ActorInfo::get_name() const {
-#ifdef TD_DEBUG
   return name_;
-#else
-  return "";
-#endif
 }
 
 inline void ActorInfo::start_run() {
@@ -23,9 +23,21 @@ void ConcurrentScheduler::init(int32 threads_n) {
   threads_n = 0;
 #endif
   threads_n++;
-  std::vector<std::shared_ptr<MpscPollableQueue<EventFull>>> outbound(threads_n);
+
+  int32 pool_threads_n = 0;
+  for (auto &pool : pools_) {
+    pool->first_sched_id = threads_n + pool_threads_n;
+    pool->pos = 0;
+    pool_threads_n += pool->size;
+  }
+#if TD_THREAD_UNSUPPORTED || TD_EVENTFD_UNSUPPORTED
+  pool_threads_n = 0;
+#endif
+
+  // pool schedulers must be visible to all other schedulers, so their queues are created right away
+  std::vector<std::shared_ptr<MpscPollableQueue<EventFull>>> outbound(threads_n + pool_threads_n);
 #if !TD_THREAD_UNSUPPORTED && !TD_EVENTFD_UNSUPPORTED
-  for (int32 i = 0; i < threads_n; i++) {
+  for (int32 i = 0; i < threads_n + pool_threads_n; i++) {
     auto queue = std::make_shared<MpscPollableQueue<EventFull>>();
     queue->init();
     outbound[i] = queue;
@@ -40,13 +52,13 @@ void ConcurrentScheduler::init(int32 threads_n) {
   extra_scheduler_ = 0;
 #endif
 
-  schedulers_.resize(threads_n + extra_scheduler_);
-  for (int32 i = 0; i < threads_n + extra_scheduler_; i++) {
+  schedulers_.resize(threads_n + pool_threads_n + extra_scheduler_);
+  for (int32 i = 0; i < threads_n + pool_threads_n + extra_scheduler_; i++) {
     auto &sched = schedulers_[i];
     sched = make_unique<Scheduler>();
 
 #if !TD_THREAD_UNSUPPORTED && !TD_EVENTFD_UNSUPPORTED
-    if (i >= threads_n) {
+    if (i >= threads_n + pool_threads_n) {
       auto queue = std::make_shared<MpscPollableQueue<EventFull>>();
       queue->init();
       outbound.push_back(std::move(queue));
@@ -56,6 +68,17 @@ void ConcurrentScheduler::init(int32 threads_n) {
     sched->init(i, outbound, static_cast<Scheduler::Callback *>(this));
   }
 
+#if !TD_THREAD_UNSUPPORTED && !TD_EVENTFD_UNSUPPORTED
+  if (threads_n > 1) {
+    // the extra scheduler has no thread and can't participate in work stealing;
+    // pool schedulers are dedicated and are kept out of work stealing as well
+    auto steal_helper = std::make_shared<Scheduler::StealHelper>(static_cast<size_t>(threads_n));
+    for (int32 i = 0; i < threads_n; i++) {
+      schedulers_[i]->set_steal_helper(steal_helper);
+    }
+  }
+#endif
+
 #if TD_PORT_WINDOWS
   iocp_ = make_unique<detail::Iocp>();
   iocp_->init();
@@ -64,6 +87,29 @@ void ConcurrentScheduler::init(int32 threads_n) {
   state_ = State::Start;
 }
 
+void ConcurrentScheduler::add_pool(Slice name, int32 size) {
+  CHECK(schedulers_.empty());
+  CHECK(size > 0);
+  auto pool = make_unique<Pool>();
+  pool->name = name.str();
+  pool->size = size;
+  pools_.push_back(std::move(pool));
+}
+
+int32 ConcurrentScheduler::get_pool_scheduler_id(Slice pool_name) {
+  for (auto &pool : pools_) {
+    if (pool->name == pool_name) {
+#if TD_THREAD_UNSUPPORTED || TD_EVENTFD_UNSUPPORTED
+      return 0;
+#else
+      auto pos = pool->pos.fetch_add(1, std::memory_order_relaxed);
+      return pool->first_sched_id + static_cast<int32>(pos % static_cast<uint32>(pool->size));
+#endif
+    }
+  }
+  return -1;
+}
+
 void ConcurrentScheduler::test_one_thread_run() {
   do {
     for (auto &sched : schedulers_) {
@@ -28,6 +28,15 @@ class ConcurrentScheduler : private Scheduler::Callback {
  public:
   void init(int32 threads_n);
 
+  // reserves a named pool of dedicated schedulers; must be called before init.
+  // Actors placed into a pool don't compete for cycles with ordinary schedulers:
+  // pool schedulers don't participate in work stealing
+  void add_pool(Slice name, int32 size);
+
+  // returns the identifier of a scheduler from the named pool chosen in a round-robin
+  // fashion, or -1 if there is no such pool. May be called from any scheduler thread
+  int32 get_pool_scheduler_id(Slice pool_name) override;
+
   void finish_async() {
     schedulers_[0]->finish();
   }
@@ -84,7 +93,14 @@ class ConcurrentScheduler : private Scheduler::Callback {
  private:
   enum class State { Start, Run };
   State state_ = State::Start;
+  struct Pool {
+    string name;
+    int32 first_sched_id = 0;
+    int32 size = 0;
+    std::atomic<uint32> pos{0};
+  };
   std::vector<unique_ptr<Scheduler>> schedulers_;
+  std::vector<unique_ptr<Pool>> pools_;
   std::atomic<bool> is_finished_{false};
   std::mutex at_finish_mutex_;
   std::vector<std::function<void()>> at_finish_;
@@ -8,6 +8,7 @@
 
 #include "td/utils/Closure.h"
 #include "td/utils/common.h"
+#include "td/utils/EventArena.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/StringBuilder.h"
@@ -49,6 +50,15 @@ class CustomEvent {
   CustomEvent &operator=(CustomEvent &&) = delete;
   virtual ~CustomEvent() = default;
 
+  // events are created on one thread and often deleted on another; allocate
+  // them from EventArena to keep this hot path away from malloc
+  static void *operator new(std::size_t size) {
+    return EventArena::alloc(size);
+  }
+  static void operator delete(void *ptr) {
+    EventArena::dealloc(ptr);
+  }
+
   virtual void run(Actor *actor) = 0;
   virtual CustomEvent *clone() const = 0;
   virtual void start_migrate(int32 sched_id) {
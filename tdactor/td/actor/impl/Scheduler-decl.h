@@ -24,6 +24,7 @@
 #include "td/utils/Time.h"
 #include "td/utils/type_traits.h"
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
@@ -65,7 +66,20 @@ class Scheduler {
     virtual ~Callback() = default;
     virtual void on_finish() = 0;
     virtual void register_at_finish(std::function<void()>) = 0;
+    // returns the identifier of a scheduler from the named pool, or -1 if there is no such pool
+    virtual int32 get_pool_scheduler_id(Slice pool_name) {
+      return -1;
+    }
   };
+  // State shared between schedulers for work stealing. An idle scheduler raises its is_hungry flag,
+  // and a scheduler with a backlog of ready actors migrates a migratable actor to it
+  struct StealHelper {
+    explicit StealHelper(size_t scheduler_n);
+
+    std::vector<std::atomic<int32>> load;
+    std::vector<std::atomic<bool>> is_hungry;
+  };
+
   Scheduler() = default;
   Scheduler(const Scheduler &) = delete;
   Scheduler &operator=(const Scheduler &) = delete;
@@ -77,8 +91,11 @@ class Scheduler {
   void init(int32 id, std::vector<std::shared_ptr<MpscPollableQueue<EventFull>>> outbound, Callback *callback);
   void clear();
 
+  void set_steal_helper(std::shared_ptr<StealHelper> steal_helper);
+
   int32 sched_id() const;
   int32 sched_count() const;
+  int32 get_pool_scheduler_id(Slice pool_name) const;
 
   template <class ActorT, class... Args>
   TD_WARN_UNUSED_RESULT ActorOwn<ActorT> create_actor(Slice name, Args &&... args);
@@ -190,6 +207,11 @@ class Scheduler {
 
   void inc_wait_generation();
 
+  ListNode &get_ready_list(ActorInfo *actor_info);
+  bool has_ready_actors() const;
+
+  void offload_ready_actors(ListNode &actors_list);
+
   Timestamp run_timeout();
   void run_mailbox();
   Timestamp run_events();
@@ -205,9 +227,11 @@ class Scheduler {
   Callback *callback_ = nullptr;
   unique_ptr<ObjectPool<ActorInfo>> actor_info_pool_;
 
+  static constexpr size_t PRIORITY_COUNT = 3;
+
   int32 actor_count_ = 0;
   ListNode pending_actors_list_;
-  ListNode ready_actors_list_;
+  ListNode ready_actors_lists_[PRIORITY_COUNT];  // one lane per ActorPriority
   KHeap<double> timeout_queue_;
 
   std::map<ActorInfo *, std::vector<Event>> pending_events_;
@@ -224,6 +248,7 @@ class Scheduler {
   int32 sched_n_ = 0;
   std::shared_ptr<MpscPollableQueue<EventFull>> inbound_queue_;
   std::vector<std::shared_ptr<MpscPollableQueue<EventFull>>> outbound_queues_;
+  std::shared_ptr<StealHelper> steal_helper_;
 
   std::shared_ptr<ActorContext> save_context_;
 
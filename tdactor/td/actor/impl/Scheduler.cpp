@@ -105,6 +105,20 @@ void Scheduler::ServiceActor::tear_down() {
 #endif
 }
 
+/*** StealHelper ***/
+Scheduler::StealHelper::StealHelper(size_t scheduler_n) : load(scheduler_n), is_hungry(scheduler_n) {
+  for (auto &scheduler_load : load) {
+    scheduler_load.store(0, std::memory_order_relaxed);
+  }
+  for (auto &scheduler_is_hungry : is_hungry) {
+    scheduler_is_hungry.store(false, std::memory_order_relaxed);
+  }
+}
+
+void Scheduler::set_steal_helper(std::shared_ptr<StealHelper> steal_helper) {
+  steal_helper_ = std::move(steal_helper);
+}
+
 /*** SchedlerGuard ***/
 SchedulerGuard::SchedulerGuard(Scheduler *scheduler, bool lock) : scheduler_(scheduler) {
   if (lock) {
@@ -154,7 +168,7 @@ EventGuard::~EventGuard() {
   if (info->mailbox_.empty()) {
     scheduler_->pending_actors_list_.put(node);
   } else {
-    scheduler_->ready_actors_list_.put(node);
+    scheduler_->get_ready_list(info).put(node);
   }
   info->finish_run();
   swap_context(info);
@@ -233,12 +247,14 @@ void Scheduler::clear() {
     auto actor_info = ActorInfo::from_list_node(pending_actors_list_.get());
     do_stop_actor(actor_info);
   }
-  while (!ready_actors_list_.empty()) {
-    auto actor_info = ActorInfo::from_list_node(ready_actors_list_.get());
-    do_stop_actor(actor_info);
+  for (auto &ready_actors_list : ready_actors_lists_) {
+    while (!ready_actors_list.empty()) {
+      auto actor_info = ActorInfo::from_list_node(ready_actors_list.get());
+      do_stop_actor(actor_info);
+    }
+    LOG_IF(FATAL, !ready_actors_list.empty()) << ActorInfo::from_list_node(ready_actors_list.next)->get_name();
+    CHECK(ready_actors_list.empty());
   }
-  LOG_IF(FATAL, !ready_actors_list_.empty()) << ActorInfo::from_list_node(ready_actors_list_.next)->get_name();
-  CHECK(ready_actors_list_.empty());
   poll_.clear();
 
   if (callback_) {
@@ -324,7 +340,7 @@ void Scheduler::register_migrated_actor(ActorInfo *actor_info) {
   if (actor_info->mailbox_.empty()) {
     pending_actors_list_.put(actor_info->get_list_node());
   } else {
-    ready_actors_list_.put(actor_info->get_list_node());
+    get_ready_list(actor_info).put(actor_info->get_list_node());
   }
   actor_info->get_actor_unsafe()->on_finish_migrate();
 }
@@ -347,7 +363,7 @@ void Scheduler::add_to_mailbox(ActorInfo *actor_info, Event &&event) {
   if (!actor_info->is_running()) {
     auto node = actor_info->get_list_node();
     node->remove();
-    ready_actors_list_.put(node);
+    get_ready_list(actor_info).put(node);
   }
   VLOG(actor) << "Add to mailbox: " << *actor_info << " " << event;
   actor_info->mailbox_.push_back(std::move(event));
@@ -450,15 +466,82 @@ void Scheduler::run_poll(Timestamp timeout) {
 #endif
 }
 
+void Scheduler::offload_ready_actors(ListNode &actors_list) {
+  auto &helper = *steal_helper_;
+  size_t ready_n = 0;
+  for (ListNode *it = actors_list.next; it != &actors_list; it = it->next) {
+    ready_n++;
+  }
+  helper.load[sched_id_].store(static_cast<int32>(ready_n), std::memory_order_relaxed);
+  if (ready_n <= 1) {
+    return;
+  }
+
+  ListNode *it = actors_list.next;
+  for (size_t peer_id = 0; peer_id < helper.is_hungry.size() && ready_n > 1; peer_id++) {
+    if (peer_id == static_cast<size_t>(sched_id_) || !helper.is_hungry[peer_id].load(std::memory_order_relaxed)) {
+      continue;
+    }
+    while (it != &actors_list && (!ActorInfo::from_list_node(it)->is_migratable() ||
+                                  ActorInfo::from_list_node(it)->is_running())) {
+      it = it->next;
+    }
+    if (it == &actors_list) {
+      return;
+    }
+    if (!helper.is_hungry[peer_id].exchange(false, std::memory_order_relaxed)) {
+      continue;
+    }
+    auto actor_info = ActorInfo::from_list_node(it);
+    it = it->next;
+    VLOG(actor) << "Migrate " << *actor_info << " to idle scheduler " << peer_id;
+    do_migrate_actor(actor_info, static_cast<int32>(peer_id));
+    ready_n--;
+    helper.load[sched_id_].store(static_cast<int32>(ready_n), std::memory_order_relaxed);
+  }
+}
+
+ListNode &Scheduler::get_ready_list(ActorInfo *actor_info) {
+  return ready_actors_lists_[static_cast<size_t>(actor_info->get_priority())];
+}
+
+bool Scheduler::has_ready_actors() const {
+  for (auto &ready_actors_list : ready_actors_lists_) {
+    if (!ready_actors_list.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void Scheduler::run_mailbox() {
   VLOG(actor) << "Run mailbox : begin";
-  ListNode actors_list = std::move(ready_actors_list_);
-  while (!actors_list.empty()) {
-    ListNode *node = actors_list.get();
+  auto flush_node = [&](ListNode *node) {
     CHECK(node);
     auto actor_info = ActorInfo::from_list_node(node);
     inc_wait_generation();
     flush_mailbox(actor_info, static_cast<void (*)(ActorInfo *)>(nullptr), static_cast<Event (*)()>(nullptr));
+  };
+  for (size_t lane = 0; lane < PRIORITY_COUNT; lane++) {
+    ListNode actors_list = std::move(ready_actors_lists_[lane]);
+    if (lane == static_cast<size_t>(ActorPriority::Normal) && steal_helper_ != nullptr) {
+      offload_ready_actors(actors_list);
+    }
+    while (!actors_list.empty()) {
+      // actors that became ready in a higher-priority lane preempt the current lane
+      bool need_check_higher_lanes = true;
+      while (need_check_higher_lanes) {
+        need_check_higher_lanes = false;
+        for (size_t higher_lane = 0; higher_lane < lane; higher_lane++) {
+          if (!ready_actors_lists_[higher_lane].empty()) {
+            flush_node(ready_actors_lists_[higher_lane].get());
+            need_check_higher_lanes = true;
+            break;
+          }
+        }
+      }
+      flush_node(actors_list.get());
+    }
   }
   VLOG(actor) << "Run mailbox : finish " << actor_count_;
 
@@ -472,11 +555,13 @@ void Scheduler::run_mailbox() {
   //CHECK(actor_info->mailbox_.empty());
   //CHECK(!actor_info->is_running());
   //}
-  //for (ListNode *end = &ready_actors_list_, *it = ready_actors_list_.next; it != end; it = it->next) {
+  //for (auto &list : ready_actors_lists_) {
+  //for (ListNode *end = &list, *it = list.next; it != end; it = it->next) {
   //auto actor_info = ActorInfo::from_list_node(it);
   //LOG(ERROR) << *actor_info;
   //cnt++;
   //}
+  //}
   //LOG_CHECK(cnt == actor_count_) << cnt << " vs " << actor_count_;
 }
 
@@ -502,7 +587,20 @@ void Scheduler::run_no_guard(Timestamp timeout) {
   if (yield_flag_) {
     return;
   }
+  if (steal_helper_ != nullptr) {
+    auto &helper = *steal_helper_;
+    helper.load[sched_id_].store(0, std::memory_order_relaxed);
+    for (size_t peer_id = 0; peer_id < helper.load.size(); peer_id++) {
+      if (peer_id != static_cast<size_t>(sched_id_) && helper.load[peer_id].load(std::memory_order_relaxed) > 1) {
+        helper.is_hungry[sched_id_].store(true, std::memory_order_relaxed);
+        break;
+      }
+    }
+  }
   run_poll(timeout);
+  if (steal_helper_ != nullptr) {
+    steal_helper_->is_hungry[sched_id_].store(false, std::memory_order_relaxed);
+  }
   run_events();
 }
 
@@ -6,6 +6,7 @@
 //
 #pragma once
 
+#include "td/actor/ActorStats.h"
 #include "td/actor/impl/ActorInfo-decl.h"
 #include "td/actor/impl/Scheduler-decl.h"
 
@@ -15,6 +16,7 @@
 #include "td/utils/logging.h"
 #include "td/utils/MpscPollableQueue.h"
 #include "td/utils/ObjectPool.h"
+#include "td/utils/port/Clocks.h"
 #include "td/utils/port/detail/PollableFd.h"
 #include "td/utils/port/PollFlags.h"
 #include "td/utils/Slice.h"
@@ -75,6 +77,9 @@ inline int32 Scheduler::sched_id() const {
 inline int32 Scheduler::sched_count() const {
   return sched_n_;
 }
+inline int32 Scheduler::get_pool_scheduler_id(Slice pool_name) const {
+  return callback_ == nullptr ? -1 : callback_->get_pool_scheduler_id(pool_name);
+}
 
 template <class ActorT, class... Args>
 ActorOwn<ActorT> Scheduler::create_actor(Slice name, Args &&... args) {
@@ -161,19 +166,42 @@ void Scheduler::flush_mailbox(ActorInfo *actor_info, const RunFuncT &run_func, c
   auto &mailbox = actor_info->mailbox_;
   size_t mailbox_size = mailbox.size();
   CHECK(mailbox_size != 0);
-  EventGuard guard(this, actor_info);
-  size_t i = 0;
-  for (; i < mailbox_size && guard.can_run(); i++) {
-    do_event(actor_info, std::move(mailbox[i]));
+  bool need_stats = ActorStats::is_enabled();
+  double cpu_start = 0;
+  if (unlikely(need_stats)) {
+    cpu_start = Clocks::thread_cpu();
   }
-  if (run_func) {
-    if (guard.can_run()) {
-      (*run_func)(actor_info);
-    } else {
-      mailbox.insert(begin(mailbox) + i, (*event_func)());
+  auto batch_size = actor_info->get_mailbox_batch_size();
+  bool is_batch_truncated = batch_size != 0 && mailbox_size > batch_size;
+  if (is_batch_truncated) {
+    // the actor will be returned to the ready list and will process the remaining events
+    // on its next activation
+    mailbox_size = batch_size;
+  }
+  uint64 event_count = 0;
+  {
+    EventGuard guard(this, actor_info);
+    size_t i = 0;
+    for (; i < mailbox_size && guard.can_run(); i++) {
+      do_event(actor_info, std::move(mailbox[i]));
     }
+    event_count = i;
+    if (run_func) {
+      if (guard.can_run() && !is_batch_truncated) {
+        (*run_func)(actor_info);
+        event_count++;
+      } else {
+        // keep the event after all events that were already in the mailbox
+        auto pos = guard.can_run() ? mailbox.size() : i;
+        mailbox.insert(begin(mailbox) + pos, (*event_func)());
+      }
+    }
+    mailbox.erase(begin(mailbox), begin(mailbox) + i);
+  }
+  if (unlikely(need_stats)) {
+    // ActorInfo is pooled, so its name is valid even if the actor was just stopped
+    ActorStats::on_actor_run(actor_info->get_name(), event_count, Clocks::thread_cpu() - cpu_start, mailbox_size);
   }
-  mailbox.erase(begin(mailbox), begin(mailbox) + i);
 }
 
 inline void Scheduler::send_to_scheduler(int32 sched_id, const ActorId<> &actor_id, Event &&event) {
@@ -210,8 +238,17 @@ void Scheduler::send_impl(const ActorId<> &actor_id, const RunFuncT &run_func, c
   if (likely(send_type == ActorSendType::Immediate && on_current_sched && !actor_info->is_running() &&
              !actor_info->must_wait(wait_generation_))) {  // run immediately
     if (likely(actor_info->mailbox_.empty())) {
-      EventGuard guard(this, actor_info);
-      run_func(actor_info);
+      if (unlikely(ActorStats::is_enabled())) {
+        auto cpu_start = Clocks::thread_cpu();
+        {
+          EventGuard guard(this, actor_info);
+          run_func(actor_info);
+        }
+        ActorStats::on_actor_run(actor_info->get_name(), 1, Clocks::thread_cpu() - cpu_start, 1);
+      } else {
+        EventGuard guard(this, actor_info);
+        run_func(actor_info);
+      }
     } else {
       flush_mailbox(actor_info, &run_func, &event_func);
     }
@@ -354,7 +391,7 @@ inline Timestamp Scheduler::run_events() {
   do {
     run_mailbox();
     res = run_timeout();
-  } while (!ready_actors_list_.empty());
+  } while (has_ready_actors());
   return res;
 }
 
@@ -7,6 +7,7 @@
 #include "td/utils/tests.h"
 
 #include "td/actor/actor.h"
+#include "td/actor/ActorStats.h"
 #include "td/actor/MultiPromise.h"
 #include "td/actor/PromiseFuture.h"
 #include "td/actor/SleepActor.h"
@@ -24,6 +25,8 @@
 #include "td/utils/StringBuilder.h"
 #include "td/utils/Time.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <tuple>
 
@@ -550,6 +553,75 @@ TEST(Actors, MultiPromise) {
   scheduler.finish();
 }
 
+TEST(Actors, MultiPromiseAtomic) {
+  // the result is set only after the handle and all sub-promises are gone
+  {
+    int ok_count = 0;
+    vector<Promise<Unit>> subs;
+    MultiPromiseAtomic multi_promise;
+    multi_promise.add_promise(PromiseCreator::lambda([&](Result<Unit> result) {
+      CHECK(result.is_ok());
+      ok_count++;
+    }));
+    CHECK(multi_promise.promise_count() == 1);
+    for (int i = 0; i < 10; i++) {
+      subs.push_back(multi_promise.get_promise());
+    }
+    { auto tmp = std::move(multi_promise); }
+    CHECK(ok_count == 0);
+    for (auto &sub : subs) {
+      sub.set_value(Unit());
+    }
+    CHECK(ok_count == 1);
+  }
+
+  // without ignore_errors the first error wins, even if the promise was simply lost
+  for (int ignore_errors = 0; ignore_errors < 2; ignore_errors++) {
+    int result_count = 0;
+    MultiPromiseAtomic multi_promise;
+    multi_promise.set_ignore_errors(ignore_errors != 0);
+    multi_promise.add_promise(PromiseCreator::lambda([&, ignore_errors](Result<Unit> result) {
+      CHECK(result.is_ok() == (ignore_errors != 0));
+      result_count++;
+    }));
+    auto first = multi_promise.get_promise();
+    auto second = multi_promise.get_promise();
+    first.set_error(Status::Error("Some error"));
+    second.reset();  // lost promise
+    { auto tmp = std::move(multi_promise); }
+    CHECK(result_count == 1);
+  }
+
+#if !TD_THREAD_UNSUPPORTED
+  // sub-promises may be completed from any thread
+  {
+    std::atomic<int> ok_count{0};
+    vector<Promise<Unit>> subs;
+    MultiPromiseAtomic multi_promise;
+    multi_promise.add_promise(PromiseCreator::lambda([&](Result<Unit> result) {
+      CHECK(result.is_ok());
+      ok_count++;
+    }));
+    for (int i = 0; i < 100; i++) {
+      subs.push_back(multi_promise.get_promise());
+    }
+    { auto tmp = std::move(multi_promise); }
+    vector<td::thread> threads;
+    for (int id = 0; id < 4; id++) {
+      threads.push_back(td::thread([&, id] {
+        for (size_t i = id; i < subs.size(); i += 4) {
+          subs[i].set_value(Unit());
+        }
+      }));
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    CHECK(ok_count == 1);
+  }
+#endif  //!TD_THREAD_UNSUPPORTED
+}
+
 class FastPromise : public Actor {
  public:
   void start_up() override {
@@ -621,6 +693,186 @@ class AlwaysWaitForMailbox : public Actor {
   bool was_f_{false};
 };
 
+class MailboxBatch : public Actor {
+ public:
+  void start_up() override {
+    set_mailbox_batch_size(2);
+    for (int i = 0; i < 100; i++) {
+      send_closure_later(actor_id(this), &MailboxBatch::add, i);
+    }
+  }
+
+  void add(int x) {
+    CHECK(x == next_);
+    next_++;
+    if (next_ == 100) {
+      Scheduler::instance()->finish();
+      stop();
+    }
+  }
+
+ private:
+  int next_ = 0;
+};
+
+TEST(Actors, mailbox_batch_size) {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
+  ConcurrentScheduler scheduler;
+  scheduler.init(0);
+  scheduler.create_actor_unsafe<MailboxBatch>(0, "A").release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+}
+
+class LaneWorker : public Actor {
+ public:
+  LaneWorker(ActorPriority priority, int value, vector<int> *log, int *left_count)
+      : priority_(priority), value_(value), log_(log), left_count_(left_count) {
+  }
+
+  void start_up() override {
+    set_priority(priority_);
+    for (int i = 0; i < 50; i++) {
+      send_closure_later(actor_id(this), &LaneWorker::work);
+    }
+  }
+
+  void work() {
+    log_->push_back(value_);
+    if (++count_ == 50) {
+      if (--*left_count_ == 0) {
+        Scheduler::instance()->finish();
+      }
+      stop();
+    }
+  }
+
+ private:
+  ActorPriority priority_;
+  int value_;
+  vector<int> *log_;
+  int *left_count_;
+  int count_ = 0;
+};
+
+TEST(Actors, priority_lanes) {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
+  vector<int> log;
+  int left_count = 3;
+  ConcurrentScheduler scheduler;
+  scheduler.init(0);
+  scheduler.create_actor_unsafe<LaneWorker>(0, "Low", ActorPriority::Low, 2, &log, &left_count).release();
+  scheduler.create_actor_unsafe<LaneWorker>(0, "Normal", ActorPriority::Normal, 1, &log, &left_count).release();
+  scheduler.create_actor_unsafe<LaneWorker>(0, "High", ActorPriority::High, 0, &log, &left_count).release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+
+  // all high-priority work must have been done first, all low-priority work last
+  CHECK(log.size() == 150);
+  CHECK(std::is_sorted(log.begin(), log.end()));
+}
+
+class StatsWorker : public Actor {
+ public:
+  void start_up() override {
+    for (int i = 0; i < 100; i++) {
+      send_closure_later(actor_id(this), &StatsWorker::work);
+    }
+  }
+
+  void work() {
+    if (++count_ == 100) {
+      Scheduler::instance()->finish();
+      stop();
+    }
+  }
+
+ private:
+  int count_ = 0;
+};
+
+TEST(Actors, actor_stats) {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
+  td::ActorStats::clear();
+  td::ActorStats::set_enabled(true);
+  ConcurrentScheduler scheduler;
+  scheduler.init(0);
+  scheduler.create_actor_unsafe<StatsWorker>(0, "StatsWorker").release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+  td::ActorStats::set_enabled(false);
+
+  bool found = false;
+  for (auto &it : td::ActorStats::dump()) {
+    if (it.first == "StatsWorker") {
+      found = true;
+      CHECK(it.second.event_count >= 100);
+      CHECK(it.second.cpu_time >= 0);
+      CHECK(it.second.max_mailbox_size >= 1);
+    }
+  }
+  CHECK(found);
+  CHECK(!td::ActorStats::dump_str().empty());
+  td::ActorStats::clear();
+}
+
+#if !TD_THREAD_UNSUPPORTED && !TD_EVENTFD_UNSUPPORTED
+namespace {
+class PoolWorker : public Actor {
+ public:
+  PoolWorker(int32 expected_sched_id, std::atomic<int> *fail_count, std::atomic<int> *left_count)
+      : expected_sched_id_(expected_sched_id), fail_count_(fail_count), left_count_(left_count) {
+  }
+  void start_up() override {
+    if (Scheduler::instance()->sched_id() != expected_sched_id_) {
+      (*fail_count_)++;
+    }
+    stop();
+  }
+  void tear_down() override {
+    if (--*left_count_ == 0) {
+      Scheduler::instance()->finish();
+    }
+  }
+
+ private:
+  int32 expected_sched_id_;
+  std::atomic<int> *fail_count_;
+  std::atomic<int> *left_count_;
+};
+}  // namespace
+
+TEST(Actors, scheduler_pools) {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
+  ConcurrentScheduler scheduler;
+  scheduler.add_pool("io", 2);
+  scheduler.init(1);
+  CHECK(scheduler.get_pool_scheduler_id("unknown") == -1);
+  std::atomic<int> fail_count{0};
+  std::atomic<int> left_count{10};
+  {
+    auto guard = scheduler.get_main_guard();
+    for (int i = 0; i < 10; i++) {
+      auto sched_id = scheduler.get_pool_scheduler_id("io");
+      // init(1) creates schedulers 0 and 1, so the pool occupies schedulers 2 and 3
+      CHECK(sched_id == 2 + i % 2);
+      create_actor_on_scheduler<PoolWorker>("PoolWorker", sched_id, sched_id, &fail_count, &left_count).release();
+    }
+  }
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+  CHECK(fail_count == 0);
+}
+#endif
+
 TEST(Actors, always_wait_for_mailbox) {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
   ConcurrentScheduler scheduler;
@@ -131,8 +131,67 @@ void test_workers(int threads_n, int workers_n, int queries_n, int query_size) {
 
   // sched.test_one_thread_run();
 }
+class StealWaiter final : public Actor {
+ public:
+  explicit StealWaiter(int workers_n) : workers_n_(workers_n) {
+  }
+  void on_worker_done() {
+    if (--workers_n_ == 0) {
+      Scheduler::instance()->finish();
+      stop();
+    }
+  }
+
+ private:
+  int workers_n_;
+};
+
+class StealableWorker final : public Actor {
+ public:
+  StealableWorker(ActorId<StealWaiter> waiter, int rounds) : waiter_(waiter), rounds_(rounds) {
+  }
+  void start_up() override {
+    set_migratable();
+    yield();
+  }
+  void loop() override {
+    if (--rounds_ > 0) {
+      yield();
+    } else {
+      send_closure(waiter_, &StealWaiter::on_worker_done);
+      stop();
+    }
+  }
+
+ private:
+  ActorId<StealWaiter> waiter_;
+  int rounds_;
+};
+
+void test_work_stealing(int threads_n, int workers_n, int rounds) {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
+
+  ConcurrentScheduler sched;
+  sched.init(threads_n);
+
+  auto waiter = sched.create_actor_unsafe<StealWaiter>(1, "StealWaiter", workers_n).release();
+  for (int i = 0; i < workers_n; i++) {
+    // create all workers on the same overloaded scheduler and let idle schedulers steal them
+    sched.create_actor_unsafe<StealableWorker>(2, PSLICE() << "StealableWorker" << i, waiter, rounds).release();
+  }
+
+  sched.start();
+  while (sched.run_main(10)) {
+    // empty
+  }
+  sched.finish();
+}
 }  // namespace
 
+TEST(Actors, work_stealing) {
+  test_work_stealing(4, 100, 1000);
+}
+
 TEST(Actors, workers_big_query_one_thread) {
   test_workers(0, 10, 1000, 300000);
 }
@@ -135,6 +135,12 @@ Status SqliteDb::set_user_version(int32 version) {
   return exec(PSLICE() << "PRAGMA user_version = " << version);
 }
 
+Status SqliteDb::wal_checkpoint() {
+  // a PASSIVE checkpoint moves as many WAL pages into the database file as it can
+  // without blocking or being blocked by concurrent readers and writers
+  return exec("PRAGMA wal_checkpoint(PASSIVE)");
+}
+
 Status SqliteDb::begin_transaction() {
   if (raw_->on_begin()) {
     return exec("BEGIN");
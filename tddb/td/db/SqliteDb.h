@@ -55,6 +55,7 @@ class SqliteDb {
 
   Result<int32> user_version();
   Status set_user_version(int32 version) TD_WARN_UNUSED_RESULT;
+  Status wal_checkpoint() TD_WARN_UNUSED_RESULT;
   void trace(bool flag);
 
   static Status destroy(Slice path) TD_WARN_UNUSED_RESULT;
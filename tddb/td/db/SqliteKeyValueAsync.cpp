@@ -103,9 +103,9 @@ class SqliteKeyValueAsync : public SqliteKeyValueAsyncInterface {
         auto now = Time::now_cached();
         if (wakeup_at_ == 0) {
           wakeup_at_ = now + MAX_PENDING_QUERIES_DELAY;
+          set_timeout_at(wakeup_at_);
         }
         if (now < wakeup_at_ && cnt_ < MAX_PENDING_QUERIES_COUNT) {
-          set_timeout_at(wakeup_at_);
           return;
         }
       }
@@ -10,9 +10,12 @@
 #include "td/utils/logging.h"
 #include "td/utils/StackAllocator.h"
 #include "td/utils/StringBuilder.h"
+#include "td/utils/Time.h"
 
 #include "sqlite/sqlite3.h"
 
+#include <atomic>
+
 namespace td {
 
 namespace {
@@ -172,15 +175,35 @@ void SqliteStatement::reset() {
   state_ = Start;
 }
 
+static std::atomic<double> slow_step_threshold{1.0};
+
+void SqliteStatement::set_slow_step_threshold(double threshold) {
+  slow_step_threshold.store(threshold, std::memory_order_relaxed);
+}
+
 Status SqliteStatement::step() {
   if (state_ == Finish) {
     return Status::Error("One has to reset statement");
   }
   VLOG(sqlite) << "Start step " << tag("query", sqlite3_sql(stmt_.get())) << tag("statement", stmt_.get())
                << tag("database", db_.get());
+  auto start = Time::now();
   auto rc = sqlite3_step(stmt_.get());
+  auto duration = Time::now() - start;
   VLOG(sqlite) << "Finish step " << tag("query", sqlite3_sql(stmt_.get())) << tag("statement", stmt_.get())
                << tag("database", db_.get());
+  step_stats_.step_count++;
+  step_stats_.total_duration += duration;
+  if (duration > step_stats_.max_duration) {
+    step_stats_.max_duration = duration;
+  }
+  auto threshold = slow_step_threshold.load(std::memory_order_relaxed);
+  if (threshold > 0 && duration >= threshold) {
+    // sqlite3_sql returns the prepared SQL without bound values
+    LOG(WARNING) << "Slow SQL step " << tag("query", sqlite3_sql(stmt_.get())) << tag("duration", format::as_time(duration))
+                 << tag("step_count", step_stats_.step_count)
+                 << tag("total_duration", format::as_time(step_stats_.total_duration));
+  }
   if (rc == SQLITE_ROW) {
     state_ = GotRow;
     return Status::OK();
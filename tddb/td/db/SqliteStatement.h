@@ -43,6 +43,19 @@ class SqliteStatement {
 
   Result<string> explain();
 
+  struct StepStats {
+    uint64 step_count = 0;
+    double total_duration = 0;
+    double max_duration = 0;
+  };
+  const StepStats &step_stats() const {
+    return step_stats_;
+  }
+
+  // a single sqlite3_step taking at least this long is logged with the
+  // prepared SQL (without bound values); 0 disables the slow-step log
+  static void set_slow_step_threshold(double threshold);
+
   bool can_step() const {
     return state_ != Finish;
   }
@@ -76,6 +89,7 @@ class SqliteStatement {
 
   std::unique_ptr<sqlite3_stmt, StmtDeleter> stmt_;
   std::shared_ptr<detail::RawSqliteDb> db_;
+  StepStats step_stats_;
 
   Status last_error();
 };
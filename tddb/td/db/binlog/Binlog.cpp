@@ -207,12 +207,14 @@ Status Binlog::init(string path, const Callback &callback, DbKey db_key, DbKey o
   }
   info_.last_id = processor_->last_id();
   last_id_ = processor_->last_id();
+  info_.is_encrypted = encryption_type_ != EncryptionType::None;
   if (info_.wrong_password) {
     close().ignore();
     return Status::Error(Error::WrongPassword, "Wrong password");
   }
 
-  if ((!db_key_.is_empty() && !db_key_used_) || (db_key_.is_empty() && encryption_type_ != EncryptionType::None)) {
+  if (!check_encryption_only_ &&
+      ((!db_key_.is_empty() && !db_key_used_) || (db_key_.is_empty() && encryption_type_ != EncryptionType::None))) {
     aes_ctr_key_salt_ = BufferSlice();
     do_reindex();
   }
@@ -221,6 +223,11 @@ Status Binlog::init(string path, const Callback &callback, DbKey db_key, DbKey o
   return Status::OK();
 }
 
+Status Binlog::init_check_encryption(string path) {
+  check_encryption_only_ = true;
+  return init(std::move(path), Callback());
+}
+
 void Binlog::add_event(BinlogEvent &&event) {
   if (event.size_ % 4 != 0) {
     LOG(FATAL) << "Trying to add event with bad size " << event.public_to_string();
@@ -486,8 +493,82 @@ void Binlog::update_write_encryption() {
   }
 }
 
+bool Binlog::try_load_binlog_flat(const Callback &debug_callback) {
+  auto r_fd_size = fd_.get_size();
+  if (r_fd_size.is_error()) {
+    return false;
+  }
+  auto fd_size = r_fd_size.ok();
+  if (fd_size < static_cast<int64>(MIN_EVENT_SIZE)) {
+    return false;
+  }
+
+  BufferSlice data(narrow_cast<size_t>(fd_size));
+  auto r_read = fd_.pread(data.as_slice(), 0);
+  if (r_read.is_error() || r_read.ok() != data.size()) {
+    return false;
+  }
+  auto slice = data.as_slice();
+
+  // prescan the event framing before consuming anything, so encrypted or
+  // malformed binlogs can be redone by the streaming path with its own
+  // truncation diagnostics
+  size_t offset = 0;
+  while (offset + 4 <= slice.size()) {
+    auto size = static_cast<size_t>(TlParser(slice.substr(offset, 4)).fetch_int());
+    if (size < MIN_EVENT_SIZE || size > ::td::MAX_EVENT_SIZE || size % 4 != 0 || size > slice.size() - offset) {
+      return false;
+    }
+    auto type = TlParser(slice.substr(offset + 12, 4)).fetch_int();
+    if (type == BinlogEvent::ServiceTypes::AesCtrEncryption) {
+      return false;
+    }
+    offset += size;
+  }
+  if (offset != slice.size()) {
+    return false;
+  }
+
+  offset = 0;
+  while (offset < slice.size()) {
+    auto size = static_cast<size_t>(TlParser(slice.substr(offset, 4)).fetch_int());
+    BinlogEvent event;
+    event.debug_info_ = BinlogDebugInfo{__FILE__, __LINE__};
+    // events share the whole-file buffer instead of owning a copy
+    auto status = event.init(data.from_slice(slice.substr(offset, size)));
+    if (status.is_error()) {
+      LOG(ERROR) << status;
+      break;  // the file is truncated after the last successfully added event below
+    }
+    offset += size;
+    event.offset_ = static_cast<int64>(offset);
+    if (IGNORE_ERASE_HACK && event.type_ == BinlogEvent::ServiceTypes::Empty &&
+        (event.flags_ & BinlogEvent::Flags::Rewrite) != 0) {
+      // skip erase
+    } else {
+      if (debug_callback) {
+        debug_callback(event);
+      }
+      do_add_event(std::move(event));
+    }
+  }
+
+  // leave the file position where the streaming path would: at the end of the
+  // consumed data, so subsequent writes append instead of overwriting the head
+  fd_.seek(static_cast<int64>(offset)).ensure();
+  return true;
+}
+
 Status Binlog::load_binlog(const Callback &callback, const Callback &debug_callback) {
   state_ = State::Load;
+  info_.wrong_password = false;
+
+  // fast path for unencrypted binlogs: one whole-file read with events as
+  // shared slices of that buffer, instead of a copy per event out of the
+  // BufferedFd + ChainBuffer pipeline
+  if (!check_encryption_only_ && try_load_binlog_flat(debug_callback)) {
+    return finish_load_binlog(callback);
+  }
 
   buffer_writer_ = ChainBufferWriter();
   buffer_reader_ = buffer_writer_.extract_reader();
@@ -498,7 +579,6 @@ Status Binlog::load_binlog(const Callback &callback, const Callback &debug_callb
   update_read_encryption();
 
   fd_.get_poll_info().add_flags(PollFlags::Read());
-  info_.wrong_password = false;
   while (true) {
     BinlogEvent event;
     auto r_need_size = reader.read_next(&event);
@@ -532,9 +612,16 @@ Status Binlog::load_binlog(const Callback &callback, const Callback &debug_callb
         if (info_.wrong_password) {
           return Status::OK();
         }
+        if (check_encryption_only_) {
+          // the encryption event, if any, is always the first event in the binlog,
+          // so the encryption state is known once a single event has been read
+          return Status::OK();
+        }
       }
     } else {
-      TRY_STATUS(fd_.flush_read(max(need_size, static_cast<size_t>(4096))));
+      // read big sequential chunks: the whole binlog is consumed on load,
+      // and 4KB reads would cost a syscall per few events
+      TRY_STATUS(fd_.flush_read(max(need_size, static_cast<size_t>(MAX_EVENT_SIZE))));
       buffer_reader_.sync_with_writer();
       if (byte_flow_flag_) {
         byte_flow_source_.wakeup();
@@ -545,6 +632,10 @@ Status Binlog::load_binlog(const Callback &callback, const Callback &debug_callb
     }
   }
 
+  return finish_load_binlog(callback);
+}
+
+Status Binlog::finish_load_binlog(const Callback &callback) {
   auto offset = processor_->offset();
   processor_->for_each([&](BinlogEvent &event) {
     VLOG(binlog) << "Replay binlog event: " << event.public_to_string();
@@ -647,8 +738,17 @@ void Binlog::do_reindex() {
   fd_size_ = 0;
   fd_events_ = 0;
   reset_encryption();
+  int64 flushed_size = 0;
   processor_->for_each([&](BinlogEvent &event) {
     do_event(std::move(event));  // NB: no move is actually happens
+    // write the new binlog out in bounded slices instead of growing one
+    // buffer with the whole compacted image and writing it in a single burst
+    if (fd_size_ - flushed_size >= REINDEX_BUFFER_SIZE) {
+      flush();
+      flushed_size = fd_size_;
+      VLOG(binlog) << "Regenerate index: " << tag("name", path_) << tag("events", fd_events_)
+                   << tag("size", format::as_size(fd_size_));
+    }
   });
   need_sync_ = true;  // must sync creation of the file
   sync();
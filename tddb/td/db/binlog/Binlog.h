@@ -53,6 +53,10 @@ class Binlog {
   Status init(string path, const Callback &callback, DbKey db_key = DbKey::empty(), DbKey old_db_key = DbKey::empty(),
               int32 dummy = -1, const Callback &debug_callback = Callback()) TD_WARN_UNUSED_RESULT;
 
+  // reads only the binlog prefix needed to understand whether the binlog is encrypted;
+  // the binlog must be closed afterwards and can't be used for anything else
+  Status init_check_encryption(string path) TD_WARN_UNUSED_RESULT;
+
   uint64 next_id() {
     return ++last_id_;
   }
@@ -130,15 +134,19 @@ class Binlog {
   uint64 last_id_{0};
   double need_flush_since_ = 0;
   bool need_sync_{false};
+  bool check_encryption_only_{false};
   enum class State { Empty, Load, Reindex, Run } state_{State::Empty};
 
   static constexpr uint32 MAX_EVENT_SIZE = 65536;
+  static constexpr int64 REINDEX_BUFFER_SIZE = 1 << 20;
 
   Result<FileFd> open_binlog(const string &path, int32 flags);
   size_t flush_events_buffer(bool force);
   void do_add_event(BinlogEvent &&event);
   void do_event(BinlogEvent &&event);
   Status load_binlog(const Callback &callback, const Callback &debug_callback = Callback()) TD_WARN_UNUSED_RESULT;
+  bool try_load_binlog_flat(const Callback &debug_callback);
+  Status finish_load_binlog(const Callback &callback) TD_WARN_UNUSED_RESULT;
   void do_reindex();
 
   void update_encryption(Slice key, Slice iv);
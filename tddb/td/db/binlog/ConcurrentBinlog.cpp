@@ -78,8 +78,10 @@ class BinlogActor : public Actor {
   bool lazy_sync_flag_ = false;
   bool flush_flag_ = false;
   double wakeup_at_ = 0;
+  double last_sync_at_ = 0;
 
   static constexpr double FLUSH_TIMEOUT = 0.001;  // 1ms
+  static constexpr double SYNC_TIMEOUT = 0.003;   // 3ms
 
   void wakeup_after(double after) {
     auto now = Time::now_cached();
@@ -124,10 +126,28 @@ class BinlogActor : public Actor {
     }
     if (!force_sync_flag_) {
       force_sync_flag_ = true;
-      wakeup_after(0.003);
+      // group commit: if the previous sync is long finished, sync at once;
+      // otherwise commits are batched until SYNC_TIMEOUT passes since it,
+      // so under load one fsync covers many events
+      if (Time::now_cached() >= last_sync_at_ + SYNC_TIMEOUT) {
+        do_sync();
+      } else {
+        wakeup_at(last_sync_at_ + SYNC_TIMEOUT);
+      }
     }
   }
 
+  void do_sync() {
+    binlog_->sync();
+    last_sync_at_ = Time::now_cached();
+    force_sync_flag_ = false;
+    lazy_sync_flag_ = false;
+    for (auto &promise : sync_promises_) {
+      promise.set_value(Unit());
+    }
+    sync_promises_.clear();
+  }
+
   void do_lazy_sync(Promise<> &&promise) {
     if (!promise) {
       return;
@@ -147,12 +167,8 @@ class BinlogActor : public Actor {
     flush_flag_ = false;
     wakeup_at_ = 0;
     if (need_sync) {
-      binlog_->sync();
+      do_sync();
       // LOG(ERROR) << "BINLOG SYNC";
-      for (auto &promise : sync_promises_) {
-        promise.set_value(Unit());
-      }
-      sync_promises_.clear();
     } else if (need_flush) {
       try_flush();
       // LOG(ERROR) << "BINLOG FLUSH";
@@ -138,7 +138,18 @@ void GetHostByNameActor::run(string host, int port, bool prefer_ipv6, Promise<IP
   auto &value = cache_[prefer_ipv6].emplace(ascii_host, Value{{}, 0}).first->second;
   auto begin_time = Time::now();
   if (value.expires_at > begin_time) {
-    return promise.set_result(value.get_ip_port(port));
+    promise.set_result(value.get_ip_port(port));
+    if (value.expires_at < begin_time + REFRESH_BEFORE_EXPIRE_TIME && value.ip.is_ok()) {
+      // refresh the cache in the background, so that an expired entry
+      // doesn't stall the next reconnect on a full resolution
+      auto &query = active_queries_[prefer_ipv6][ascii_host];
+      if (query.query.empty()) {
+        query.real_host = std::move(host);
+        query.begin_time = begin_time;
+        run_query(std::move(ascii_host), prefer_ipv6, query);
+      }
+    }
+    return;
   }
 
   auto &query = active_queries_[prefer_ipv6][ascii_host];
@@ -178,7 +189,7 @@ void GetHostByNameActor::on_query_result(std::string host, bool prefer_ipv6, Res
   auto query_it = active_queries_[prefer_ipv6].find(host);
   CHECK(query_it != active_queries_[prefer_ipv6].end());
   auto &query = query_it->second;
-  CHECK(!query.promises.empty());
+  // query.promises may be empty for a background cache refresh
   CHECK(!query.query.empty());
 
   if (result.is_error() && query.pos < options_.resolver_types.size()) {
@@ -194,7 +205,11 @@ void GetHostByNameActor::on_query_result(std::string host, bool prefer_ipv6, Res
   auto value_it = cache_[prefer_ipv6].find(host);
   CHECK(value_it != cache_[prefer_ipv6].end());
   auto cache_timeout = result.is_ok() ? options_.ok_timeout : options_.error_timeout;
-  value_it->second = Value{std::move(result), end_time + cache_timeout};
+  if (result.is_error() && value_it->second.ip.is_ok() && value_it->second.expires_at > end_time) {
+    // a failed refresh must not replace a still-valid address with an error
+  } else {
+    value_it->second = Value{std::move(result), end_time + cache_timeout};
+  }
   active_queries_[prefer_ipv6].erase(query_it);
 
   for (auto &promise : promises) {
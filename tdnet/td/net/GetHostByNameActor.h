@@ -39,6 +39,8 @@ class GetHostByNameActor final : public Actor {
   void run(std::string host, int port, bool prefer_ipv6, Promise<IPAddress> promise);
 
  private:
+  static constexpr int32 REFRESH_BEFORE_EXPIRE_TIME = 120;  // seconds
+
   void on_query_result(std::string host, bool prefer_ipv6, Result<IPAddress> result);
 
   struct Value {
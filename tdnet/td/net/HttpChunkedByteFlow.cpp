@@ -50,6 +50,10 @@ void HttpChunkedByteFlow::loop() {
       return finish(Status::Error(PSLICE() << "Too big query " << tag("size", input_->size())));
     }
 
+    // zero-copy: cut_head shares the input chain nodes, and ChainBufferWriter::append links
+    // payload slices into the output chain instead of copying them, except for slices so small
+    // that a copy is cheaper than an extra node. The consumer merges the chain into a contiguous
+    // buffer only if it needs one
     output_.append(input_->cut_head(ready));
     len_ -= ready;
     if (uncommited_size_ >= MIN_UPDATE_SIZE) {
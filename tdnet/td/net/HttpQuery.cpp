@@ -12,6 +12,19 @@
 
 namespace td {
 
+void HttpQuery::clear() {
+  container_.clear();
+  type_ = Type::EMPTY;
+  url_path_ = MutableSlice();
+  args_.clear();
+  code_ = 0;
+  reason_ = MutableSlice();
+  keep_alive_ = true;
+  headers_.clear();
+  files_.clear();
+  content_ = MutableSlice();
+}
+
 Slice HttpQuery::get_header(Slice key) const {
   auto it = std::find_if(headers_.begin(), headers_.end(),
                          [&key](const std::pair<MutableSlice, MutableSlice> &s) { return s.first == key; });
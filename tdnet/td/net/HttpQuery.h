@@ -33,6 +33,10 @@ class HttpQuery {
   std::vector<HttpFile> files_;
   MutableSlice content_;
 
+  // resets the query for reuse, keeping the capacity of the containers, so a connection
+  // which processes many requests doesn't reallocate them for every request
+  void clear();
+
   Slice get_header(Slice key) const;
 
   MutableSlice get_arg(Slice key) const;
@@ -191,7 +191,7 @@ Result<size_t> HttpReader::read_next(HttpQuery *query) {
 
         auto size = content_->size();
         if (size) {
-          TRY_STATUS(save_file_part(content_->cut_head(size).move_as_buffer_slice()));
+          TRY_STATUS(save_file_part(content_->cut_head(size)));
         }
         if (flow_sink_.is_ready()) {
           query_->files_.emplace_back("file", "", content_type_.str(), file_size_, temp_file_name_);
@@ -432,7 +432,7 @@ Result<bool> HttpReader::parse_multipart_form_data() {
         return false;
       case ReadFile: {
         if (find_boundary(content_->clone(), boundary_, form_data_read_length_)) {
-          auto file_part = content_->cut_head(form_data_read_length_).move_as_buffer_slice();
+          auto file_part = content_->cut_head(form_data_read_length_);
           content_->advance(boundary_.size());
           form_data_skipped_length_ += form_data_read_length_ + boundary_.size();
           form_data_read_length_ = 0;
@@ -446,8 +446,7 @@ Result<bool> HttpReader::parse_multipart_form_data() {
           continue;
         }
 
-        // TODO optimize?
-        auto file_part = content_->cut_head(form_data_read_length_).move_as_buffer_slice();
+        auto file_part = content_->cut_head(form_data_read_length_);
         form_data_skipped_length_ += form_data_read_length_;
         form_data_read_length_ = 0;
         CHECK(content_->size() < boundary_.size());
@@ -774,7 +773,7 @@ Status HttpReader::try_open_temp_file(Slice directory_name, CSlice desired_file_
   return Status::OK();
 }
 
-Status HttpReader::save_file_part(BufferSlice &&file_part) {
+Status HttpReader::save_file_part(ChainBufferReader &&file_part) {
   file_size_ += narrow_cast<int64>(file_part.size());
   if (file_size_ > MAX_FILE_SIZE) {
     clean_temporary_file();
@@ -783,10 +782,15 @@ Status HttpReader::save_file_part(BufferSlice &&file_part) {
   }
 
   LOG(DEBUG) << "Save file part of size " << file_part.size() << " to file " << temp_file_name_;
-  auto result_written = temp_file_.write(file_part.as_slice());
-  if (result_written.is_error() || result_written.ok() != file_part.size()) {
-    clean_temporary_file();
-    return Status::Error(500, "Internal server error: can't upload the file");
+  while (!file_part.empty()) {
+    // write each chain node as is instead of merging them into a single copy
+    auto slice = file_part.prepare_read();
+    auto result_written = temp_file_.write(slice);
+    if (result_written.is_error() || result_written.ok() != slice.size()) {
+      clean_temporary_file();
+      return Status::Error(500, "Internal server error: can't upload the file");
+    }
+    file_part.confirm_read(slice.size());
   }
   return Status::OK();
 }
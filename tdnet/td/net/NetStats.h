@@ -111,6 +111,7 @@ class NetStats {
       uint64 unsync_size = 0;
       std::atomic<uint64> read_size{0};
       std::atomic<uint64> write_size{0};
+      char padding[TD_CONCURRENCY_PAD - 4 * sizeof(uint64)];  // counters of different schedulers must not share a cache line
     };
     SchedulerLocalStorage<LocalNetStats> local_net_stats_;
     unique_ptr<Callback> callback_;
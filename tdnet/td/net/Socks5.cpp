@@ -13,22 +13,27 @@
 
 namespace td {
 
-void Socks5::send_greeting() {
+Status Socks5::send_greeting() {
   VLOG(proxy) << "Send greeting to proxy";
   CHECK(state_ == State::SendGreeting);
-  state_ = State::WaitGreetingResponse;
 
+  bool use_username = !username_.empty();
   string greeting;
   greeting += '\x05';
-  bool use_username = !username_.empty();
-  char authentication_count = use_username ? '\x02' : '\x01';
-  greeting += authentication_count;
-  greeting += '\0';
+  greeting += '\x01';  // exactly one authentication method is offered
+  greeting += use_username ? '\x02' : '\0';
+  fd_.output_buffer().append(greeting);
+
+  // the offered method is the only one the server can select, so the following requests
+  // can be pipelined into the same packet instead of waiting for a response to each of
+  // them, which saves two round trips; on an unexpected reply the connection fails as usual
   if (use_username) {
-    greeting += '\x02';
+    TRY_STATUS(send_username_password());
   }
+  send_ip_address();
 
-  fd_.output_buffer().append(greeting);
+  state_ = State::WaitGreetingResponse;
+  return Status::OK();
 }
 
 Status Socks5::wait_greeting_response() {
@@ -43,12 +48,13 @@ Status Socks5::wait_greeting_response() {
     return Status::Error(PSLICE() << "Unsupported socks protocol version " << int(slice[0]));
   }
   auto authentication_method = slice[1];
-  if (authentication_method == '\0') {
-    send_ip_address();
+  if (authentication_method == '\0' && username_.empty()) {
+    state_ = State::WaitIpAddressResponse;
     return Status::OK();
   }
-  if (authentication_method == '\x02') {
-    return send_username_password();
+  if (authentication_method == '\x02' && !username_.empty()) {
+    state_ = State::WaitPasswordResponse;
+    return Status::OK();
   }
   return Status::Error("Unsupported authentication mode");
 }
@@ -69,7 +75,6 @@ Status Socks5::send_username_password() {
   request += narrow_cast<char>(password_.size());
   request += password_;
   fd_.output_buffer().append(request);
-  state_ = State::WaitPasswordResponse;
 
   return Status::OK();
 }
@@ -89,7 +94,7 @@ Status Socks5::wait_password_response() {
     return Status::Error("Wrong username or password");
   }
 
-  send_ip_address();
+  state_ = State::WaitIpAddressResponse;
   return Status::OK();
 }
 
@@ -115,7 +120,6 @@ void Socks5::send_ip_address() {
   request += static_cast<char>((port >> 8) & 255);
   request += static_cast<char>(port & 255);
   fd_.output_buffer().append(request);
-  state_ = State::WaitIpAddressResponse;
 }
 
 Status Socks5::wait_ip_address_response() {
@@ -166,21 +170,29 @@ Status Socks5::wait_ip_address_response() {
 }
 
 Status Socks5::loop_impl() {
-  switch (state_) {
-    case State::SendGreeting:
-      send_greeting();
-      break;
-    case State::WaitGreetingResponse:
-      TRY_STATUS(wait_greeting_response());
-      break;
-    case State::WaitPasswordResponse:
-      TRY_STATUS(wait_password_response());
-      break;
-    case State::WaitIpAddressResponse:
-      TRY_STATUS(wait_ip_address_response());
+  // responses to the pipelined requests may arrive in a single packet,
+  // so try to process the next response while the previous one was processed
+  while (true) {
+    auto old_size = fd_.input_buffer().size();
+    switch (state_) {
+      case State::SendGreeting:
+        TRY_STATUS(send_greeting());
+        break;
+      case State::WaitGreetingResponse:
+        TRY_STATUS(wait_greeting_response());
+        break;
+      case State::WaitPasswordResponse:
+        TRY_STATUS(wait_password_response());
+        break;
+      case State::WaitIpAddressResponse:
+        TRY_STATUS(wait_ip_address_response());
+        break;
+      default:
+        UNREACHABLE();
+    }
+    if (fd_.input_buffer().size() == old_size) {
       break;
-    default:
-      UNREACHABLE();
+    }
   }
   return Status::OK();
 }
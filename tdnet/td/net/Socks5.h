@@ -24,7 +24,7 @@ class Socks5 : public TransparentProxy {
     WaitIpAddressResponse
   } state_ = State::SendGreeting;
 
-  void send_greeting();
+  Status send_greeting();
   Status wait_greeting_response();
   Status send_username_password();
 
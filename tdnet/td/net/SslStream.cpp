@@ -235,7 +235,11 @@ class SslStreamImpl {
     options |= SSL_OP_NO_SSLv3;
 #endif
     SSL_CTX_set_options(ssl_ctx, options);
-    SSL_CTX_set_mode(ssl_ctx, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER | SSL_MODE_ENABLE_PARTIAL_WRITE);
+    // kernel TLS offload is not applicable here: the connection is driven through a memory BIO
+    // (see BIO_s_sslstream), and the encrypted records may be reframed by an obfuscated transport
+    // before they reach the socket, so OpenSSL never owns a socket to hand off to the kernel
+    SSL_CTX_set_mode(ssl_ctx,
+                     SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER | SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_RELEASE_BUFFERS);
 
     if (cert_file.empty()) {
 #if TD_PORT_WINDOWS
@@ -23,14 +23,17 @@
 namespace td {
 
 Wget::Wget(Promise<unique_ptr<HttpQuery>> promise, string url, std::vector<std::pair<string, string>> headers,
-           int32 timeout_in, int32 ttl, bool prefer_ipv6, SslStream::VerifyPeer verify_peer)
+           int32 timeout_in, int32 ttl, bool prefer_ipv6, SslStream::VerifyPeer verify_peer, size_t max_post_size,
+           size_t max_files)
     : promise_(std::move(promise))
     , input_url_(std::move(url))
     , headers_(std::move(headers))
     , timeout_in_(timeout_in)
     , ttl_(ttl)
     , prefer_ipv6_(prefer_ipv6)
-    , verify_peer_(verify_peer) {
+    , verify_peer_(verify_peer)
+    , max_post_size_(max_post_size)
+    , max_files_(max_files) {
 }
 
 Status Wget::try_init() {
@@ -65,14 +68,14 @@ Status Wget::try_init() {
 
   TRY_RESULT(fd, SocketFd::open(addr));
   if (url.protocol_ == HttpUrl::Protocol::HTTP) {
-    connection_ = create_actor<HttpOutboundConnection>("Connect", std::move(fd), SslStream{},
-                                                       std::numeric_limits<std::size_t>::max(), 0, 0,
-                                                       ActorOwn<HttpOutboundConnection::Callback>(actor_id(this)));
+    connection_ =
+        create_actor<HttpOutboundConnection>("Connect", std::move(fd), SslStream{}, max_post_size_, max_files_, 0,
+                                             ActorOwn<HttpOutboundConnection::Callback>(actor_id(this)));
   } else {
     TRY_RESULT(ssl_stream, SslStream::create(url.host_, CSlice() /* certificate */, verify_peer_));
-    connection_ = create_actor<HttpOutboundConnection>("Connect", std::move(fd), std::move(ssl_stream),
-                                                       std::numeric_limits<std::size_t>::max(), 0, 0,
-                                                       ActorOwn<HttpOutboundConnection::Callback>(actor_id(this)));
+    connection_ =
+        create_actor<HttpOutboundConnection>("Connect", std::move(fd), std::move(ssl_stream), max_post_size_,
+                                             max_files_, 0, ActorOwn<HttpOutboundConnection::Callback>(actor_id(this)));
   }
 
   send_closure(connection_, &HttpOutboundConnection::write_next, BufferSlice(header));
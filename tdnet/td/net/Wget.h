@@ -16,15 +16,19 @@
 #include "td/utils/common.h"
 #include "td/utils/Status.h"
 
+#include <limits>
 #include <utility>
 
 namespace td {
 
 class Wget : public HttpOutboundConnection::Callback {
  public:
+  // responses bigger than max_post_size are streamed with bounded memory usage into a
+  // temporary file, which is returned in HttpQuery::files_; max_files must be positive for that
   explicit Wget(Promise<unique_ptr<HttpQuery>> promise, string url, std::vector<std::pair<string, string>> headers = {},
                 int32 timeout_in = 10, int32 ttl = 3, bool prefer_ipv6 = false,
-                SslStream::VerifyPeer verify_peer = SslStream::VerifyPeer::On);
+                SslStream::VerifyPeer verify_peer = SslStream::VerifyPeer::On,
+                size_t max_post_size = std::numeric_limits<std::size_t>::max(), size_t max_files = 0);
 
  private:
   Status try_init();
@@ -46,6 +50,8 @@ class Wget : public HttpOutboundConnection::Callback {
   int32 ttl_;
   bool prefer_ipv6_ = false;
   SslStream::VerifyPeer verify_peer_;
+  size_t max_post_size_;
+  size_t max_files_;
 };
 
 }  // namespace td
@@ -0,0 +1,132 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/AsyncFileLog.h"
+
+#if !TD_THREAD_UNSUPPORTED && !TD_EVENTFD_UNSUPPORTED
+
+#include "td/utils/common.h"
+#include "td/utils/FileLog.h"
+#include "td/utils/logging.h"
+#include "td/utils/MpscPollableQueue.h"
+#include "td/utils/Slice.h"
+
+#include <atomic>
+
+namespace td {
+
+namespace detail {
+
+class AsyncFileLogImpl : public LogInterface {
+ public:
+  Status init(string path, int64 rotate_threshold, bool redirect_stderr) {
+    TRY_STATUS(file_log_.init(std::move(path), rotate_threshold, redirect_stderr));
+    queue_.init();
+    logging_thread_ = thread([this] { this->run(); });
+    return Status::OK();
+  }
+
+  AsyncFileLogImpl() = default;
+  AsyncFileLogImpl(const AsyncFileLogImpl &) = delete;
+  AsyncFileLogImpl &operator=(const AsyncFileLogImpl &) = delete;
+  AsyncFileLogImpl(AsyncFileLogImpl &&) = delete;
+  AsyncFileLogImpl &operator=(AsyncFileLogImpl &&) = delete;
+  ~AsyncFileLogImpl() override {
+    queue_.writer_put(Query{Query::Type::Close, string()});
+    logging_thread_.join();
+  }
+
+  vector<string> get_file_paths() override {
+    return file_log_.get_file_paths();
+  }
+
+  void append(CSlice cslice, int log_level) override {
+    auto size = cslice.size();
+    if (pending_size_.fetch_add(size, std::memory_order_relaxed) + size > MAX_PENDING_SIZE) {
+      // the logging thread can't keep up; dropping is better than stalling the caller
+      pending_size_.fetch_sub(size, std::memory_order_relaxed);
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      queue_.writer_put(Query{Query::Type::Log, cslice.str()});
+    }
+    if (log_level == VERBOSITY_NAME(FATAL)) {
+      process_fatal_error(cslice);
+    }
+  }
+
+  void rotate() override {
+    queue_.writer_put(Query{Query::Type::Rotate, string()});
+  }
+
+ private:
+  struct Query {
+    enum class Type { Log, Rotate, Close };
+    Type type;
+    string data;
+  };
+  static constexpr size_t MAX_PENDING_SIZE = 1 << 22;
+
+  FileLog file_log_;
+  MpscPollableQueue<Query> queue_;
+  thread logging_thread_;
+  std::atomic<size_t> pending_size_{0};
+  std::atomic<uint64> dropped_count_{0};
+
+  void run() {
+    string batch;
+    while (true) {
+      auto ready_count = queue_.reader_wait_nonblock();
+      if (ready_count == 0) {
+        queue_.reader_get_event_fd().wait(1000);
+        continue;
+      }
+      batch.clear();
+      bool need_rotate = false;
+      bool need_close = false;
+      while (ready_count-- > 0) {
+        auto query = queue_.reader_get_unsafe();
+        switch (query.type) {
+          case Query::Type::Log:
+            batch += query.data;
+            break;
+          case Query::Type::Rotate:
+            need_rotate = true;
+            break;
+          case Query::Type::Close:
+            need_close = true;
+            break;
+        }
+      }
+      pending_size_.fetch_sub(batch.size(), std::memory_order_relaxed);
+      auto dropped_count = dropped_count_.exchange(0, std::memory_order_relaxed);
+      if (dropped_count != 0) {
+        batch += PSTRING() << "Dropped " << dropped_count << " log messages\n";
+      }
+      if (!batch.empty()) {
+        // all ready messages are written with a single write syscall
+        file_log_.append(batch, -1);
+      }
+      if (need_rotate) {
+        file_log_.rotate();
+      }
+      if (need_close) {
+        break;
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+Result<unique_ptr<LogInterface>> AsyncFileLog::create(string path, int64 rotate_threshold, bool redirect_stderr) {
+  auto res = make_unique<detail::AsyncFileLogImpl>();
+  TRY_STATUS(res->init(std::move(path), rotate_threshold, redirect_stderr));
+  return std::move(res);
+}
+
+}  // namespace td
+
+#endif
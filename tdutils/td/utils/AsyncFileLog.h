@@ -0,0 +1,31 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/thread.h"
+#include "td/utils/Status.h"
+
+namespace td {
+
+#if !TD_THREAD_UNSUPPORTED && !TD_EVENTFD_UNSUPPORTED
+
+// Writes log messages to a file from a dedicated thread, so verbose logging
+// doesn't stall the threads producing the messages. Messages are dropped and
+// counted instead of blocking the producers when the disk can't keep up.
+class AsyncFileLog {
+ public:
+  static constexpr int64 DEFAULT_ROTATE_THRESHOLD = 10 * (1 << 20);
+
+  static Result<unique_ptr<LogInterface>> create(string path, int64 rotate_threshold = DEFAULT_ROTATE_THRESHOLD,
+                                                 bool redirect_stderr = true);
+};
+
+#endif
+
+}  // namespace td
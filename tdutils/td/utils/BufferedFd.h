@@ -76,6 +76,10 @@ class BufferedFd : public BufferedFdBase<FdT> {
   Result<size_t> flush_read(size_t max_read = std::numeric_limits<size_t>::max()) TD_WARN_UNUSED_RESULT;
   Result<size_t> flush_write() TD_WARN_UNUSED_RESULT;
 
+  // Moves already received bytes into a buffer with capacity at least `size`, so the
+  // next `size` input bytes will be stored contiguously and can be read without a copy
+  void make_input_solid(size_t size);
+
   // Yep, direct access to buffers. It is IO interface too.
   ChainBufferReader &input_buffer();
   ChainBufferWriter &output_buffer();
@@ -103,6 +107,11 @@ Result<size_t> BufferedFdBase<FdT>::flush_read(size_t max_read) {
   return result;
 }
 
+// gathers up to 20 ready chunks of the output buffer into a single writev call,
+// so heavily chunked output still costs one syscall per flush. Reads are not
+// scattered the same way: that would mean allocating chunks before knowing
+// whether the socket has data for them, and a single chunk almost always fits
+// everything a wakeup delivers
 template <class FdT>
 Result<size_t> BufferedFdBase<FdT>::flush_write() {
   // TODO: sync on demand
@@ -200,6 +209,23 @@ Result<size_t> BufferedFd<FdT>::flush_write() {
   return result;
 }
 
+template <class FdT>
+void BufferedFd<FdT>::make_input_solid(size_t size) {
+  input_reader_.sync_with_writer();
+  if (input_reader_.size() >= size) {
+    return;
+  }
+  ChainBufferWriter new_input_writer;
+  new_input_writer.init(size);
+  while (!input_reader_.empty()) {
+    auto slice = input_reader_.prepare_read();
+    new_input_writer.append(slice);
+    input_reader_.confirm_read(slice.size());
+  }
+  input_writer_ = std::move(new_input_writer);
+  input_reader_ = input_writer_.extract_reader();
+}
+
 // Yep, direct access to buffers. It is IO interface too.
 template <class FdT>
 ChainBufferReader &BufferedFd<FdT>::input_buffer() {
@@ -26,7 +26,7 @@ namespace detail {
 class UdpWriter {
  public:
   static Status write_once(UdpSocketFd &fd, VectorQueue<UdpMessage> &queue) TD_WARN_UNUSED_RESULT {
-    std::array<UdpSocketFd::OutboundMessage, 16> messages;
+    std::array<UdpSocketFd::OutboundMessage, UdpSocketFd::max_message_batch_size> messages;
     auto to_send = queue.as_span();
     size_t to_send_n = td::min(messages.size(), to_send.size());
     to_send.truncate(to_send_n);
@@ -98,7 +98,7 @@ class UdpReader {
   }
 
  private:
-  enum : size_t { BUFFER_SIZE = 16 };
+  enum : size_t { BUFFER_SIZE = UdpSocketFd::max_message_batch_size };
   std::array<UdpSocketFd::InboundMessage, BUFFER_SIZE> messages_;
   std::array<UdpReaderHelper, BUFFER_SIZE> helpers_;
 };
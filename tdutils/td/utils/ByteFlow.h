@@ -125,6 +125,10 @@ class ByteFlowBase : public ByteFlowBaseCommon {
   ChainBufferReader output_reader_ = output_.extract_reader();
 };
 
+// base for transform-in-place stages: output_ is a reader view over the same chain as input_,
+// so the stage rewrites bytes where they are and the downstream stage sees the same buffer nodes.
+// A chain of such stages touches each byte once per transform with no per-stage buffers;
+// AesCtrByteFlow uses this in the obfuscated TCP transport
 class ByteFlowInplaceBase : public ByteFlowBaseCommon {
  public:
   ByteFlowInplaceBase() = default;
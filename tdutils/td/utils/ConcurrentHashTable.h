@@ -12,7 +12,6 @@
 #include "td/utils/port/thread_local.h"
 
 #include <atomic>
-#include <condition_variable>
 #include <mutex>
 
 namespace td {
@@ -94,10 +93,19 @@ class AtomicHashArray {
 };
 
 // Simple concurrent hash map with multiple limitations
+//
+// The table is resized incrementally: while a resize is in progress both the old and the new
+// table are alive, and each insert moves a few chunks of the old table into the new one, so
+// no operation ever has to copy the whole table. Values committed to the old table are fenced
+// with migrate_value after they are copied, and operations that see the fence continue in the
+// new table. While a resize is published the new table decides which of two racing inserts of
+// the same key won: values are only ever moved into it with a compare-exchange from an empty
+// slot, and a thread that committed to the old table revalidates the resize pointer and
+// replays its insert through the new table, repairing its old slot if it lost.
 template <class KeyT, class ValueT>
 class ConcurrentHashMap {
   using HashMap = AtomicHashArray<KeyT, std::atomic<ValueT>>;
-  static HazardPointers<HashMap> hp_;
+  static HazardPointers<HashMap, 2> hp_;
 
  public:
   explicit ConcurrentHashMap(size_t n = 32) {
@@ -109,6 +117,7 @@ class ConcurrentHashMap {
   ConcurrentHashMap(ConcurrentHashMap &&) = delete;
   ConcurrentHashMap &operator=(ConcurrentHashMap &&) = delete;
   ~ConcurrentHashMap() {
+    unique_ptr<HashMap>(next_hash_map_.load()).reset();
     unique_ptr<HashMap>(hash_map_.load()).reset();
   }
 
@@ -116,6 +125,14 @@ class ConcurrentHashMap {
     return "ConcurrrentHashMap";
   }
 
+  // resized-away tables are retired through hazard pointers, which reclaim a table as soon as no
+  // operation protects it and bound unreclaimed garbage per thread. Epoch-based reclamation was
+  // considered instead, but a single thread that stops advancing its epoch keeps every retired
+  // table alive, which is exactly the unbounded growth a long-lived cache must avoid
+  static size_t unreclaimed_tables_count_unsafe() {
+    return hp_.to_delete_size_unsafe();
+  }
+
   static KeyT empty_key() {
     return KeyT{};
   }
@@ -129,53 +146,143 @@ class ConcurrentHashMap {
   ValueT insert(KeyT key, ValueT value) {
     CHECK(key != empty_key());
     CHECK(value != migrate_value());
-    typename HazardPointers<HashMap>::Holder holder(hp_, get_thread_id(), 0);
+    auto thread_id = get_thread_id();
     while (true) {
-      auto hash_map = holder.protect(hash_map_);
-      if (!hash_map) {
-        do_migrate(nullptr);
-        continue;
-      }
+      bool reread_winner = false;
+      {
+        typename HazardPointers<HashMap, 2>::Holder next_holder(hp_, thread_id, 1);
+        typename HazardPointers<HashMap, 2>::Holder holder(hp_, thread_id, 0);
+        auto next = next_holder.protect(next_hash_map_);
+        auto hash_map = holder.protect(hash_map_);
 
-      bool ok = false;
-      ValueT inserted_value;
-      hash_map->with_value(key, true, [&](auto &node_value) {
-        ValueT expected_value = this->empty_value();
-        if (node_value.compare_exchange_strong(expected_value, value, std::memory_order_release,
-                                               std::memory_order_acquire)) {
-          ok = true;
-          inserted_value = value;
-        } else {
-          if (expected_value == this->migrate_value()) {
-            ok = false;
+        if (next == nullptr) {
+          bool ok = false;
+          bool committed = false;
+          ValueT inserted_value{};
+          bool has_slot = hash_map->with_value(key, true, [&](auto &node_value) {
+            ValueT expected_value = this->empty_value();
+            if (node_value.compare_exchange_strong(expected_value, value, std::memory_order_release,
+                                                   std::memory_order_acquire)) {
+              ok = true;
+              committed = true;
+              inserted_value = value;
+            } else if (expected_value != this->migrate_value()) {
+              ok = true;
+              inserted_value = expected_value;
+            }
+          });
+          if (ok) {
+            // revalidate the resize pointer: a resize published after `next` was loaded lets an
+            // insert of the same key, which found it absent in this table, commit to the new
+            // table, and during a resize the new table decides which racing value won
+            auto published_next = next_holder.protect(next_hash_map_);
+            if (published_next == nullptr) {
+              return inserted_value;
+            }
+            if (hash_map_.load(std::memory_order_acquire) == hash_map) {
+              ValueT winner{};
+              if (resolve_in_next(published_next, key, inserted_value, winner)) {
+                if (committed && winner != inserted_value) {
+                  // the racing value won; repair the slot, so the losing value can't be read
+                  // after the winning one. The repair fails only if the migration has already
+                  // fenced the slot
+                  hash_map->with_value(key, false, [&](auto &node_value) {
+                    ValueT expected_value = inserted_value;
+                    node_value.compare_exchange_strong(expected_value, winner, std::memory_order_release,
+                                                       std::memory_order_relaxed);
+                  });
+                }
+                return winner;
+              }
+            }
+            // the resize finished or moved past this key; reread the winner
+            reread_winner = true;
           } else {
-            ok = true;
-            inserted_value = expected_value;
+            if (!has_slot) {
+              init_migrate(hash_map);
+            }
+            // the value is fenced with migrate_value, continue in the new table
+          }
+        } else {
+          ValueT old_value = empty_value();
+          bool has_old_value =
+              hash_map->with_value(key, false, [&](auto &node_value) { old_value = node_value.load(std::memory_order_acquire); });
+          if (has_old_value && old_value != migrate_value() && old_value != empty_value()) {
+            // a value committed to the old table competes through the new table like every
+            // other insert of this resize; moving it there early is just a part of the
+            // migration done ahead of time
+            ValueT winner{};
+            if (resolve_in_next(next, key, old_value, winner)) {
+              return winner;
+            }
+            reread_winner = true;
+          } else if (!has_old_value || old_value == migrate_value()) {
+            // the key is either already moved to the new table or was never committed to the old one.
+            // space for all values of the old table is reserved in the new one, so new keys may be
+            // added only while the insert budget lasts; after that help to finish the resize instead
+            if (migrate_insert_budget_.fetch_sub(1, std::memory_order_relaxed) > 0) {
+              bool ok = false;
+              ValueT inserted_value{};
+              next->with_value(key, true, [&](auto &node_value) {
+                ValueT expected_value = this->empty_value();
+                if (node_value.compare_exchange_strong(expected_value, value, std::memory_order_release,
+                                                       std::memory_order_acquire)) {
+                  ok = true;
+                  inserted_value = value;
+                } else if (expected_value != this->migrate_value()) {
+                  ok = true;
+                  inserted_value = expected_value;
+                }
+                // otherwise the new table already became the current one and is resized again, retry
+              });
+              if (ok) {
+                return inserted_value;
+              }
+            }
+            // help to finish the resize and retry
           }
+          // otherwise a concurrent insert into the old table is in flight, retry
         }
-      });
-      if (ok) {
-        return inserted_value;
       }
-      do_migrate(hash_map);
+      if (reread_winner) {
+        // the winner is already committed and has been carried to a newer table by the
+        // migration; a plain find locates it without holding the protected pointers
+        return find(key, value);
+      }
+      help_migrate(MIGRATE_CHUNKS_PER_OPERATION);
     }
   }
 
   ValueT find(KeyT key, ValueT value) {
-    typename HazardPointers<HashMap>::Holder holder(hp_, get_thread_id(), 0);
+    auto thread_id = get_thread_id();
+    typename HazardPointers<HashMap, 2>::Holder next_holder(hp_, thread_id, 1);
+    typename HazardPointers<HashMap, 2>::Holder holder(hp_, thread_id, 0);
     while (true) {
+      auto next = next_holder.protect(next_hash_map_);
       auto hash_map = holder.protect(hash_map_);
-      if (!hash_map) {
-        do_migrate(nullptr);
+
+      ValueT result = value;
+      bool has_value =
+          hash_map->with_value(key, false, [&](auto &node_value) { result = node_value.load(std::memory_order_acquire); });
+      if (has_value && result != migrate_value()) {
+        return result;
+      }
+      if (next == nullptr) {
+        if (!has_value) {
+          return value;
+        }
+        // the resize was finished between the two loads, retry
         continue;
       }
 
-      bool has_value = hash_map->with_value(
-          key, false, [&](auto &node_value) { value = node_value.load(std::memory_order_acquire); });
-      if (!has_value || value != migrate_value()) {
-        return value;
+      // the value, if any, was already copied to the new table before it was fenced
+      ValueT next_result = value;
+      next->with_value(key, false, [&](auto &node_value) { next_result = node_value.load(std::memory_order_acquire); });
+      if (next_result == migrate_value()) {
+        // the new table became the current one and is already being resized again, retry
+        continue;
       }
-      do_migrate(hash_map);
+      return next_result;
     }
   }
 
@@ -199,124 +306,135 @@ class ConcurrentHashMap {
   }
 
  private:
+  static constexpr size_t MIGRATE_CHUNK_SIZE = 64;
+  static constexpr size_t MIGRATE_CHUNKS_PER_OPERATION = 2;
+
   // use no padding intentionally
   std::atomic<HashMap *> hash_map_{nullptr};
+  std::atomic<HashMap *> next_hash_map_{nullptr};
 
   std::mutex migrate_mutex_;
-  std::condition_variable migrate_cv_;
-
-  int migrate_cnt_{0};
-  int migrate_generation_{0};
-  HashMap *migrate_from_hash_map_{nullptr};
-  HashMap *migrate_to_hash_map_{nullptr};
-  struct Task {
-    size_t begin;
-    size_t end;
-    bool empty() const {
-      return begin >= end;
-    }
-    size_t size() const {
-      if (empty()) {
-        return 0;
-      }
-      return end - begin;
-    }
-  };
-
-  struct TaskCreator {
-    size_t chunk_size;
-    size_t size;
-    std::atomic<size_t> pos{0};
-    Task create() {
-      auto i = pos++;
-      auto begin = i * chunk_size;
-      auto end = begin + chunk_size;
-      if (end > size) {
-        end = size;
-      }
-      return {begin, end};
-    }
-  };
-  TaskCreator task_creator;
+  // (generation << 32) | next_chunk; the generation grows at every init_migrate, so a stale
+  // claim from a finished resize can never succeed
+  std::atomic<uint64> migrate_state_{0};
+  std::atomic<size_t> migrate_chunk_count_{0};
+  std::atomic<size_t> migrate_done_{0};
+  // how many new keys may be inserted into the new table before the resize is finished
+  std::atomic<int64> migrate_insert_budget_{0};
 
-  void do_migrate(HashMap *ptr) {
-    //LOG(ERROR) << "In do_migrate: " << ptr;
-    std::unique_lock<std::mutex> lock(migrate_mutex_);
-    if (hash_map_.load() != ptr) {
+  void init_migrate(HashMap *from) {
+    std::lock_guard<std::mutex> lock(migrate_mutex_);
+    if (next_hash_map_.load() != nullptr || hash_map_.load() != from) {
       return;
     }
-    init_migrate();
-    CHECK(!ptr || migrate_from_hash_map_ == ptr);
-    migrate_cnt_++;
-    auto migrate_generation = migrate_generation_;
-    lock.unlock();
-
-    run_migrate();
-
-    lock.lock();
-    migrate_cnt_--;
-    if (migrate_cnt_ == 0) {
-      finish_migrate();
-    }
-    migrate_cv_.wait(lock, [&] { return migrate_generation_ != migrate_generation; });
+    auto to = make_unique<HashMap>(from->size() * 2).release();
+    migrate_done_.store(0, std::memory_order_relaxed);
+    // cap the load factor of the new table, so the migration itself can never run out of
+    // the linear probing window
+    migrate_insert_budget_.store(static_cast<int64>(from->size() / 4), std::memory_order_relaxed);
+    migrate_chunk_count_.store((from->size() + MIGRATE_CHUNK_SIZE - 1) / MIGRATE_CHUNK_SIZE,
+                               std::memory_order_relaxed);
+    auto generation = (migrate_state_.load(std::memory_order_relaxed) >> 32) + 1;
+    migrate_state_.store(generation << 32, std::memory_order_release);
+    next_hash_map_.store(to, std::memory_order_release);
   }
 
-  void finish_migrate() {
-    //LOG(ERROR) << "In finish_migrate";
-    hash_map_.store(migrate_to_hash_map_);
-    hp_.retire(get_thread_id(), migrate_from_hash_map_);
-    migrate_from_hash_map_ = nullptr;
-    migrate_to_hash_map_ = nullptr;
-    migrate_generation_++;
-    migrate_cv_.notify_all();
+  void finish_migrate(HashMap *from, HashMap *to) {
+    std::lock_guard<std::mutex> lock(migrate_mutex_);
+    CHECK(hash_map_.load() == from);
+    hash_map_.store(to);
+    next_hash_map_.store(nullptr);
+    hp_.retire(get_thread_id(), from);
   }
 
-  void init_migrate() {
-    if (migrate_from_hash_map_ != nullptr) {
-      return;
+  void help_migrate(size_t max_chunks) {
+    auto thread_id = get_thread_id();
+    for (size_t i = 0; i < max_chunks; i++) {
+      auto state = migrate_state_.load(std::memory_order_acquire);
+      auto chunk = static_cast<size_t>(state & 0xffffffff);
+      if (chunk >= migrate_chunk_count_.load(std::memory_order_relaxed)) {
+        return;
+      }
+      if (!migrate_state_.compare_exchange_strong(state, state + 1, std::memory_order_acq_rel,
+                                                  std::memory_order_acquire)) {
+        i--;
+        continue;
+      }
+
+      // the claimed chunk keeps the resize alive until it is moved, so the protected
+      // pointers are guaranteed to be the source and the destination of this resize
+      typename HazardPointers<HashMap, 2>::Holder next_holder(hp_, thread_id, 1);
+      typename HazardPointers<HashMap, 2>::Holder holder(hp_, thread_id, 0);
+      auto to = next_holder.protect(next_hash_map_);
+      auto from = holder.protect(hash_map_);
+      CHECK(to != nullptr);
+
+      auto begin = chunk * MIGRATE_CHUNK_SIZE;
+      auto end = td::min(begin + MIGRATE_CHUNK_SIZE, from->size());
+      run_task(from, to, begin, end);
+      if (migrate_done_.fetch_add(end - begin, std::memory_order_acq_rel) + (end - begin) == from->size()) {
+        finish_migrate(from, to);
+      }
     }
-    //LOG(ERROR) << "In init_migrate";
-    CHECK(migrate_cnt_ == 0);
-    migrate_generation_++;
-    migrate_from_hash_map_ = hash_map_.exchange(nullptr);
-    auto new_size = migrate_from_hash_map_->size() * 2;
-    migrate_to_hash_map_ = make_unique<HashMap>(new_size).release();
-    task_creator.chunk_size = 100;
-    task_creator.size = migrate_from_hash_map_->size();
-    task_creator.pos = 0;
   }
 
-  void run_migrate() {
-    //LOG(ERROR) << "In run_migrate";
-    size_t cnt = 0;
-    while (true) {
-      auto task = task_creator.create();
-      cnt += task.size();
-      if (task.empty()) {
-        break;
+  // commits `value` for `key` into the new table of an in-progress resize, or adopts the
+  // value which got there first; returns false if the slot is already fenced, which means
+  // the winner has moved on to an even newer table
+  bool resolve_in_next(HashMap *next, KeyT key, ValueT value, ValueT &winner) {
+    bool resolved = false;
+    auto has_slot = next->with_value(key, true, [&](auto &node_value) {
+      ValueT expected_value = this->empty_value();
+      if (node_value.compare_exchange_strong(expected_value, value, std::memory_order_release,
+                                             std::memory_order_acquire)) {
+        resolved = true;
+        winner = value;
+      } else if (expected_value != this->migrate_value()) {
+        resolved = true;
+        winner = expected_value;
       }
-      run_task(task);
-    }
-    //LOG(ERROR) << "In run_migrate " << cnt;
+    });
+    LOG_CHECK(has_slot) << "Migration overflow";
+    return resolved;
   }
 
-  void run_task(Task task) {
-    for (auto i = task.begin; i < task.end; i++) {
-      auto &node = migrate_from_hash_map_->node_at(i);
-      auto old_value = node.value.exchange(migrate_value(), std::memory_order_acq_rel);
-      if (old_value == 0) {
-        continue;
+  void run_task(HashMap *from, HashMap *to, size_t begin, size_t end) {
+    for (auto i = begin; i < end; i++) {
+      auto &node = from->node_at(i);
+      while (true) {
+        auto old_value = node.value.load(std::memory_order_acquire);
+        if (old_value != empty_value()) {
+          CHECK(old_value != migrate_value());
+          // copy the value to the new table before fencing the old one, so operations
+          // that see the fence always find the value in the new table. The copy must not
+          // overwrite: if an insert of the same key already committed to the new table,
+          // that value has won and the old one is dropped
+          auto node_key = node.key.load(std::memory_order_relaxed);
+          auto ok = to->with_value(node_key, true, [&](auto &node_value) {
+            ValueT expected_value = this->empty_value();
+            node_value.compare_exchange_strong(expected_value, old_value, std::memory_order_release,
+                                               std::memory_order_relaxed);
+          });
+          LOG_CHECK(ok) << "Migration overflow";
+          node.value.store(migrate_value(), std::memory_order_release);
+          break;
+        }
+        ValueT expected_value = empty_value();
+        if (node.value.compare_exchange_strong(expected_value, migrate_value(), std::memory_order_acq_rel)) {
+          break;
+        }
+        // a concurrent insert has just committed a value here, move it on the next iteration
       }
-      auto node_key = node.key.load(std::memory_order_relaxed);
-      //LOG(ERROR) << node_key << " " << node_key;
-      auto ok = migrate_to_hash_map_->with_value(
-          node_key, true, [&](auto &node_value) { node_value.store(old_value, std::memory_order_relaxed); });
-      LOG_CHECK(ok) << "Migration overflow";
     }
   }
 };
 
 template <class KeyT, class ValueT>
-td::HazardPointers<typename ConcurrentHashMap<KeyT, ValueT>::HashMap> ConcurrentHashMap<KeyT, ValueT>::hp_(64);
+constexpr size_t ConcurrentHashMap<KeyT, ValueT>::MIGRATE_CHUNK_SIZE;
+template <class KeyT, class ValueT>
+constexpr size_t ConcurrentHashMap<KeyT, ValueT>::MIGRATE_CHUNKS_PER_OPERATION;
+
+template <class KeyT, class ValueT>
+td::HazardPointers<typename ConcurrentHashMap<KeyT, ValueT>::HashMap, 2> ConcurrentHashMap<KeyT, ValueT>::hp_(64);
 
 }  // namespace td
@@ -16,6 +16,11 @@ namespace td {
 // 2. Id is safe way to reach this object.
 // 3. All ids are unique.
 // 4. All ids are non-zero.
+//
+// Ids are generation-tagged, so a stale id resolves to nullptr instead of a reused slot, but the
+// container itself is not thread-safe: all access must stay on the owning scheduler thread.
+// For slots that must be resolved from any thread use SharedObjectPool, which reclaims slots
+// through an MpscLinkQueue and atomic reference counts instead of a free list.
 template <class DataT>
 class Container {
  public:
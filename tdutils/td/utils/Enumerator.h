@@ -14,11 +14,20 @@
 
 namespace td {
 
+// Interns values into dense int32 keys. Storage is two-level: a std::map
+// deduplicates values, and a flat vector of pointers into its stable nodes
+// serves get() in O(1). Deduplication stays tree-based, because key types
+// only have to provide operator<; a hash-based first level would require a
+// hasher for every interned type.
 template <class ValueT>
 class Enumerator {
  public:
   using Key = int32;
 
+  void reserve(size_t size) {
+    arr_.reserve(size);
+  }
+
   Key add(ValueT v) {
     int32 next_id = narrow_cast<int32>(arr_.size() + 1);
     bool was_inserted;
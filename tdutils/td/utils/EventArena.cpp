@@ -0,0 +1,174 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/EventArena.h"
+
+#include "td/utils/port/thread_local.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace td {
+
+namespace {
+
+constexpr std::size_t HEADER_SIZE = 16;  // keeps payload aligned as max_align_t
+constexpr std::size_t SIZE_CLASS_COUNT = 4;
+constexpr std::size_t BLOCK_SIZE[SIZE_CLASS_COUNT] = {64, 128, 256, 512};  // including header
+constexpr std::size_t CHUNK_SIZE = 1 << 14;
+
+struct FreeNode {
+  FreeNode *next;
+};
+
+struct Arena;
+
+// precedes every block; oversized blocks are allocated directly with new,
+// have arena == nullptr and store their full size in size_class instead
+struct BlockHeader {
+  Arena *arena;
+  std::size_t size_class;
+};
+static_assert(sizeof(BlockHeader) <= HEADER_SIZE, "BlockHeader is too big");
+
+struct Arena {
+  FreeNode *free_list[SIZE_CLASS_COUNT] = {};
+  char *chunk_pos = nullptr;
+  char *chunk_end = nullptr;
+  vector<std::unique_ptr<char[]>> chunks;
+
+  std::atomic<FreeNode *> remote_free_list[SIZE_CLASS_COUNT] = {};
+
+  Arena *next_pooled = nullptr;
+};
+
+std::atomic<std::size_t> arena_mem;
+
+std::mutex arena_pool_mutex;
+Arena *arena_pool;  // static zero-initialized
+
+Arena *acquire_arena() {
+  {
+    std::lock_guard<std::mutex> guard(arena_pool_mutex);
+    if (arena_pool != nullptr) {
+      auto *arena = arena_pool;
+      arena_pool = arena->next_pooled;
+      arena->next_pooled = nullptr;
+      return arena;
+    }
+  }
+  arena_mem += sizeof(Arena);
+  return new Arena();
+}
+
+void release_arena(Arena *arena) {
+  std::lock_guard<std::mutex> guard(arena_pool_mutex);
+  arena->next_pooled = arena_pool;
+  arena_pool = arena;
+}
+
+// holds the thread's arena while the thread is alive
+struct ArenaTls {
+  Arena *arena = acquire_arena();
+  ArenaTls() = default;
+  ArenaTls(const ArenaTls &) = delete;
+  ArenaTls &operator=(const ArenaTls &) = delete;
+  ~ArenaTls() {
+    release_arena(arena);
+  }
+};
+
+TD_THREAD_LOCAL ArenaTls *arena_tls;  // static zero-initialized
+
+std::size_t get_size_class(std::size_t block_size) {
+  std::size_t size_class = 0;
+  while (size_class < SIZE_CLASS_COUNT && BLOCK_SIZE[size_class] < block_size) {
+    size_class++;
+  }
+  return size_class;
+}
+
+void push_free_node(std::atomic<FreeNode *> &head, FreeNode *node) {
+  auto *old_head = head.load(std::memory_order_relaxed);
+  do {
+    node->next = old_head;
+  } while (!head.compare_exchange_weak(old_head, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
+BlockHeader *get_header(void *ptr) {
+  return reinterpret_cast<BlockHeader *>(static_cast<char *>(ptr) - HEADER_SIZE);
+}
+
+void *init_block(char *block, Arena *arena, std::size_t size_class) {
+  auto *header = reinterpret_cast<BlockHeader *>(block);
+  header->arena = arena;
+  header->size_class = size_class;
+  return block + HEADER_SIZE;
+}
+
+}  // namespace
+
+void *EventArena::alloc(std::size_t size) {
+  auto size_class = get_size_class(size + HEADER_SIZE);
+  if (size_class == SIZE_CLASS_COUNT) {
+    auto block_size = size + HEADER_SIZE;
+    arena_mem += block_size;
+    return init_block(new char[block_size], nullptr, block_size);
+  }
+
+  init_thread_local<ArenaTls>(arena_tls);
+  auto *arena = arena_tls->arena;
+
+  auto *node = arena->free_list[size_class];
+  if (node == nullptr) {
+    // harvest blocks freed by other threads
+    node = arena->remote_free_list[size_class].exchange(nullptr, std::memory_order_acquire);
+  }
+  if (node != nullptr) {
+    arena->free_list[size_class] = node->next;
+    return static_cast<void *>(node);
+  }
+
+  auto block_size = BLOCK_SIZE[size_class];
+  if (static_cast<std::size_t>(arena->chunk_end - arena->chunk_pos) < block_size) {
+    arena->chunks.push_back(std::make_unique<char[]>(CHUNK_SIZE));
+    arena->chunk_pos = arena->chunks.back().get();
+    arena->chunk_end = arena->chunk_pos + CHUNK_SIZE;
+    arena_mem += CHUNK_SIZE;
+  }
+  auto *block = arena->chunk_pos;
+  arena->chunk_pos += block_size;
+  return init_block(block, arena, size_class);
+}
+
+void EventArena::dealloc(void *ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  auto *header = get_header(ptr);
+  auto *arena = header->arena;
+  if (arena == nullptr) {
+    arena_mem -= header->size_class;
+    delete[] reinterpret_cast<char *>(header);
+    return;
+  }
+  auto size_class = header->size_class;
+  auto *node = static_cast<FreeNode *>(ptr);
+  if (arena_tls != nullptr && arena_tls->arena == arena) {
+    node->next = arena->free_list[size_class];
+    arena->free_list[size_class] = node;
+  } else {
+    push_free_node(arena->remote_free_list[size_class], node);
+  }
+}
+
+std::size_t EventArena::get_arena_mem() {
+  return arena_mem;
+}
+
+}  // namespace td
@@ -0,0 +1,33 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+
+#include <cstddef>
+
+namespace td {
+
+// Thread-local slab allocator for small short-lived objects, most notably actor
+// events and closures. Each thread owns an arena and serves allocations from
+// per-size-class free lists, falling back to bump allocation from 16KB chunks.
+// A block freed from another thread is pushed to a lock-free free list of the
+// owning arena, so neither path takes a lock or calls malloc.
+//
+// Arenas are returned to a global pool on thread exit and adopted by new
+// threads, so the total memory is bounded by the peak usage of the
+// concurrently running threads.
+class EventArena {
+ public:
+  static void *alloc(std::size_t size);
+  static void dealloc(void *ptr);
+
+  // total memory held by all arenas
+  static std::size_t get_arena_mem();
+};
+
+}  // namespace td
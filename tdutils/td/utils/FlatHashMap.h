@@ -0,0 +1,429 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace td {
+
+// An open-addressing hash map with linear probing over a single flat array of nodes.
+// Key and value are stored inline, so it needs no per-node allocations and is much more
+// cache-friendly than std::unordered_map. Unlike std::unordered_map all iterators,
+// pointers and references are invalidated by insertions; values may be kept stable
+// across insertions by storing them through unique_ptr. The provided hasher is always
+// mixed with an additional bit-avalanching finalizer, so identity-like hashers such as
+// std::hash<int64> are safe to use
+template <class KeyT, class ValueT, class HashT = std::hash<KeyT>>
+class FlatHashMap {
+  struct Node {
+    std::size_t hash = 0;  // 0 means that the node is empty
+    union {
+      std::pair<KeyT, ValueT> pair;
+    };
+
+    Node() {
+    }
+    ~Node() {
+      // the stored pair is destroyed by the map
+    }
+    Node(const Node &) = delete;
+    Node &operator=(const Node &) = delete;
+  };
+
+ public:
+  using key_type = KeyT;
+  using mapped_type = ValueT;
+  using value_type = std::pair<const KeyT, ValueT>;
+  using size_type = std::size_t;
+
+  template <bool is_const>
+  class Iterator {
+    using NodePointer = std::conditional_t<is_const, const Node *, Node *>;
+    using PairPointer = std::conditional_t<is_const, const std::pair<const KeyT, ValueT> *, std::pair<const KeyT, ValueT> *>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<const KeyT, ValueT>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = PairPointer;
+    using reference = std::conditional_t<is_const, const value_type &, value_type &>;
+
+    Iterator() = default;
+    Iterator(NodePointer it, NodePointer end) : it_(it), end_(end) {
+      skip_empty();
+    }
+    template <bool other_is_const, class = std::enable_if_t<is_const && !other_is_const>>
+    Iterator(const Iterator<other_is_const> &other) : it_(other.it_), end_(other.end_) {
+    }
+
+    reference operator*() const {
+      // the layout of std::pair<KeyT, ValueT> and std::pair<const KeyT, ValueT> is the same
+      return *reinterpret_cast<PairPointer>(&it_->pair);
+    }
+    pointer operator->() const {
+      return &**this;
+    }
+
+    Iterator &operator++() {
+      ++it_;
+      skip_empty();
+      return *this;
+    }
+
+    bool operator==(const Iterator &other) const {
+      return it_ == other.it_;
+    }
+    bool operator!=(const Iterator &other) const {
+      return it_ != other.it_;
+    }
+
+   private:
+    friend class FlatHashMap;
+    template <bool>
+    friend class Iterator;
+    NodePointer it_ = nullptr;
+    NodePointer end_ = nullptr;
+
+    void skip_empty() {
+      while (it_ != end_ && it_->hash == 0) {
+        ++it_;
+      }
+    }
+  };
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  FlatHashMap() = default;
+  FlatHashMap(const FlatHashMap &other) {
+    assign(other);
+  }
+  FlatHashMap &operator=(const FlatHashMap &other) {
+    if (this != &other) {
+      clear();
+      assign(other);
+    }
+    return *this;
+  }
+  FlatHashMap(FlatHashMap &&other) noexcept {
+    swap(other);
+  }
+  FlatHashMap &operator=(FlatHashMap &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+  ~FlatHashMap() {
+    destroy_nodes();
+  }
+
+  void swap(FlatHashMap &other) noexcept {
+    std::swap(nodes_, other.nodes_);
+    std::swap(bucket_count_, other.bucket_count_);
+    std::swap(size_, other.size_);
+  }
+
+  size_type size() const {
+    return size_;
+  }
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  iterator begin() {
+    return iterator(nodes_.get(), nodes_.get() + bucket_count_);
+  }
+  iterator end() {
+    return iterator(nodes_.get() + bucket_count_, nodes_.get() + bucket_count_);
+  }
+  const_iterator begin() const {
+    return const_iterator(nodes_.get(), nodes_.get() + bucket_count_);
+  }
+  const_iterator end() const {
+    return const_iterator(nodes_.get() + bucket_count_, nodes_.get() + bucket_count_);
+  }
+  const_iterator cbegin() const {
+    return begin();
+  }
+  const_iterator cend() const {
+    return end();
+  }
+
+  iterator find(const KeyT &key) {
+    return iterator(find_node(key), nodes_.get() + bucket_count_);
+  }
+  const_iterator find(const KeyT &key) const {
+    return const_iterator(find_node(key), nodes_.get() + bucket_count_);
+  }
+
+  size_type count(const KeyT &key) const {
+    return find_node(key) == nodes_.get() + bucket_count_ ? 0 : 1;
+  }
+
+  template <class... ArgsT>
+  std::pair<iterator, bool> emplace(KeyT key, ArgsT &&... args) {
+    try_grow();
+    auto hash = calc_hash(key);
+    auto mask = bucket_count_ - 1;
+    auto pos = hash & mask;
+    while (true) {
+      auto &node = nodes_[pos];
+      if (node.hash == 0) {
+        new (&node.pair) std::pair<KeyT, ValueT>(std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                                                 std::forward_as_tuple(std::forward<ArgsT>(args)...));
+        node.hash = hash;
+        size_++;
+        return {iterator(&node, nodes_.get() + bucket_count_), true};
+      }
+      if (node.hash == hash && node.pair.first == key) {
+        return {iterator(&node, nodes_.get() + bucket_count_), false};
+      }
+      pos = (pos + 1) & mask;
+    }
+  }
+
+  std::pair<iterator, bool> insert(value_type value) {
+    return emplace(value.first, std::move(value.second));
+  }
+
+  ValueT &operator[](KeyT key) {
+    return emplace(std::move(key)).first->second;
+  }
+
+  void erase(iterator pos) {
+    CHECK(pos != end());
+    erase_node(static_cast<size_type>(pos.it_ - nodes_.get()));
+  }
+
+  size_type erase(const KeyT &key) {
+    auto *node = find_node(key);
+    if (node == nodes_.get() + bucket_count_) {
+      return 0;
+    }
+    erase_node(static_cast<size_type>(node - nodes_.get()));
+    return 1;
+  }
+
+  void clear() {
+    destroy_nodes();
+    nodes_ = nullptr;
+    bucket_count_ = 0;
+    size_ = 0;
+  }
+
+  void reserve(size_type new_size) {
+    size_type need_bucket_count = 8;
+    while (new_size + 1 > need_bucket_count / 4 * 3) {
+      need_bucket_count *= 2;
+    }
+    if (need_bucket_count > bucket_count_) {
+      rehash(need_bucket_count);
+    }
+  }
+
+ private:
+  std::unique_ptr<Node[]> nodes_;
+  size_type bucket_count_ = 0;
+  size_type size_ = 0;
+
+  static std::size_t calc_hash(const KeyT &key) {
+    // mix the hash to protect against identity-like hashers, which interact badly
+    // with the power-of-two bucket mask, and to free 0 as the empty marker
+    uint64 h = static_cast<uint64>(HashT()(key));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccd;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53;
+    h ^= h >> 33;
+    auto result = static_cast<std::size_t>(h);
+    if (result == 0) {
+      result = 1;
+    }
+    return result;
+  }
+
+  Node *find_node(const KeyT &key) const {
+    if (bucket_count_ == 0) {
+      return nullptr;
+    }
+    auto hash = calc_hash(key);
+    auto mask = bucket_count_ - 1;
+    auto pos = hash & mask;
+    while (true) {
+      auto &node = nodes_[pos];
+      if (node.hash == 0) {
+        return const_cast<Node *>(nodes_.get()) + bucket_count_;
+      }
+      if (node.hash == hash && node.pair.first == key) {
+        return const_cast<Node *>(&node);
+      }
+      pos = (pos + 1) & mask;
+    }
+  }
+
+  void try_grow() {
+    if ((size_ + 1) * 4 > bucket_count_ * 3) {
+      rehash(bucket_count_ == 0 ? 8 : bucket_count_ * 2);
+    }
+  }
+
+  void rehash(size_type new_bucket_count) {
+    auto old_nodes = std::move(nodes_);
+    auto old_bucket_count = bucket_count_;
+    nodes_ = std::make_unique<Node[]>(new_bucket_count);
+    bucket_count_ = new_bucket_count;
+    auto mask = new_bucket_count - 1;
+    for (size_type i = 0; i < old_bucket_count; i++) {
+      auto &old_node = old_nodes[i];
+      if (old_node.hash == 0) {
+        continue;
+      }
+      auto pos = old_node.hash & mask;
+      while (nodes_[pos].hash != 0) {
+        pos = (pos + 1) & mask;
+      }
+      new (&nodes_[pos].pair) std::pair<KeyT, ValueT>(std::move(old_node.pair));
+      nodes_[pos].hash = old_node.hash;
+      old_node.pair.~pair();
+    }
+  }
+
+  void erase_node(size_type pos) {
+    auto mask = bucket_count_ - 1;
+    nodes_[pos].pair.~pair();
+    nodes_[pos].hash = 0;
+    auto hole = pos;
+    auto next = pos;
+    while (true) {
+      next = (next + 1) & mask;
+      auto &node = nodes_[next];
+      if (node.hash == 0) {
+        break;
+      }
+      auto ideal = node.hash & mask;
+      // move the node into the hole if its probe path passes through the hole
+      if (((next - ideal) & mask) >= ((next - hole) & mask)) {
+        new (&nodes_[hole].pair) std::pair<KeyT, ValueT>(std::move(node.pair));
+        nodes_[hole].hash = node.hash;
+        node.pair.~pair();
+        node.hash = 0;
+        hole = next;
+      }
+    }
+    size_--;
+  }
+
+  void assign(const FlatHashMap &other) {
+    reserve(other.size());
+    for (const auto &value : other) {
+      emplace(value.first, value.second);
+    }
+  }
+
+  void destroy_nodes() {
+    if (size_ != 0) {
+      for (size_type i = 0; i < bucket_count_; i++) {
+        if (nodes_[i].hash != 0) {
+          nodes_[i].pair.~pair();
+        }
+      }
+    }
+  }
+};
+
+template <class KeyT, class HashT = std::hash<KeyT>>
+class FlatHashSet {
+  using Map = FlatHashMap<KeyT, char, HashT>;
+
+ public:
+  using key_type = KeyT;
+  using value_type = KeyT;
+  using size_type = std::size_t;
+
+  class iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = KeyT;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const KeyT *;
+    using reference = const KeyT &;
+
+    iterator() = default;
+    explicit iterator(typename Map::const_iterator it) : it_(it) {
+    }
+
+    reference operator*() const {
+      return it_->first;
+    }
+    pointer operator->() const {
+      return &it_->first;
+    }
+    iterator &operator++() {
+      ++it_;
+      return *this;
+    }
+    bool operator==(const iterator &other) const {
+      return it_ == other.it_;
+    }
+    bool operator!=(const iterator &other) const {
+      return it_ != other.it_;
+    }
+
+   private:
+    friend class FlatHashSet;
+    typename Map::const_iterator it_;
+  };
+  using const_iterator = iterator;
+
+  size_type size() const {
+    return map_.size();
+  }
+  bool empty() const {
+    return map_.empty();
+  }
+
+  const_iterator begin() const {
+    return const_iterator(map_.begin());
+  }
+  const_iterator end() const {
+    return const_iterator(map_.end());
+  }
+
+  const_iterator find(const KeyT &key) const {
+    return const_iterator(map_.find(key));
+  }
+  size_type count(const KeyT &key) const {
+    return map_.count(key);
+  }
+
+  std::pair<const_iterator, bool> insert(KeyT key) {
+    auto result = map_.emplace(std::move(key), '\0');
+    return {const_iterator(typename Map::const_iterator(result.first)), result.second};
+  }
+
+  size_type erase(const KeyT &key) {
+    return map_.erase(key);
+  }
+
+  void clear() {
+    map_.clear();
+  }
+  void reserve(size_type new_size) {
+    map_.reserve(new_size);
+  }
+
+ private:
+  Map map_;
+};
+
+}  // namespace td
@@ -7,17 +7,24 @@
 #pragma once
 
 #include "td/utils/common.h"
-#include "td/utils/TimedStat.h"
+
+#include <cmath>
 
 namespace td {
 
+// A token-bucket flood control: each limit is a bucket refilled at count/duration
+// tokens per second, and every event consumes one token. Both add_event and
+// get_wakeup_at are O(limits) with no per-event bookkeeping, unlike
+// FloodControlStrict, which remembers every event to enforce the limits exactly.
 class FloodControlFast {
  public:
   uint32 add_event(int32 now) {
-    for (auto &limit : limits_) {
-      limit.stat_.add_event(CounterStat::Event(), now);
-      if (limit.stat_.get_stat(now).count_ > limit.count_) {
-        wakeup_at_ = max(wakeup_at_, now + limit.duration_ * 2);
+    for (auto &bucket : buckets_) {
+      bucket.volume_ = min(bucket.max_volume_, bucket.volume_ + (now - bucket.update_time_) * bucket.speed_);
+      bucket.update_time_ = now;
+      bucket.volume_ -= 1;
+      if (bucket.volume_ < 0) {
+        wakeup_at_ = max(wakeup_at_, static_cast<uint32>(now + std::ceil(-bucket.volume_ / bucket.speed_)));
       }
     }
     return wakeup_at_;
@@ -27,36 +34,28 @@ class FloodControlFast {
   }
 
   void add_limit(uint32 duration, int32 count) {
-    limits_.push_back({TimedStat<CounterStat>(duration, 0), duration, count});
+    auto max_volume = static_cast<double>(count);
+    buckets_.push_back({max_volume / duration, max_volume, max_volume, 0});
   }
 
   void clear_events() {
-    for (auto &limit : limits_) {
-      limit.stat_.clear_events();
+    for (auto &bucket : buckets_) {
+      bucket.volume_ = bucket.max_volume_;
+      bucket.update_time_ = 0;
     }
     wakeup_at_ = 0;
   }
 
  private:
-  class CounterStat {
-   public:
-    struct Event {};
-    int32 count_ = 0;
-    void on_event(Event e) {
-      count_++;
-    }
-    void clear() {
-      count_ = 0;
-    }
+  struct Bucket {
+    double speed_;
+    double max_volume_;
+    double volume_;
+    double update_time_;
   };
 
   uint32 wakeup_at_ = 0;
-  struct Limit {
-    TimedStat<CounterStat> stat_;
-    uint32 duration_;
-    int32 count_;
-  };
-  std::vector<Limit> limits_;
+  vector<Bucket> buckets_;
 };
 
 }  // namespace td
@@ -22,6 +22,7 @@ namespace td {
 class Gzip::Impl {
  public:
   z_stream stream_;
+  bool is_decode_inited_ = false;
 
   // z_stream is not copyable nor movable
   Impl() = default;
@@ -29,9 +30,15 @@ class Gzip::Impl {
   Impl &operator=(const Impl &other) = delete;
   Impl(Impl &&other) = delete;
   Impl &operator=(Impl &&other) = delete;
-  ~Impl() = default;
+  ~Impl() {
+    if (is_decode_inited_) {
+      inflateEnd(&stream_);
+    }
+  }
 };
 
+TD_THREAD_LOCAL Gzip::ImplCache *Gzip::impl_cache_;  // static zero-initialized
+
 Status Gzip::init_encode() {
   CHECK(mode_ == Empty);
   init_common();
@@ -45,12 +52,36 @@ Status Gzip::init_encode() {
 
 Status Gzip::init_decode() {
   CHECK(mode_ == Empty);
+  if (!impl_->is_decode_inited_) {
+    init_thread_local<ImplCache>(impl_cache_);
+    if (impl_cache_->decode_impl != nullptr) {
+      impl_ = std::move(impl_cache_->decode_impl);
+    }
+  }
+  if (impl_->is_decode_inited_) {
+    // reuse the already allocated inflate state and window
+    int ret = inflateReset2(&impl_->stream_, MAX_WBITS + 32);
+    if (ret == Z_OK) {
+      impl_->stream_.avail_in = 0;
+      impl_->stream_.next_in = nullptr;
+      impl_->stream_.avail_out = 0;
+      impl_->stream_.next_out = nullptr;
+
+      input_size_ = 0;
+      output_size_ = 0;
+      close_input_flag_ = false;
+
+      mode_ = Decode;
+      return Status::OK();
+    }
+  }
   init_common();
   mode_ = Decode;
   int ret = inflateInit2(&impl_->stream_, MAX_WBITS + 32);
   if (ret != Z_OK) {
     return Status::Error(PSLICE() << "zlib inflate init failed: " << ret);
   }
+  impl_->is_decode_inited_ = true;
   return Status::OK();
 }
 
@@ -103,6 +134,10 @@ size_t Gzip::left_output() const {
 }
 
 void Gzip::init_common() {
+  if (impl_->is_decode_inited_) {
+    inflateEnd(&impl_->stream_);
+    impl_->is_decode_inited_ = false;
+  }
   std::memset(&impl_->stream_, 0, sizeof(impl_->stream_));
   impl_->stream_.zalloc = Z_NULL;
   impl_->stream_.zfree = Z_NULL;
@@ -119,9 +154,8 @@ void Gzip::init_common() {
 }
 
 void Gzip::clear() {
-  if (mode_ == Decode) {
-    inflateEnd(&impl_->stream_);
-  } else if (mode_ == Encode) {
+  // the inflate context is kept alive to be reused by the next init_decode
+  if (mode_ == Encode) {
     deflateEnd(&impl_->stream_);
   }
   mode_ = Empty;
@@ -152,11 +186,39 @@ void Gzip::swap(Gzip &other) {
 
 Gzip::~Gzip() {
   clear();
+  if (impl_ != nullptr && impl_->is_decode_inited_) {
+    init_thread_local<ImplCache>(impl_cache_);
+    if (impl_cache_->decode_impl == nullptr) {
+      impl_cache_->decode_impl = std::move(impl_);
+    }
+  }
 }
 
 BufferSlice gzdecode(Slice s) {
   Gzip gzip;
   gzip.init_decode().ensure();
+  constexpr size_t MAX_ONE_SHOT_INPUT_SIZE = 1 << 12;
+  if (s.size() <= MAX_ONE_SHOT_INPUT_SIZE) {
+    // small payloads are inflated into a single buffer without chaining;
+    // if the guessed output size turns out too small, redo the work the general way
+    BufferWriter one_shot_message{s.size() * 4 + (1 << 7)};
+    gzip.set_input(s);
+    gzip.close_input();
+    gzip.set_output(one_shot_message.prepare_append());
+    auto r_state = gzip.run();
+    if (r_state.is_error()) {
+      return BufferSlice();
+    }
+    if (r_state.ok() == Gzip::Done) {
+      one_shot_message.confirm_append(gzip.flush_output());
+      return one_shot_message.as_buffer_slice();
+    }
+    if (gzip.need_input()) {
+      return BufferSlice();
+    }
+    gzip.init(Gzip::Empty).ensure();
+    gzip.init_decode().ensure();
+  }
   ChainBufferWriter message;
   gzip.set_input(s);
   gzip.close_input();
@@ -10,6 +10,7 @@
 
 #if TD_HAVE_ZLIB
 #include "td/utils/buffer.h"
+#include "td/utils/port/thread_local.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
 
@@ -86,6 +87,13 @@ class Gzip {
   class Impl;
   unique_ptr<Impl> impl_;
 
+  // each thread keeps one spare inflate context; it is reused by init_decode
+  // together with its window, so decoding a payload needs no zlib allocations
+  struct ImplCache {
+    unique_ptr<Impl> decode_impl;
+  };
+  static TD_THREAD_LOCAL ImplCache *impl_cache_;
+
   size_t input_size_ = 0;
   size_t output_size_ = 0;
   bool close_input_flag_ = false;
@@ -68,20 +68,20 @@ vector<string> Hints::get_words(Slice name, bool is_search) {
 
 void Hints::add_word(const string &word, KeyT key, std::map<string, vector<KeyT>> &word_to_keys) {
   vector<KeyT> &keys = word_to_keys[word];
-  CHECK(std::find(keys.begin(), keys.end(), key) == keys.end());
-  keys.push_back(key);
+  auto key_it = std::lower_bound(keys.begin(), keys.end(), key);
+  CHECK(key_it == keys.end() || *key_it != key);
+  keys.insert(key_it, key);
 }
 
 void Hints::delete_word(const string &word, KeyT key, std::map<string, vector<KeyT>> &word_to_keys) {
   vector<KeyT> &keys = word_to_keys[word];
-  auto key_it = std::find(keys.begin(), keys.end(), key);
-  CHECK(key_it != keys.end());
+  auto key_it = std::lower_bound(keys.begin(), keys.end(), key);
+  CHECK(key_it != keys.end() && *key_it == key);
   if (keys.size() == 1) {
     word_to_keys.erase(word);
   } else {
     CHECK(keys.size() > 1);
-    *key_it = keys.back();
-    keys.pop_back();
+    keys.erase(key_it);
   }
 }
 
@@ -136,26 +136,68 @@ void Hints::set_rating(KeyT key, RatingT rating) {
   key_to_rating_[key] = rating;
 }
 
-void Hints::add_search_results(vector<KeyT> &results, const string &word,
-                               const std::map<string, vector<KeyT>> &word_to_keys) {
+void Hints::collect_search_results(vector<const vector<KeyT> *> &word_keys, const string &word,
+                                   const std::map<string, vector<KeyT>> &word_to_keys) {
   LOG(DEBUG) << "Search for word " << word;
   auto it = word_to_keys.lower_bound(word);
   while (it != word_to_keys.end() && begins_with(it->first, word)) {
-    results.insert(results.end(), it->second.begin(), it->second.end());
+    word_keys.push_back(&it->second);
     ++it;
   }
 }
 
-vector<Hints::KeyT> Hints::search_word(const string &word) const {
+vector<Hints::KeyT> Hints::merge_search_results(const vector<const vector<KeyT> *> &word_keys) {
+  if (word_keys.empty()) {
+    return {};
+  }
+  if (word_keys.size() == 1) {
+    return *word_keys[0];
+  }
+
+  // k-way merge of the sorted key lists with deduplication
+  struct Position {
+    const KeyT *pos;
+    const KeyT *end;
+  };
+  auto is_greater = [](const Position &lhs, const Position &rhs) { return *lhs.pos > *rhs.pos; };
+
+  size_t total_size = 0;
+  vector<Position> heap;
+  heap.reserve(word_keys.size());
+  for (auto *keys : word_keys) {
+    if (!keys->empty()) {
+      heap.push_back({keys->data(), keys->data() + keys->size()});
+      total_size += keys->size();
+    }
+  }
+  std::make_heap(heap.begin(), heap.end(), is_greater);
+
   vector<KeyT> results;
-  add_search_results(results, word, translit_word_to_keys_);
+  results.reserve(total_size);
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), is_greater);
+    auto &top = heap.back();
+    auto key = *top.pos++;
+    if (results.empty() || results.back() != key) {
+      results.push_back(key);
+    }
+    if (top.pos == top.end) {
+      heap.pop_back();
+    } else {
+      std::push_heap(heap.begin(), heap.end(), is_greater);
+    }
+  }
+  return results;
+}
+
+vector<Hints::KeyT> Hints::search_word(const string &word) const {
+  vector<const vector<KeyT> *> word_keys;
+  collect_search_results(word_keys, word, translit_word_to_keys_);
   for (auto w : get_word_transliterations(word, true)) {
-    add_search_results(results, w, word_to_keys_);
+    collect_search_results(word_keys, w, word_to_keys_);
   }
 
-  std::sort(results.begin(), results.end());
-  results.erase(std::unique(results.begin(), results.end()), results.end());
-  return results;
+  return merge_search_results(word_keys);
 }
 
 std::pair<size_t, vector<Hints::KeyT>> Hints::search(Slice query, int32 limit, bool return_all_for_empty_query) const {
@@ -174,29 +216,36 @@ std::pair<size_t, vector<Hints::KeyT>> Hints::search(Slice query, int32 limit, b
     }
   }
 
-  for (size_t i = 0; i < words.size(); i++) {
-    vector<KeyT> keys = search_word(words[i]);
-    if (i == 0) {
-      results = std::move(keys);
-      continue;
+  if (!words.empty()) {
+    vector<vector<KeyT>> all_keys;
+    all_keys.reserve(words.size());
+    for (auto &word : words) {
+      all_keys.push_back(search_word(word));
     }
+    // intersect the shortest lists first to keep intermediate results small
+    std::sort(all_keys.begin(), all_keys.end(),
+              [](const vector<KeyT> &lhs, const vector<KeyT> &rhs) { return lhs.size() < rhs.size(); });
 
-    // now need to intersect two lists
-    size_t results_pos = 0;
-    size_t keys_pos = 0;
-    size_t new_results_size = 0;
-    while (results_pos != results.size() && keys_pos != keys.size()) {
-      if (results[results_pos] < keys[keys_pos]) {
-        results_pos++;
-      } else if (results[results_pos] > keys[keys_pos]) {
-        keys_pos++;
-      } else {
-        results[new_results_size++] = results[results_pos];
-        results_pos++;
-        keys_pos++;
+    results = std::move(all_keys[0]);
+    for (size_t i = 1; i < all_keys.size() && !results.empty(); i++) {
+      // now need to intersect two lists
+      auto &keys = all_keys[i];
+      size_t results_pos = 0;
+      size_t keys_pos = 0;
+      size_t new_results_size = 0;
+      while (results_pos != results.size() && keys_pos != keys.size()) {
+        if (results[results_pos] < keys[keys_pos]) {
+          results_pos++;
+        } else if (results[results_pos] > keys[keys_pos]) {
+          keys_pos++;
+        } else {
+          results[new_results_size++] = results[results_pos];
+          results_pos++;
+          keys_pos++;
+        }
       }
+      results.resize(new_results_size);
     }
-    results.resize(new_results_size);
   }
 
   auto total_size = results.size();
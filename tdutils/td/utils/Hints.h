@@ -42,6 +42,7 @@ class Hints {
   size_t size() const;
 
  private:
+  // the key list of each word is kept sorted, so search results can be merged without sorting
   std::map<string, vector<KeyT>> word_to_keys_;
   std::map<string, vector<KeyT>> translit_word_to_keys_;
   std::unordered_map<KeyT, string> key_to_name_;
@@ -54,8 +55,10 @@ class Hints {
 
   static vector<string> get_words(Slice name, bool is_search);
 
-  static void add_search_results(vector<KeyT> &results, const string &word,
-                                 const std::map<string, vector<KeyT>> &word_to_keys);
+  static void collect_search_results(vector<const vector<KeyT> *> &word_keys, const string &word,
+                                     const std::map<string, vector<KeyT>> &word_to_keys);
+
+  static vector<KeyT> merge_search_results(const vector<const vector<KeyT> *> &word_keys);
 
   vector<KeyT> search_word(const string &word) const;
 
@@ -13,6 +13,39 @@
 
 namespace td {
 
+// returns the end of the longest prefix of [s + pos, s + len) which can be copied
+// into a JSON string as is; scans eight characters at a time via 64-bit loads
+template <bool allow_non_ascii>
+static size_t scan_clean_json_chars(const char *s, size_t pos, size_t len) {
+  static constexpr uint64 ALL_01 = 0x0101010101010101;
+  static constexpr uint64 ALL_80 = 0x8080808080808080;
+  while (pos + sizeof(uint64) <= len) {
+    uint64 word;
+    std::memcpy(&word, s + pos, sizeof(word));
+    auto is_less_32 = (word - 32 * ALL_01) & ~word;
+    auto quote_xor = word ^ (ALL_01 * '"');
+    auto is_quote = (quote_xor - ALL_01) & ~quote_xor;
+    auto slash_xor = word ^ (ALL_01 * '\\');
+    auto is_slash = (slash_xor - ALL_01) & ~slash_xor;
+    auto need_escape = (is_less_32 | is_quote | is_slash) & ALL_80;
+    if (!allow_non_ascii) {
+      need_escape |= word & ALL_80;
+    }
+    if (need_escape != 0) {
+      break;
+    }
+    pos += sizeof(uint64);
+  }
+  while (pos < len) {
+    auto ch = static_cast<unsigned char>(s[pos]);
+    if (ch < 32 || ch == '"' || ch == '\\' || (!allow_non_ascii && ch >= 128)) {
+      break;
+    }
+    pos++;
+  }
+  return pos;
+}
+
 StringBuilder &operator<<(StringBuilder &sb, const JsonRawString &val) {
   sb << '"';
   SCOPE_EXIT {
@@ -22,6 +55,14 @@ StringBuilder &operator<<(StringBuilder &sb, const JsonRawString &val) {
   auto len = val.value_.size();
 
   for (size_t pos = 0; pos < len; pos++) {
+    auto run_end = scan_clean_json_chars<true>(s, pos, len);
+    if (run_end != pos) {
+      sb << Slice(s + pos, run_end - pos);
+      if (run_end == len) {
+        break;
+      }
+      pos = run_end;
+    }
     auto ch = static_cast<unsigned char>(s[pos]);
     switch (ch) {
       case '"':
@@ -66,6 +107,14 @@ StringBuilder &operator<<(StringBuilder &sb, const JsonString &val) {
   auto len = val.str_.size();
 
   for (size_t pos = 0; pos < len; pos++) {
+    auto run_end = scan_clean_json_chars<false>(s, pos, len);
+    if (run_end != pos) {
+      sb << Slice(s + pos, run_end - pos);
+      if (run_end == len) {
+        break;
+      }
+      pos = run_end;
+    }
     auto ch = static_cast<unsigned char>(s[pos]);
     switch (ch) {
       case '"':
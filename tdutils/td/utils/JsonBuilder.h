@@ -762,6 +762,8 @@ Status json_string_skip(Parser &parser) TD_WARN_UNUSED_RESULT;
 Result<JsonValue> do_json_decode(Parser &parser, int32 max_depth) TD_WARN_UNUSED_RESULT;
 Status do_json_skip(Parser &parser, int32 max_depth) TD_WARN_UNUSED_RESULT;
 
+// parses in-situ: strings are unescaped inside the given buffer, and the returned
+// JsonValue references the buffer instead of owning copies of the strings
 inline Result<JsonValue> json_decode(MutableSlice json) {
   Parser parser(json);
   const int32 DEFAULT_MAX_DEPTH = 100;
@@ -198,6 +198,120 @@ class MpmcQueueBlock {
   char pad3[TD_CONCURRENCY_PAD - sizeof(std::vector<Node>)];
 };
 
+// Bounded MPMC queue (Vyukov-style array queue with per-cell sequence numbers).
+// Never allocates after construction, so it avoids the allocator traffic of the
+// unbounded node-based queues below. push fails when the queue is full.
+//
+// It is deliberately not used for inter-scheduler message passing: those queues
+// are single-consumer and must expose an event fd the scheduler can poll, which
+// MpscPollableQueue provides, and losing messages on overflow is not an option
+// there. See bench_queue.cpp for a comparison with the unbounded MpmcQueue
+template <class T>
+class MpmcBoundedQueue {
+ public:
+  explicit MpmcBoundedQueue(size_t size) {
+    size_t capacity = 2;
+    while (capacity < size) {
+      capacity *= 2;
+    }
+    cells_ = std::vector<Cell>(capacity);
+    for (size_t i = 0; i < capacity; i++) {
+      cells_[i].sequence.store(static_cast<uint64>(i), std::memory_order_relaxed);
+    }
+    mask_ = capacity - 1;
+  }
+  static std::string get_description() {
+    return "Bounded Mpmc queue (fixed array queue with sequence numbers)";
+  }
+
+  MpmcBoundedQueue(const MpmcBoundedQueue &other) = delete;
+  MpmcBoundedQueue &operator=(const MpmcBoundedQueue &other) = delete;
+  MpmcBoundedQueue(MpmcBoundedQueue &&other) = delete;
+  MpmcBoundedQueue &operator=(MpmcBoundedQueue &&other) = delete;
+  ~MpmcBoundedQueue() = default;
+
+  size_t capacity() const {
+    return mask_ + 1;
+  }
+
+  bool try_push(T value) {
+    auto pos = write_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      auto &cell = cells_[static_cast<size_t>(pos) & mask_];
+      auto sequence = cell.sequence.load(std::memory_order_acquire);
+      if (sequence == pos) {
+        if (write_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          cell.value = std::move(value);
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (sequence < pos) {
+        return false;  // full
+      } else {
+        pos = write_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool try_pop(T &value) {
+    auto pos = read_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      auto &cell = cells_[static_cast<size_t>(pos) & mask_];
+      auto sequence = cell.sequence.load(std::memory_order_acquire);
+      if (sequence == pos + 1) {
+        if (read_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          value = std::move(cell.value);
+          cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (sequence <= pos) {
+        return false;  // empty
+      } else {
+        pos = read_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // pops up to max_count values with a single update of the read position
+  size_t try_pop_batch(T *values, size_t max_count) {
+    while (true) {
+      auto pos = read_pos_.load(std::memory_order_relaxed);
+      size_t count = 0;
+      while (count < max_count &&
+             cells_[static_cast<size_t>(pos + count) & mask_].sequence.load(std::memory_order_acquire) ==
+                 pos + count + 1) {
+        count++;
+      }
+      if (count == 0) {
+        return 0;
+      }
+      if (read_pos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+        // the claimed cells can't be refilled by writers until their sequence is updated
+        for (size_t i = 0; i < count; i++) {
+          auto &cell = cells_[static_cast<size_t>(pos + i) & mask_];
+          values[i] = std::move(cell.value);
+          cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+        }
+        return count;
+      }
+    }
+  }
+
+ private:
+  struct Cell {
+    std::atomic<uint64> sequence{0};
+    T value{};
+  };
+
+  std::vector<Cell> cells_;
+  size_t mask_{0};
+  char pad[TD_CONCURRENCY_PAD - sizeof(std::vector<Cell>) - sizeof(size_t)];
+  std::atomic<uint64> write_pos_{0};
+  char pad2[TD_CONCURRENCY_PAD - sizeof(std::atomic<uint64>)];
+  std::atomic<uint64> read_pos_{0};
+  char pad3[TD_CONCURRENCY_PAD - sizeof(std::atomic<uint64>)];
+};
+
 template <class T>
 class MpmcQueueOld {
  public:
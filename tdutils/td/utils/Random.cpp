@@ -31,7 +31,9 @@ void Random::secure_bytes(MutableSlice dest) {
 }
 
 void Random::secure_bytes(unsigned char *ptr, size_t size) {
-  constexpr size_t buf_size = 512;
+  // RAND_bytes takes a process-wide lock, so the buffer size directly limits how often
+  // msg_id/padding generation on the packet send path contends on it
+  constexpr size_t buf_size = 4096;
   static TD_THREAD_LOCAL unsigned char *buf;  // static zero-initialized
   static TD_THREAD_LOCAL size_t buf_pos;
   static TD_THREAD_LOCAL int64 generation;
@@ -6,6 +6,7 @@
 //
 #include "td/utils/StringBuilder.h"
 
+#include "td/utils/buffer.h"
 #include "td/utils/misc.h"
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Slice.h"
@@ -33,6 +34,22 @@ StringBuilder::StringBuilder(MutableSlice slice, bool use_buffer)
   }
 }
 
+StringBuilder::StringBuilder(ChainBufferWriter &writer) : chain_writer_(&writer) {
+  auto slice = writer.prepare_append_at_least(reserved_size + 1);
+  begin_ptr_ = slice.begin();
+  current_ptr_ = begin_ptr_;
+  end_ptr_ = slice.end() - reserved_size;
+}
+
+void StringBuilder::flush() {
+  if (chain_writer_ == nullptr) {
+    return;
+  }
+  chain_writer_->confirm_append(static_cast<size_t>(current_ptr_ - begin_ptr_));
+  // the rest of the prepared segment is still available for appending
+  begin_ptr_ = current_ptr_;
+}
+
 StringBuilder &StringBuilder::operator<<(Slice slice) {
   size_t size = slice.size();
   if (unlikely(!reserve(size))) {
@@ -96,6 +113,14 @@ static char *print_int(char *current_ptr, T x) {
 }
 
 bool StringBuilder::reserve_inner(size_t size) {
+  if (chain_writer_ != nullptr) {
+    flush();
+    auto slice = chain_writer_->prepare_append_at_least(size + reserved_size);
+    begin_ptr_ = slice.begin();
+    current_ptr_ = begin_ptr_;
+    end_ptr_ = slice.end() - reserved_size;
+    return true;
+  }
   if (!use_buffer_) {
     return false;
   }
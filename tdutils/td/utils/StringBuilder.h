@@ -16,10 +16,19 @@
 
 namespace td {
 
+class ChainBufferWriter;
+
 class StringBuilder {
  public:
   explicit StringBuilder(MutableSlice slice, bool use_buffer = false);
 
+  // builds the string directly inside the given writer; the builder grows by linking
+  // new rope segments instead of reallocating and copying, so it never truncates.
+  // flush() must be called before the written data is read from the writer
+  explicit StringBuilder(ChainBufferWriter &writer);
+
+  void flush();
+
   void clear() {
     current_ptr_ = begin_ptr_;
     error_flag_ = false;
@@ -104,6 +113,7 @@ class StringBuilder {
   bool error_flag_ = false;
   bool use_buffer_ = false;
   std::unique_ptr<char[]> buffer_;
+  ChainBufferWriter *chain_writer_ = nullptr;
   static constexpr size_t reserved_size = 30;
 
   StringBuilder &on_error() {
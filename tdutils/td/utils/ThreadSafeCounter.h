@@ -80,7 +80,7 @@ class NamedThreadSafeCounter {
       }
     }
     CHECK(names_.size() < N);
-    names_.emplase_back(name.begin(), name.size());
+    names_.emplace_back(name.begin(), name.size());
     return get_counter_ref(names_.size() - 1);
   }
 
@@ -0,0 +1,148 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/List.h"
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+namespace td {
+
+class TimerWheelNode : private ListNode {
+ public:
+  bool in_wheel() const {
+    return !empty();
+  }
+  double expires_at() const {
+    return expires_at_;
+  }
+
+ private:
+  double expires_at_ = 0;
+  int64 tick_ = 0;
+
+  friend class TimerWheel;
+};
+
+// Hierarchical timing wheel with O(1) insert and cancel.
+// Expiration timestamps are rounded up to a multiple of the tick duration,
+// so timers may fire up to one tick later than requested
+class TimerWheel {
+ public:
+  TimerWheel() : TimerWheel(0) {
+  }
+  explicit TimerWheel(double start_at, double tick_duration = 0.1)
+      : tick_duration_(tick_duration), current_tick_(get_tick(start_at)) {
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+  size_t size() const {
+    return size_;
+  }
+
+  void insert(double expires_at, TimerWheelNode *node) {
+    CHECK(!node->in_wheel());
+    node->expires_at_ = expires_at;
+    node->tick_ = td::max(get_tick(expires_at), current_tick_ + 1);
+    put(node);
+    size_++;
+  }
+
+  void erase(TimerWheelNode *node) {
+    CHECK(node->in_wheel());
+    node->remove();
+    size_--;
+  }
+
+  void fix(double expires_at, TimerWheelNode *node) {
+    erase(node);
+    insert(expires_at, node);
+  }
+
+  // timestamp at which run_expired should be called next; the wheel must not be empty
+  double get_wakeup_timestamp() const {
+    CHECK(!empty());
+    double result = 1e100;
+    int64 stride = 1;
+    for (size_t level = 0; level < LEVEL_COUNT; level++) {
+      for (size_t i = 1; i <= SLOT_COUNT; i++) {
+        int64 block = current_tick_ / stride + static_cast<int64>(i);
+        if (!slots_[level][static_cast<size_t>(block % SLOT_COUNT)].empty()) {
+          result = td::min(result, static_cast<double>(block * stride) * tick_duration_);
+          break;
+        }
+      }
+      stride *= SLOT_COUNT;
+    }
+    return result;
+  }
+
+  // unlinks all timers with expiration timestamp not greater than now and passes them to the callback
+  template <class CallbackT>
+  void run_expired(double now, CallbackT &&callback) {
+    int64 target_tick = static_cast<int64>(now / tick_duration_);
+    while (current_tick_ < target_tick) {
+      current_tick_++;
+      int64 stride = SLOT_COUNT;
+      for (size_t level = 1; level < LEVEL_COUNT && current_tick_ % stride == 0; level++) {
+        auto &slot = slots_[level][static_cast<size_t>((current_tick_ / stride) % SLOT_COUNT)];
+        // drain the slot first: a clamped far timer may be put back into the same slot
+        ListNode cascaded = std::move(slot);
+        while (auto *list_node = cascaded.get()) {
+          put(static_cast<TimerWheelNode *>(list_node));
+        }
+        stride *= SLOT_COUNT;
+      }
+
+      auto &slot = slots_[0][static_cast<size_t>(current_tick_ % SLOT_COUNT)];
+      while (auto *list_node = slot.get()) {
+        auto *node = static_cast<TimerWheelNode *>(list_node);
+        if (node->tick_ > current_tick_) {
+          put(node);
+        } else {
+          size_--;
+          callback(node);
+        }
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t LEVEL_COUNT = 4;
+  static constexpr size_t SLOT_COUNT = 64;
+
+  double tick_duration_;
+  int64 current_tick_;
+  size_t size_ = 0;
+  std::array<std::array<ListNode, SLOT_COUNT>, LEVEL_COUNT> slots_;
+
+  int64 get_tick(double timestamp) const {
+    return static_cast<int64>(std::ceil(timestamp / tick_duration_));
+  }
+
+  void put(TimerWheelNode *node) {
+    int64 tick = node->tick_;
+    // choose the level of the highest base-SLOT_COUNT digit in which tick and current_tick_ differ,
+    // so that every cascade moves a timer to a strictly lower level
+    int64 stride = 1;
+    size_t level = 0;
+    while (level + 1 < LEVEL_COUNT &&
+           tick / (stride * static_cast<int64>(SLOT_COUNT)) !=
+               current_tick_ / (stride * static_cast<int64>(SLOT_COUNT))) {
+      stride *= SLOT_COUNT;
+      level++;
+    }
+    slots_[level][static_cast<size_t>((tick / stride) % SLOT_COUNT)].put(node);
+  }
+};
+
+}  // namespace td
@@ -6,6 +6,7 @@
 //
 #pragma once
 
+#include "td/utils/misc.h"
 #include "td/utils/Span.h"
 
 #include <utility>
@@ -19,14 +20,17 @@ class VectorQueue {
   template <class S>
   void push(S &&s) {
     vector_.push_back(std::forward<S>(s));
+    update_high_watermark();
   }
   template <class... Args>
   void emplace(Args &&... args) {
     vector_.emplace_back(std::forward<Args>(args)...);
+    update_high_watermark();
   }
   T pop() {
+    auto result = std::move(vector_[read_pos_++]);
     try_shrink();
-    return std::move(vector_[read_pos_++]);
+    return result;
   }
   void pop_n(size_t n) {
     read_pos_ += n;
@@ -60,9 +64,28 @@ class VectorQueue {
  private:
   std::vector<T> vector_;
   size_t read_pos_{0};
+  size_t high_watermark_{0};
 
+  static constexpr size_t MIN_FREED_CAPACITY = 16;
+
+  void update_high_watermark() {
+    if (size() > high_watermark_) {
+      high_watermark_ = size();
+    }
+  }
+
+  // A drained queue releases its buffer if the capacity is far above the high
+  // watermark observed since the previous drain; most queues hold a few elements
+  // at a time, and a rare burst shouldn't pin its memory forever
   void try_shrink() {
-    if (read_pos_ * 2 > vector_.size() && read_pos_ > 4) {
+    if (read_pos_ == vector_.size()) {
+      vector_.clear();
+      read_pos_ = 0;
+      if (vector_.capacity() >= MIN_FREED_CAPACITY && vector_.capacity() > 4 * high_watermark_) {
+        reset_to_empty(vector_);
+      }
+      high_watermark_ = 0;
+    } else if (read_pos_ * 2 > vector_.size() && read_pos_ > 4) {
       vector_.erase(vector_.begin(), vector_.begin() + read_pos_);
       read_pos_ = 0;
     }
@@ -14,38 +14,62 @@
 #include <iterator>
 
 namespace td {
-//TODO: fix copypaste
 
 static const char *const symbols64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
-string base64_encode(Slice input) {
-  string base64;
-  base64.reserve((input.size() + 2) / 3 * 4);
-  for (size_t i = 0; i < input.size();) {
-    size_t left = min(input.size() - i, static_cast<size_t>(3));
-    int c = input.ubegin()[i++] << 16;
-    base64 += symbols64[c >> 18];
-    if (left != 1) {
-      c |= input.ubegin()[i++] << 8;
-    }
-    base64 += symbols64[(c >> 12) & 63];
-    if (left == 3) {
-      c |= input.ubegin()[i++];
-    }
-    if (left != 1) {
-      base64 += symbols64[(c >> 6) & 63];
-    } else {
-      base64 += '=';
+static const char *const url_symbols64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+template <bool is_url>
+static string base64_encode_impl(Slice input) {
+  const char *symbols = is_url ? url_symbols64 : symbols64;
+  size_t full_group_count = input.size() / 3;
+  size_t left = input.size() - full_group_count * 3;
+  size_t result_size = full_group_count * 4;
+  if (left != 0) {
+    result_size += is_url ? left + 1 : 4;
+  }
+
+  string base64(result_size, '\0');
+  const unsigned char *src = input.ubegin();
+  char *dst = &base64[0];
+  for (size_t i = 0; i < full_group_count; i++) {
+    uint32 c = (static_cast<uint32>(src[0]) << 16) | (static_cast<uint32>(src[1]) << 8) | src[2];
+    dst[0] = symbols[c >> 18];
+    dst[1] = symbols[(c >> 12) & 63];
+    dst[2] = symbols[(c >> 6) & 63];
+    dst[3] = symbols[c & 63];
+    src += 3;
+    dst += 4;
+  }
+  if (left == 1) {
+    uint32 c = static_cast<uint32>(src[0]) << 16;
+    *dst++ = symbols[c >> 18];
+    *dst++ = symbols[(c >> 12) & 63];
+    if (!is_url) {
+      *dst++ = '=';
+      *dst++ = '=';
     }
-    if (left == 3) {
-      base64 += symbols64[c & 63];
-    } else {
-      base64 += '=';
+  } else if (left == 2) {
+    uint32 c = (static_cast<uint32>(src[0]) << 16) | (static_cast<uint32>(src[1]) << 8);
+    *dst++ = symbols[c >> 18];
+    *dst++ = symbols[(c >> 12) & 63];
+    *dst++ = symbols[(c >> 6) & 63];
+    if (!is_url) {
+      *dst++ = '=';
     }
   }
+  CHECK(dst == &base64[0] + base64.size());
   return base64;
 }
 
+string base64_encode(Slice input) {
+  return base64_encode_impl<false>(input);
+}
+
+string base64url_encode(Slice input) {
+  return base64_encode_impl<true>(input);
+}
+
 static unsigned char char_to_value[256];
 static void init_base64_table() {
   static bool is_inited = [] {
@@ -74,35 +98,55 @@ Result<Slice> base64_drop_padding(Slice base64) {
   return base64;
 }
 
-template <class F>
-Status base64_do_decode(Slice base64, F &&append) {
-  for (size_t i = 0; i < base64.size();) {
-    size_t left = min(base64.size() - i, static_cast<size_t>(4));
-    int c = 0;
-    for (size_t t = 0; t < left; t++) {
-      auto value = char_to_value[base64.ubegin()[i++]];
+// decodes the given string without padding into dst, which must have room
+// for at least base64.size() / 4 * 3 + 3 bytes; returns the number of written bytes
+static Result<size_t> base64_do_decode(Slice base64, char *dst, const unsigned char *table) {
+  const char *dst_begin = dst;
+  const unsigned char *src = base64.ubegin();
+  size_t size = base64.size();
+  // whole groups of 4 characters need no padding checks
+  while (size >= 4) {
+    uint32 v0 = table[src[0]];
+    uint32 v1 = table[src[1]];
+    uint32 v2 = table[src[2]];
+    uint32 v3 = table[src[3]];
+    if (((v0 | v1 | v2 | v3) & 0x40) != 0) {
+      return Status::Error("Wrong character in the string");
+    }
+    uint32 c = (v0 << 18) | (v1 << 12) | (v2 << 6) | v3;
+    dst[0] = static_cast<char>(static_cast<unsigned char>(c >> 16));  // implementation-defined
+    dst[1] = static_cast<char>(static_cast<unsigned char>(c >> 8));   // implementation-defined
+    dst[2] = static_cast<char>(static_cast<unsigned char>(c));        // implementation-defined
+    src += 4;
+    dst += 3;
+    size -= 4;
+  }
+  if (size != 0) {
+    uint32 c = 0;
+    for (size_t t = 0; t < size; t++) {
+      uint32 value = table[src[t]];
       if (value == 64) {
         return Status::Error("Wrong character in the string");
       }
       c |= value << ((3 - t) * 6);
     }
-    append(static_cast<char>(static_cast<unsigned char>(c >> 16)));  // implementation-defined
-    if (left == 2) {
+    *dst++ = static_cast<char>(static_cast<unsigned char>(c >> 16));  // implementation-defined
+    if (size == 2) {
       if ((c & ((1 << 16) - 1)) != 0) {
         return Status::Error("Wrong padding in the string");
       }
     } else {
-      append(static_cast<char>(static_cast<unsigned char>(c >> 8)));  // implementation-defined
-      if (left == 3) {
+      *dst++ = static_cast<char>(static_cast<unsigned char>(c >> 8));  // implementation-defined
+      if (size == 3) {
         if ((c & ((1 << 8) - 1)) != 0) {
           return Status::Error("Wrong padding in the string");
         }
       } else {
-        append(static_cast<char>(static_cast<unsigned char>(c)));  // implementation-defined
+        *dst++ = static_cast<char>(static_cast<unsigned char>(c));  // implementation-defined
       }
     }
   }
-  return Status::OK();
+  return static_cast<size_t>(dst - dst_begin);
 }
 
 Result<string> base64_decode(Slice base64) {
@@ -110,9 +154,9 @@ Result<string> base64_decode(Slice base64) {
 
   TRY_RESULT_ASSIGN(base64, base64_drop_padding(base64));
 
-  string output;
-  output.reserve(((base64.size() + 3) >> 2) * 3);
-  TRY_STATUS(base64_do_decode(base64, [&output](char c) { output += c; }));
+  string output(((base64.size() + 3) >> 2) * 3, '\0');
+  TRY_RESULT(size, base64_do_decode(base64, &output[0], char_to_value));
+  output.resize(size);
   return output;
 }
 
@@ -122,41 +166,13 @@ Result<SecureString> base64_decode_secure(Slice base64) {
   TRY_RESULT_ASSIGN(base64, base64_drop_padding(base64));
 
   SecureString output(((base64.size() + 3) >> 2) * 3);
-  char *ptr = output.as_mutable_slice().begin();
-  TRY_STATUS(base64_do_decode(base64, [&ptr](char c) { *ptr++ = c; }));
-  size_t size = ptr - output.as_mutable_slice().begin();
+  TRY_RESULT(size, base64_do_decode(base64, output.as_mutable_slice().begin(), char_to_value));
   if (size == output.size()) {
     return std::move(output);
   }
   return SecureString(output.as_slice().substr(0, size));
 }
 
-static const char *const url_symbols64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
-
-string base64url_encode(Slice input) {
-  string base64;
-  base64.reserve((input.size() + 2) / 3 * 4);
-  for (size_t i = 0; i < input.size();) {
-    size_t left = min(input.size() - i, static_cast<size_t>(3));
-    int c = input.ubegin()[i++] << 16;
-    base64 += url_symbols64[c >> 18];
-    if (left != 1) {
-      c |= input.ubegin()[i++] << 8;
-    }
-    base64 += url_symbols64[(c >> 12) & 63];
-    if (left == 3) {
-      c |= input.ubegin()[i++];
-    }
-    if (left != 1) {
-      base64 += url_symbols64[(c >> 6) & 63];
-    }
-    if (left == 3) {
-      base64 += url_symbols64[c & 63];
-    }
-  }
-  return base64;
-}
-
 static unsigned char url_char_to_value[256];
 static void init_base64url_table() {
   static bool is_inited = [] {
@@ -185,34 +201,9 @@ Result<string> base64url_decode(Slice base64) {
     return Status::Error("Wrong string length");
   }
 
-  string output;
-  output.reserve(((base64.size() + 3) >> 2) * 3);
-  for (size_t i = 0; i < base64.size();) {
-    size_t left = min(base64.size() - i, static_cast<size_t>(4));
-    int c = 0;
-    for (size_t t = 0; t < left; t++) {
-      auto value = url_char_to_value[base64.ubegin()[i++]];
-      if (value == 64) {
-        return Status::Error("Wrong character in the string");
-      }
-      c |= value << ((3 - t) * 6);
-    }
-    output += static_cast<char>(static_cast<unsigned char>(c >> 16));  // implementation-defined
-    if (left == 2) {
-      if ((c & ((1 << 16) - 1)) != 0) {
-        return Status::Error("Wrong padding in the string");
-      }
-    } else {
-      output += static_cast<char>(static_cast<unsigned char>(c >> 8));  // implementation-defined
-      if (left == 3) {
-        if ((c & ((1 << 8) - 1)) != 0) {
-          return Status::Error("Wrong padding in the string");
-        }
-      } else {
-        output += static_cast<char>(static_cast<unsigned char>(c));  // implementation-defined
-      }
-    }
-  }
+  string output(((base64.size() + 3) >> 2) * 3, '\0');
+  TRY_RESULT(size, base64_do_decode(base64, &output[0], url_char_to_value));
+  output.resize(size);
   return output;
 }
 
@@ -6,12 +6,19 @@
 //
 #pragma once
 
+#include "td/utils/filesystem.h"
 #include "td/utils/format.h"
+#include "td/utils/JsonBuilder.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
 #include "td/utils/port/Clocks.h"
+#include "td/utils/port/FileFd.h"
 #include "td/utils/StringBuilder.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <map>
 #include <tuple>
 #include <utility>
 
@@ -84,6 +91,81 @@ inline std::pair<double, double> bench_n(Benchmark &&b, int n) {
   return bench_n(b, n);
 }
 
+// Machine-readable output for perf CI. If TD_BENCH_OUTPUT is set, every result
+// is appended to that file as one JSON object per line. If TD_BENCH_BASELINE
+// is set, every result is also compared with an output file written by an
+// earlier run, and the delta is reported only when it exceeds both the
+// measured noise of the two runs and 5%, so jitter doesn't fail builds.
+inline void report_benchmark_result(const std::string &description, double average, double min_pass_time,
+                                    double max_pass_time, double d) {
+  auto *output_path = std::getenv("TD_BENCH_OUTPUT");
+  if (output_path != nullptr) {
+    auto json = json_encode<std::string>(json_object([&](auto &o) {
+      o("name", description);
+      o("ops_per_sec", average);
+      o("min_ops_per_sec", min_pass_time);
+      o("max_ops_per_sec", max_pass_time);
+      o("d", d);
+      o("unix_time", Clocks::system());
+    }));
+    json += '\n';
+    auto r_fd = FileFd::open(CSlice(output_path), FileFd::Write | FileFd::Create | FileFd::Append);
+    if (r_fd.is_ok()) {
+      auto fd = r_fd.move_as_ok();
+      fd.write(json).ignore();
+      fd.close();
+    } else {
+      LOG(ERROR) << "Can't open benchmark output file: " << r_fd.error();
+    }
+  }
+
+  auto *baseline_path = std::getenv("TD_BENCH_BASELINE");
+  if (baseline_path == nullptr) {
+    return;
+  }
+  static const std::map<std::string, std::pair<double, double>> baseline = [baseline_path] {
+    std::map<std::string, std::pair<double, double>> result;
+    auto r_data = read_file_str(CSlice(baseline_path));
+    if (r_data.is_error()) {
+      LOG(ERROR) << "Can't read benchmark baseline: " << r_data.error();
+      return result;
+    }
+    auto data = r_data.move_as_ok();
+    for (auto &line : full_split(MutableSlice(data), '\n')) {
+      auto r_value = json_decode(line);
+      if (r_value.is_error() || r_value.ok().type() != JsonValue::Type::Object) {
+        continue;
+      }
+      auto value = r_value.move_as_ok();
+      auto &object = value.get_object();
+      auto r_name = get_json_object_string_field(object, "name", false);
+      auto r_ops = get_json_object_double_field(object, "ops_per_sec", false);
+      auto r_d = get_json_object_double_field(object, "d");
+      if (r_name.is_error() || r_ops.is_error()) {
+        continue;
+      }
+      result[r_name.move_as_ok()] = {r_ops.ok(), r_d.is_ok() ? r_d.ok() : 0.0};
+    }
+    return result;
+  }();
+  auto it = baseline.find(description);
+  if (it == baseline.end()) {
+    LOG(ERROR) << "Bench [" << description << "]: no baseline";
+    return;
+  }
+  auto base_average = it->second.first;
+  auto delta = average - base_average;
+  auto noise = d + it->second.second;
+  auto percent = delta / base_average * 100;
+  if (std::fabs(delta) <= std::max(noise, 0.05 * base_average)) {
+    LOG(ERROR) << "Bench [" << description << "]: no significant change vs baseline ("
+               << StringBuilder::FixedDouble(percent, 1) << "%)";
+  } else {
+    LOG(ERROR) << "Bench [" << description << "]: " << (delta > 0 ? "FASTER" : "SLOWER") << " than baseline by "
+               << StringBuilder::FixedDouble(std::fabs(percent), 1) << '%';
+  }
+}
+
 inline void bench(Benchmark &b, double max_time = 1.0) {
   int n = 1;
   double pass_time = 0;
@@ -123,6 +205,8 @@ inline void bench(Benchmark &b, double max_time = 1.0) {
   LOG(ERROR) << "Bench [" << pad << description << "]: " << StringBuilder::FixedDouble(average, 3) << '['
              << StringBuilder::FixedDouble(min_pass_time, 3) << '-' << StringBuilder::FixedDouble(max_pass_time, 3)
              << "] ops/sec,\t" << format::as_time(1 / average) << " [d = " << StringBuilder::FixedDouble(d, 6) << ']';
+
+  report_benchmark_result(description, average, min_pass_time, max_pass_time, d);
 }
 
 inline void bench(Benchmark &&b, double max_time = 1.0) {
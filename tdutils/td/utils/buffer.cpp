@@ -22,20 +22,45 @@ namespace td {
 
 TD_THREAD_LOCAL BufferAllocator::BufferRawTls *BufferAllocator::buffer_raw_tls;  // static zero-initialized
 
+constexpr size_t BufferAllocator::SMALL_BUFFER_SIZE;
+constexpr size_t BufferAllocator::FAST_BUFFER_SIZE;
+
 std::atomic<size_t> BufferAllocator::buffer_mem;
+std::atomic<size_t> BufferAllocator::small_slab_size_{4096};
+std::atomic<size_t> BufferAllocator::big_slab_size_{4096 * 4};
+std::atomic<uint64> BufferAllocator::slab_alloc_count_;
+std::atomic<uint64> BufferAllocator::slab_reuse_count_;
+std::atomic<uint64> BufferAllocator::exact_alloc_count_;
+std::atomic<uint64> BufferAllocator::recycle_count_;
 
 size_t BufferAllocator::get_buffer_mem() {
   return buffer_mem;
 }
 
+BufferAllocator::Stats BufferAllocator::get_stats() {
+  Stats stats;
+  stats.slab_alloc_count = slab_alloc_count_.load(std::memory_order_relaxed);
+  stats.slab_reuse_count = slab_reuse_count_.load(std::memory_order_relaxed);
+  stats.exact_alloc_count = exact_alloc_count_.load(std::memory_order_relaxed);
+  stats.recycle_count = recycle_count_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void BufferAllocator::set_slab_sizes(size_t small_slab_size, size_t big_slab_size) {
+  // each slab must be able to hold at least a few buffers of its tier
+  small_slab_size_.store(td::max(small_slab_size, 4 * SMALL_BUFFER_SIZE), std::memory_order_relaxed);
+  big_slab_size_.store(td::max(big_slab_size, 4 * FAST_BUFFER_SIZE), std::memory_order_relaxed);
+}
+
 BufferAllocator::WriterPtr BufferAllocator::create_writer(size_t size) {
-  if (size < 512) {
-    size = 512;
+  if (size < FAST_BUFFER_SIZE) {
+    size = FAST_BUFFER_SIZE;
   }
   return create_writer_exact(size);
 }
 
 BufferAllocator::WriterPtr BufferAllocator::create_writer_exact(size_t size) {
+  exact_alloc_count_.fetch_add(1, std::memory_order_relaxed);
   return WriterPtr(create_buffer_raw(size));
 }
 
@@ -47,7 +72,7 @@ BufferAllocator::WriterPtr BufferAllocator::create_writer(size_t size, size_t pr
 }
 
 BufferAllocator::ReaderPtr BufferAllocator::create_reader(size_t size) {
-  if (size < 512) {
+  if (size < FAST_BUFFER_SIZE) {
     return create_reader_fast(size);
   }
   auto ptr = create_writer_exact(size);
@@ -60,10 +85,17 @@ BufferAllocator::ReaderPtr BufferAllocator::create_reader_fast(size_t size) {
 
   init_thread_local<BufferRawTls>(buffer_raw_tls);
 
-  auto buffer_raw = buffer_raw_tls->buffer_raw.get();
+  // small buffers are carved from their own slab, so a burst of tiny allocations
+  // doesn't exhaust the slab used for medium-sized buffers
+  auto &slab = size <= SMALL_BUFFER_SIZE ? buffer_raw_tls->small_buffer_raw : buffer_raw_tls->buffer_raw;
+  auto buffer_raw = slab.get();
   if (buffer_raw == nullptr || buffer_raw->data_size_ - buffer_raw->end_.load(std::memory_order_relaxed) < size) {
-    buffer_raw = create_buffer_raw(4096 * 4);
-    buffer_raw_tls->buffer_raw = std::unique_ptr<BufferRaw, BufferAllocator::BufferRawDeleter>(buffer_raw);
+    auto slab_size = (size <= SMALL_BUFFER_SIZE ? small_slab_size_ : big_slab_size_).load(std::memory_order_relaxed);
+    buffer_raw = create_buffer_raw(slab_size);
+    slab = std::unique_ptr<BufferRaw, BufferAllocator::BufferRawDeleter>(buffer_raw);
+    slab_alloc_count_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    slab_reuse_count_.fetch_add(1, std::memory_order_relaxed);
   }
   buffer_raw->end_.fetch_add(size, std::memory_order_relaxed);
   buffer_raw->ref_cnt_.fetch_add(1, std::memory_order_acq_rel);
@@ -84,16 +116,55 @@ BufferAllocator::ReaderPtr BufferAllocator::create_reader(const ReaderPtr &raw)
 void BufferAllocator::dec_ref_cnt(BufferRaw *ptr) {
   int left = ptr->ref_cnt_.fetch_sub(1, std::memory_order_acq_rel);
   if (left == 1) {
-    auto buf_size = max(sizeof(BufferRaw), TD_OFFSETOF(BufferRaw, data_) + ptr->data_size_);
-    buffer_mem -= buf_size;
-    ptr->~BufferRaw();
-    delete[] ptr;
+    if (try_recycle_buffer_raw(ptr)) {
+      return;
+    }
+    free_buffer_raw(ptr);
+  }
+}
+
+bool BufferAllocator::try_recycle_buffer_raw(BufferRaw *ptr) {
+  if (buffer_raw_tls == nullptr) {
+    // don't create the thread-local state just to cache a buffer
+    return false;
+  }
+  auto data_size = ptr->data_size_;
+  if (data_size != small_slab_size_.load(std::memory_order_relaxed) &&
+      data_size != big_slab_size_.load(std::memory_order_relaxed)) {
+    // only buffers of the recurring slab sizes are worth caching
+    return false;
+  }
+  for (auto &recycled_buffer : buffer_raw_tls->recycled_buffers) {
+    if (recycled_buffer == nullptr) {
+      // BufferRaw is trivially destructible, so the object is just kept
+      // until it is reinited by placement new or freed with the thread
+      recycled_buffer = std::unique_ptr<BufferRaw, BufferRawFreeDeleter>(ptr);
+      return true;
+    }
   }
+  return false;
+}
+
+void BufferAllocator::free_buffer_raw(BufferRaw *ptr) {
+  auto buf_size = max(sizeof(BufferRaw), TD_OFFSETOF(BufferRaw, data_) + ptr->data_size_);
+  buffer_mem -= buf_size;
+  ptr->~BufferRaw();
+  delete[] ptr;
 }
 
 BufferRaw *BufferAllocator::create_buffer_raw(size_t size) {
   size = (size + 7) & -8;
 
+  if (buffer_raw_tls != nullptr) {
+    for (auto &recycled_buffer : buffer_raw_tls->recycled_buffers) {
+      if (recycled_buffer != nullptr && recycled_buffer->data_size_ == size) {
+        auto *buffer_raw = recycled_buffer.release();
+        recycle_count_.fetch_add(1, std::memory_order_relaxed);
+        return new (buffer_raw) BufferRaw(size);
+      }
+    }
+  }
+
   auto buf_size = TD_OFFSETOF(BufferRaw, data_) + size;
   if (buf_size < sizeof(BufferRaw)) {
     buf_size = sizeof(BufferRaw);
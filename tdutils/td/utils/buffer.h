@@ -70,9 +70,26 @@ class BufferAllocator {
 
   static size_t get_buffer_mem();
 
+  // allocator counters since the start of the program; the counters are updated with relaxed
+  // atomics, so the returned values may be slightly inconsistent with each other
+  struct Stats {
+    uint64 slab_alloc_count{0};   // the number of allocated thread-local slabs
+    uint64 slab_reuse_count{0};   // the number of buffers carved from an existing slab
+    uint64 exact_alloc_count{0};  // the number of buffers allocated exactly
+    uint64 recycle_count{0};      // the number of buffers reused from the per-thread recycle cache
+  };
+  static Stats get_stats();
+
+  // sets the sizes of the thread-local slabs used for small buffers;
+  // must be called before any buffer is allocated
+  static void set_slab_sizes(size_t small_slab_size, size_t big_slab_size);
+
   static void clear_thread_local();
 
  private:
+  static constexpr size_t SMALL_BUFFER_SIZE = 64;   // small buffers are carved from the small slab
+  static constexpr size_t FAST_BUFFER_SIZE = 512;   // other buffers up to this size are carved from the big slab
+
   static ReaderPtr create_reader_fast(size_t size);
 
   static WriterPtr create_writer_exact(size_t size);
@@ -82,17 +99,35 @@ class BufferAllocator {
       dec_ref_cnt(ptr);
     }
   };
+  struct BufferRawFreeDeleter {
+    void operator()(BufferRaw *ptr) {
+      free_buffer_raw(ptr);
+    }
+  };
   struct BufferRawTls {
+    std::unique_ptr<BufferRaw, BufferRawDeleter> small_buffer_raw;
     std::unique_ptr<BufferRaw, BufferRawDeleter> buffer_raw;
+    // fully released buffers of slab sizes are kept here for reuse by this thread
+    std::unique_ptr<BufferRaw, BufferRawFreeDeleter> recycled_buffers[2];
   };
 
   static TD_THREAD_LOCAL BufferRawTls *buffer_raw_tls;
 
   static void dec_ref_cnt(BufferRaw *ptr);
 
+  static bool try_recycle_buffer_raw(BufferRaw *ptr);
+
+  static void free_buffer_raw(BufferRaw *ptr);
+
   static BufferRaw *create_buffer_raw(size_t size);
 
   static std::atomic<size_t> buffer_mem;
+  static std::atomic<size_t> small_slab_size_;
+  static std::atomic<size_t> big_slab_size_;
+  static std::atomic<uint64> slab_alloc_count_;
+  static std::atomic<uint64> slab_reuse_count_;
+  static std::atomic<uint64> exact_alloc_count_;
+  static std::atomic<uint64> recycle_count_;
 };
 
 using BufferWriterPtr = BufferAllocator::WriterPtr;
@@ -14,6 +14,7 @@
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Random.h"
 #include "td/utils/ScopeGuard.h"
+#include "td/utils/uint128.h"
 
 #if TD_HAVE_OPENSSL
 #include <openssl/aes.h>
@@ -73,59 +74,94 @@ static uint64 gcd(uint64 a, uint64 b) {
   }
 }
 
+// returns a * b / 2^64 modulo an odd pq < 2^63; pq_inv must be -pq^{-1} modulo 2^64
+static uint64 mont_mul(uint64 a, uint64 b, uint64 pq, uint64 pq_inv) {
+  auto t = uint128(0, a).mult(uint128(0, b));
+  uint64 m = t.lo() * pq_inv;
+  uint64 res = t.add(uint128(0, m).mult(uint128(0, pq))).hi();
+  if (res >= pq) {
+    res -= pq;
+  }
+  return res;
+}
+
 uint64 pq_factorize(uint64 pq) {
-  if (pq < 2 || pq > (static_cast<uint64>(1) << 63)) {
+  if (pq <= 2 || pq > (static_cast<uint64>(1) << 63)) {
     return 1;
   }
-  uint64 g = 0;
-  for (int i = 0, iter = 0; i < 3 || iter < 1000; i++) {
-    uint64 q = Random::fast(17, 32) % (pq - 1);
-    uint64 x = Random::fast_uint64() % (pq - 1) + 1;
-    uint64 y = x;
-    int lim = 1 << (min(5, i) + 18);
-    for (int j = 1; j < lim; j++) {
-      iter++;
-      uint64 a = x;
-      uint64 b = x;
-      uint64 c = q;
-
-      // c += a * b
-      while (b) {
-        if (b & 1) {
-          c += a;
-          if (c >= pq) {
-            c -= pq;
-          }
-        }
-        a += a;
-        if (a >= pq) {
-          a -= pq;
-        }
-        b >>= 1;
-      }
+  if ((pq & 1) == 0) {
+    return 2;
+  }
 
-      x = c;
-      uint64 z = x < y ? pq + x - y : x - y;
-      g = gcd(z, pq);
-      if (g != 1) {
-        break;
-      }
+  // trial division by small odd numbers: for a tiny prime factor a rho round collides
+  // modulo pq itself too often and gets discarded, so small factors are found
+  // deterministically instead. As a side effect every pq below 2^20 is fully resolved here
+  for (uint64 d = 3; d < 1024; d += 2) {
+    if (d * d > pq) {
+      return 1;  // pq is prime
+    }
+    if (pq % d == 0) {
+      return d;
+    }
+  }
 
-      if (!(j & (j - 1))) {
-        y = x;
+  // -pq^{-1} modulo 2^64 by Newton's iteration; every step doubles the number of correct bits
+  uint64 pq_inv = pq;
+  for (int i = 0; i < 5; i++) {
+    pq_inv *= 2 - pq * pq_inv;
+  }
+  pq_inv = 0 - pq_inv;
+
+  // Brent's cycle finding with products of differences accumulated between gcds.
+  // All multiplications are Montgomery multiplications; the iterated map remains
+  // a valid pseudorandom polynomial modulo each prime factor, so the values are
+  // never converted into or out of the Montgomery domain
+  uint64 g = 1;
+  for (int round = 0; round < 10 && (g == 1 || g == pq); round++) {
+    uint64 y = Random::fast_uint64() % (pq - 1) + 1;
+    uint64 c = Random::fast_uint64() % (pq - 1) + 1;
+    uint64 x = y;
+    uint64 ys = y;
+    uint64 q = 1;
+    g = 1;
+    for (uint64 r = 1; g == 1 && r <= (1 << 20); r *= 2) {
+      x = y;
+      for (uint64 i = 0; i < r; i++) {
+        y = mont_mul(y, y, pq, pq_inv) + c;
+        if (y >= pq) {
+          y -= pq;
+        }
+      }
+      for (uint64 k = 0; k < r && g == 1; k += 128) {
+        ys = y;
+        auto batch_size = min(static_cast<uint64>(128), r - k);
+        for (uint64 i = 0; i < batch_size; i++) {
+          y = mont_mul(y, y, pq, pq_inv) + c;
+          if (y >= pq) {
+            y -= pq;
+          }
+          q = mont_mul(q, x > y ? x - y : y - x, pq, pq_inv);
+        }
+        g = gcd(q, pq);
       }
     }
-    if (g > 1 && g < pq) {
-      break;
+    if (g == pq) {
+      // the batched gcd overshot the collision; redo the last batch one step at a time
+      g = 1;
+      while (g == 1) {
+        ys = mont_mul(ys, ys, pq, pq_inv) + c;
+        if (ys >= pq) {
+          ys -= pq;
+        }
+        g = gcd(x > ys ? x - ys : ys - x, pq);
+      }
     }
   }
-  if (g != 0) {
-    uint64 other = pq / g;
-    if (other < g) {
-      g = other;
-    }
+  if (g == 0 || g == pq) {
+    return 1;
   }
-  return g;
+  uint64 other = pq / g;
+  return other < g ? other : g;
 }
 
 #if TD_HAVE_OPENSSL
@@ -241,19 +277,55 @@ int pq_factorize(Slice pq_str, string *p_str, string *q_str) {
   return 0;
 }
 
+static void aes_block_xor(const uint8 *from, const uint8 *other, uint8 *to) {
+  as<uint64>(to) = static_cast<uint64>(as<uint64>(from)) ^ static_cast<uint64>(as<uint64>(other));
+  as<uint64>(to + 8) = static_cast<uint64>(as<uint64>(from + 8)) ^ static_cast<uint64>(as<uint64>(other + 8));
+}
+
 static void aes_ige_xcrypt(Slice aes_key, MutableSlice aes_iv, Slice from, MutableSlice to, bool encrypt_flag) {
   CHECK(aes_key.size() == 32);
   CHECK(aes_iv.size() == 32);
-  AES_KEY key;
-  int err;
-  if (encrypt_flag) {
-    err = AES_set_encrypt_key(aes_key.ubegin(), 256, &key);
-  } else {
-    err = AES_set_decrypt_key(aes_key.ubegin(), 256, &key);
-  }
-  LOG_IF(FATAL, err != 0);
+  CHECK(from.size() % AES_BLOCK_SIZE == 0);
   CHECK(from.size() <= to.size());
-  AES_ige_encrypt(from.ubegin(), to.ubegin(), from.size(), &key, aes_iv.ubegin(), encrypt_flag);
+
+  // AES_ige_encrypt never dispatches to the hardware-accelerated AES implementations,
+  // so the IGE chaining is done here over an EVP context, which does
+  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  CHECK(ctx != nullptr);
+  SCOPE_EXIT {
+    EVP_CIPHER_CTX_free(ctx);
+  };
+  int err = EVP_CipherInit_ex(ctx, EVP_aes_256_ecb(), nullptr, aes_key.ubegin(), nullptr, encrypt_flag ? 1 : 0);
+  LOG_IF(FATAL, err != 1);
+  EVP_CIPHER_CTX_set_padding(ctx, 0);
+
+  uint8 *encrypted_iv = aes_iv.ubegin();
+  uint8 *plaintext_iv = aes_iv.ubegin() + AES_BLOCK_SIZE;
+  const uint8 *in = from.ubegin();
+  uint8 *out = to.ubegin();
+  uint8 in_block[AES_BLOCK_SIZE];
+  uint8 block[AES_BLOCK_SIZE];
+  int block_size = 0;
+  for (size_t offset = 0; offset < from.size(); offset += AES_BLOCK_SIZE) {
+    // from and to may be the same buffer
+    std::memcpy(in_block, in + offset, AES_BLOCK_SIZE);
+    if (encrypt_flag) {
+      aes_block_xor(in_block, encrypted_iv, block);
+      err = EVP_CipherUpdate(ctx, block, &block_size, block, AES_BLOCK_SIZE);
+      LOG_IF(FATAL, err != 1);
+      aes_block_xor(block, plaintext_iv, block);
+      std::memcpy(encrypted_iv, block, AES_BLOCK_SIZE);
+      std::memcpy(plaintext_iv, in_block, AES_BLOCK_SIZE);
+    } else {
+      aes_block_xor(in_block, plaintext_iv, block);
+      err = EVP_CipherUpdate(ctx, block, &block_size, block, AES_BLOCK_SIZE);
+      LOG_IF(FATAL, err != 1);
+      aes_block_xor(block, encrypted_iv, block);
+      std::memcpy(plaintext_iv, block, AES_BLOCK_SIZE);
+      std::memcpy(encrypted_iv, in_block, AES_BLOCK_SIZE);
+    }
+    std::memcpy(out + offset, block, AES_BLOCK_SIZE);
+  }
 }
 
 void aes_ige_encrypt(Slice aes_key, MutableSlice aes_iv, Slice from, MutableSlice to) {
@@ -305,35 +377,34 @@ class AesCtrState::Impl {
     CHECK(key.size() == 32);
     CHECK(iv.size() == 16);
     static_assert(AES_BLOCK_SIZE == 16, "");
-    if (AES_set_encrypt_key(key.ubegin(), 256, &aes_key) < 0) {
-      LOG(FATAL) << "Failed to set encrypt key";
-    }
-    counter.as_mutable_slice().copy_from(iv);
-    current_pos = 0;
+    ctx_ = EVP_CIPHER_CTX_new();
+    CHECK(ctx_ != nullptr);
+    int err = EVP_EncryptInit_ex(ctx_, EVP_aes_256_ctr(), nullptr, key.ubegin(), iv.ubegin());
+    LOG_IF(FATAL, err != 1);
+  }
+  Impl(const Impl &other) = delete;
+  Impl &operator=(const Impl &other) = delete;
+  Impl(Impl &&other) = delete;
+  Impl &operator=(Impl &&other) = delete;
+  ~Impl() {
+    EVP_CIPHER_CTX_free(ctx_);
   }
 
   void encrypt(Slice from, MutableSlice to) {
     CHECK(to.size() >= from.size());
-    for (size_t i = 0; i < from.size(); i++) {
-      if (current_pos == 0) {
-        AES_encrypt(counter.as_slice().ubegin(), encrypted_counter.as_mutable_slice().ubegin(), &aes_key);
-        uint8 *ptr = counter.as_mutable_slice().ubegin();
-        for (int j = 15; j >= 0; j--) {
-          if (++ptr[j] != 0) {
-            break;
-          }
-        }
-      }
-      to[i] = static_cast<char>(from[i] ^ encrypted_counter[current_pos]);
-      current_pos = (current_pos + 1) & 15;
+    // EVP_EncryptUpdate receives the length as int, so huge slices are processed in parts
+    while (!from.empty()) {
+      auto part = from.substr(0, min(from.size(), static_cast<size_t>(1 << 30)));
+      int len = 0;
+      int err = EVP_EncryptUpdate(ctx_, to.ubegin(), &len, part.ubegin(), static_cast<int>(part.size()));
+      LOG_IF(FATAL, err != 1);
+      from.remove_prefix(part.size());
+      to.remove_prefix(part.size());
     }
   }
 
  private:
-  AES_KEY aes_key;
-  SecureString counter{AES_BLOCK_SIZE};
-  SecureString encrypted_counter{AES_BLOCK_SIZE};
-  uint8 current_pos;
+  EVP_CIPHER_CTX *ctx_;
 };
 
 AesCtrState::AesCtrState() = default;
@@ -10,6 +10,12 @@
 
 namespace td {
 
+// The scan is not a byte loop: memchr jumps to the next candidate first byte
+// within each contiguous chain node, a candidate lying wholly inside the node is
+// checked in place with memcmp, and only a candidate spanning a node border is
+// stitched together through a cloned reader. memchr is the right vector engine
+// here, since libc implementations use SIMD registers internally and the code
+// stays portable.
 bool find_boundary(ChainBufferReader range, Slice boundary, size_t &already_read) {
   range.advance(already_read);
 
@@ -21,6 +27,16 @@ bool find_boundary(ChainBufferReader range, Slice boundary, size_t &already_read
       if (range.size() < boundary.size()) {
         return false;
       }
+      if (ready.size() >= boundary.size()) {
+        // the whole boundary candidate is inside the current chain node,
+        // so it can be compared in place without copying it out
+        if (std::memcmp(ready.data(), boundary.data(), boundary.size()) == 0) {
+          return true;
+        }
+        range.advance(1);
+        already_read++;
+        continue;
+      }
       auto save_range = range.clone();
       char x[MAX_BOUNDARY_LENGTH + 4];
       range.advance(boundary.size(), {x, sizeof(x)});
@@ -6,8 +6,14 @@
 //
 #include "td/utils/port/Clocks.h"
 
+#include "td/utils/port/config.h"
+
 #include <chrono>
 
+#if TD_PORT_POSIX
+#include <time.h>
+#endif
+
 namespace td {
 
 ClocksDefault::Duration ClocksDefault::monotonic() {
@@ -20,4 +26,14 @@ ClocksDefault::Duration ClocksDefault::system() {
   return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) * 1e-9;
 }
 
+ClocksDefault::Duration ClocksDefault::thread_cpu() {
+#if TD_PORT_POSIX && defined(CLOCK_THREAD_CPUTIME_ID)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+  }
+#endif
+  return monotonic();
+}
+
 }  // namespace td
@@ -21,6 +21,10 @@ class ClocksDefault {
   static Duration monotonic();
 
   static Duration system();
+
+  // CPU time consumed by the calling thread; falls back to monotonic()
+  // if the platform provides no thread clock
+  static Duration thread_cpu();
 };
 
 using Clocks = ClocksDefault;
@@ -281,6 +281,11 @@ Result<size_t> FileFd::read(MutableSlice slice) {
   return OS_ERROR(PSLICE() << "Read from " << get_native_fd() << " has failed");
 }
 
+// pread/pwrite stay synchronous by design: callers run them on file scheduler
+// threads, which keeps the main loop unblocked without per-operation handoff.
+// An io_uring backend would be Linux-only, need a new library dependency, and
+// give this port layer a second completion model to maintain next to the
+// poll-based one, so it is not worth it for the file sizes TDLib works with.
 Result<size_t> FileFd::pwrite(Slice slice, int64 offset) {
   if (offset < 0) {
     return Status::Error("Offset must be non-negative");
@@ -552,6 +557,50 @@ Status FileFd::truncate_to_current_position(int64 current_position) {
   }
   return Status::OK();
 }
+
+Status FileFd::pre_allocate(int64 size) {
+  CHECK(!empty());
+  if (size <= 0) {
+    return Status::OK();
+  }
+#if TD_LINUX || TD_ANDROID || TD_TIZEN
+  TRY_RESULT(size_off_t, narrow_cast_safe<off_t>(size));
+  int err;
+  do {
+    // posix_fallocate returns the error instead of setting errno
+    err = posix_fallocate(get_native_fd().fd(), 0, size_off_t);
+  } while (err == EINTR);
+  if (err != 0) {
+    return Status::PosixError(err, "Pre-allocation failed");
+  }
+#elif TD_DARWIN
+  fstore_t fstore;
+  fstore.fst_flags = F_ALLOCATECONTIG;
+  fstore.fst_posmode = F_PEOFPOSMODE;
+  fstore.fst_offset = 0;
+  fstore.fst_length = size;
+  fstore.fst_bytesalloc = 0;
+  if (fcntl(get_native_fd().fd(), F_PREALLOCATE, &fstore) == -1) {
+    fstore.fst_flags = F_ALLOCATEALL;
+    if (fcntl(get_native_fd().fd(), F_PREALLOCATE, &fstore) == -1) {
+      return OS_ERROR("Pre-allocation failed");
+    }
+  }
+  // F_PREALLOCATE doesn't change the size of the file
+  TRY_RESULT(size_off_t, narrow_cast_safe<off_t>(size));
+  if (detail::skip_eintr([&] { return ::ftruncate(get_native_fd().fd(), size_off_t); }) < 0) {
+    return OS_ERROR("Pre-allocation failed");
+  }
+#elif TD_PORT_WINDOWS
+  FILE_ALLOCATION_INFO alloc_info;
+  alloc_info.AllocationSize.QuadPart = size;
+  if (SetFileInformationByHandle(get_native_fd().fd(), FileAllocationInfo, &alloc_info, sizeof(alloc_info)) == 0) {
+    return OS_ERROR("Pre-allocation failed");
+  }
+#endif
+  return Status::OK();
+}
+
 PollableFdInfo &FileFd::get_poll_info() {
   CHECK(!empty());
   return impl_->info;
@@ -63,6 +63,8 @@ class FileFd {
 
   Status truncate_to_current_position(int64 current_position) TD_WARN_UNUSED_RESULT;
 
+  Status pre_allocate(int64 size) TD_WARN_UNUSED_RESULT;
+
   const NativeFd &get_native_fd() const;
   NativeFd move_as_native_fd();
 
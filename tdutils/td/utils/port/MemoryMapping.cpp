@@ -25,6 +25,15 @@ namespace td {
 class MemoryMapping::Impl {
  public:
   Impl(MutableSlice data, int64 offset) : data_(data), offset_(offset) {
+  }
+  Impl(const Impl &other) = delete;
+  Impl &operator=(const Impl &other) = delete;
+  ~Impl() {
+#if !TD_WINDOWS
+    if (!data_.empty()) {
+      munmap(data_.begin(), data_.size());
+    }
+#endif
   }
   Slice as_slice() const {
     return data_.substr(narrow_cast<size_t>(offset_));
@@ -75,7 +84,7 @@ Result<MemoryMapping> MemoryMapping::create_from_file(const FileFd &file_fd, con
   if (options.size < 0) {
     end = stat.size_;
   } else {
-    end = begin + stat.size_;
+    end = begin + options.size;
   }
 
   TRY_RESULT(page_size, get_page_size());
@@ -88,6 +97,9 @@ Result<MemoryMapping> MemoryMapping::create_from_file(const FileFd &file_fd, con
   if (data == MAP_FAILED) {
     return OS_ERROR("mmap call failed");
   }
+  if (options.is_sequential_access) {
+    madvise(data, data_size, MADV_SEQUENTIAL);
+  }
 
   return MemoryMapping(make_unique<Impl>(MutableSlice(static_cast<char *>(data), data_size), data_offset));
 #endif
@@ -18,6 +18,7 @@ class MemoryMapping {
   struct Options {
     int64 offset{0};
     int64 size{-1};
+    bool is_sequential_access{false};
 
     Options() {
     }
@@ -29,6 +30,10 @@ class MemoryMapping {
       size = new_size;
       return *this;
     }
+    Options &with_sequential_access() {
+      is_sequential_access = true;
+      return *this;
+    }
   };
 
   static Result<MemoryMapping> create_anonymous(const Options &options = {});
@@ -650,8 +650,8 @@ class UdpSocketFdImpl {
     //  struct msghdr msg_hdr; [> Message header <]
     //  unsigned int msg_len;  [> Number of bytes transmitted <]
     //};
-    struct std::array<detail::UdpSocketSendHelper, 16> helpers;
-    struct std::array<struct mmsghdr, 16> headers;
+    struct std::array<detail::UdpSocketSendHelper, UdpSocketFd::max_message_batch_size> helpers;
+    struct std::array<struct mmsghdr, UdpSocketFd::max_message_batch_size> headers;
     size_t to_send = min(messages.size(), headers.size());
     for (size_t i = 0; i < to_send; i++) {
       helpers[i].to_native(messages[i], headers[i].msg_hdr);
@@ -701,8 +701,8 @@ class UdpSocketFdImpl {
     //  struct msghdr msg_hdr; [> Message header <]
     //  unsigned int msg_len;  [> Number of bytes transmitted <]
     //};
-    struct std::array<detail::UdpSocketReceiveHelper, 16> helpers;
-    struct std::array<struct mmsghdr, 16> headers;
+    struct std::array<detail::UdpSocketReceiveHelper, UdpSocketFd::max_message_batch_size> helpers;
+    struct std::array<struct mmsghdr, UdpSocketFd::max_message_batch_size> headers;
     size_t to_receive = min(messages.size(), headers.size());
     for (size_t i = 0; i < to_receive; i++) {
       helpers[i].to_native(messages[i], headers[i].msg_hdr);
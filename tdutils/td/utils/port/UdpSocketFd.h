@@ -73,6 +73,9 @@ class UdpSocketFd {
   Status send_message(const OutboundMessage &message, bool &is_sent) TD_WARN_UNUSED_RESULT;
   Status receive_message(InboundMessage &message, bool &is_received) TD_WARN_UNUSED_RESULT;
 
+  // maximum number of messages sent or received with one syscall on platforms with sendmmsg/recvmmsg
+  static constexpr size_t max_message_batch_size = 16;
+
   Status send_messages(Span<OutboundMessage> messages, size_t &count) TD_WARN_UNUSED_RESULT;
   Status receive_messages(MutableSpan<InboundMessage> messages, size_t &count) TD_WARN_UNUSED_RESULT;
 #elif TD_PORT_WINDOWS
@@ -20,9 +20,9 @@ namespace td {
 namespace detail {
 void Epoll::init() {
   CHECK(!epoll_fd_);
-  epoll_fd_ = NativeFd(epoll_create(1));
+  epoll_fd_ = NativeFd(epoll_create1(EPOLL_CLOEXEC));
   auto epoll_create_errno = errno;
-  LOG_IF(FATAL, !epoll_fd_) << Status::PosixError(epoll_create_errno, "epoll_create failed");
+  LOG_IF(FATAL, !epoll_fd_) << Status::PosixError(epoll_create_errno, "epoll_create1 failed");
 
   events_.resize(1000);
 }
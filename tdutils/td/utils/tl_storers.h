@@ -94,6 +94,11 @@ class TlStorerUnsafe {
   }
 };
 
+// Serialization is done in two passes on purpose: TlStorerCalcLength computes the exact
+// size, then TlStorerUnsafe writes into a single preallocated buffer. All consumers
+// (mtproto packets, size-prefixed binlog events) need the result contiguous with its
+// length known up front, so a single pass into growing chunks would only replace the
+// cheap length traversal with a merge copy of every byte.
 class TlStorerCalcLength {
   size_t length = 0;
 
@@ -10,17 +10,34 @@
 #include "td/utils/utf8.h"
 
 #include <algorithm>
-#include <unordered_map>
 #include <utility>
 
 namespace td {
 
-static const std::unordered_map<uint32, string> &get_en_to_ru_simple_rules() {
-  static const std::unordered_map<uint32, string> rules{
-      {'a', "а"}, {'b', "б"}, {'c', "к"}, {'d', "д"}, {'e', "е"}, {'f', "ф"},  {'g', "г"}, {'h', "х"}, {'i', "и"},
-      {'j', "й"}, {'k', "к"}, {'l', "л"}, {'m', "м"}, {'n', "н"}, {'o', "о"},  {'p', "п"}, {'q', "к"}, {'r', "р"},
-      {'s', "с"}, {'t', "т"}, {'u', "у"}, {'v', "в"}, {'w', "в"}, {'x', "кс"}, {'y', "и"}, {'z', "з"}};
-  return rules;
+// The per-character rules are kept in dense tables indexed by character code, so
+// transliterating a query on every keystroke does no hashing and no rule lookups
+// beyond an array access; nullptr means the character has no rule, while "" is a
+// valid replacement.
+static const char *get_en_to_ru_simple_rule(uint32 code) {
+  static const char *const rules[26] = {"а", "б", "к", "д", "е", "ф", "г", "х",  "и", "й", "к", "л", "м",
+                                        "н", "о", "п", "к", "р", "с", "т", "у",  "в", "в", "кс", "и", "з"};
+  if (code - 'a' < 26) {
+    return rules[code - 'a'];
+  }
+  return nullptr;
+}
+
+static const char *get_ru_to_en_simple_rule(uint32 code) {
+  static const char *const rules[32] = {"a",  "b",  "v",  "g",  "d",  "e",   "zh", "z", "i",  "y", "k",
+                                        "l",  "m",  "n",  "o",  "p",  "r",   "s",  "t", "u",  "f", "kh",
+                                        "ts", "ch", "sh", "sch", "",  "y",   "",   "e", "yu", "ya"};
+  if (code - 0x430 < 32) {
+    return rules[code - 0x430];
+  }
+  if (code == 0x451) {
+    return "e";
+  }
+  return nullptr;
 }
 
 static const std::vector<std::pair<string, string>> &get_en_to_ru_complex_rules() {
@@ -31,16 +48,6 @@ static const std::vector<std::pair<string, string>> &get_en_to_ru_complex_rules(
   return rules;
 }
 
-static const std::unordered_map<uint32, string> &get_ru_to_en_simple_rules() {
-  static const std::unordered_map<uint32, string> rules{
-      {0x430, "a"},  {0x431, "b"},  {0x432, "v"},  {0x433, "g"},  {0x434, "d"},  {0x435, "e"},   {0x451, "e"},
-      {0x436, "zh"}, {0x437, "z"},  {0x438, "i"},  {0x439, "y"},  {0x43a, "k"},  {0x43b, "l"},   {0x43c, "m"},
-      {0x43d, "n"},  {0x43e, "o"},  {0x43f, "p"},  {0x440, "r"},  {0x441, "s"},  {0x442, "t"},   {0x443, "u"},
-      {0x444, "f"},  {0x445, "kh"}, {0x446, "ts"}, {0x447, "ch"}, {0x448, "sh"}, {0x449, "sch"}, {0x44a, ""},
-      {0x44b, "y"},  {0x44c, ""},   {0x44d, "e"},  {0x44e, "yu"}, {0x44f, "ya"}};
-  return rules;
-}
-
 static const std::vector<std::pair<string, string>> &get_ru_to_en_complex_rules() {
   static const std::vector<std::pair<string, string>> rules{
       {"ий", "y"}, {"ия", "ia"}, {"кс", "x"}, {"yo", "e"}, {"jo", "e"}};
@@ -48,7 +55,7 @@ static const std::vector<std::pair<string, string>> &get_ru_to_en_complex_rules(
 }
 
 static void add_word_transliterations(vector<string> &result, Slice word, bool allow_partial,
-                                      const std::unordered_map<uint32, string> &simple_rules,
+                                      const char *(*simple_rules)(uint32),
                                       const std::vector<std::pair<string, string>> &complex_rules) {
   string s;
   auto pos = word.ubegin();
@@ -56,9 +63,9 @@ static void add_word_transliterations(vector<string> &result, Slice word, bool a
   while (pos != end) {
     uint32 code;
     pos = next_utf8_unsafe(pos, &code, "add_word_transliterations");
-    auto it = simple_rules.find(code);
-    if (it != simple_rules.end()) {
-      s += it->second;
+    auto *rule = simple_rules(code);
+    if (rule != nullptr) {
+      s += rule;
     } else {
       append_utf8_character(s, code);
     }
@@ -89,9 +96,9 @@ static void add_word_transliterations(vector<string> &result, Slice word, bool a
 
     uint32 code;
     pos = next_utf8_unsafe(pos, &code, "add_word_transliterations 2");
-    auto it = simple_rules.find(code);
-    if (it != simple_rules.end()) {
-      s += it->second;
+    auto *rule = simple_rules(code);
+    if (rule != nullptr) {
+      s += rule;
     } else {
       append_utf8_character(s, code);
     }
@@ -104,8 +111,8 @@ static void add_word_transliterations(vector<string> &result, Slice word, bool a
 vector<string> get_word_transliterations(Slice word, bool allow_partial) {
   vector<string> result;
 
-  add_word_transliterations(result, word, allow_partial, get_en_to_ru_simple_rules(), get_en_to_ru_complex_rules());
-  add_word_transliterations(result, word, allow_partial, get_ru_to_en_simple_rules(), get_ru_to_en_complex_rules());
+  add_word_transliterations(result, word, allow_partial, get_en_to_ru_simple_rule, get_en_to_ru_complex_rules());
+  add_word_transliterations(result, word, allow_partial, get_ru_to_en_simple_rule, get_ru_to_en_complex_rules());
 
   std::sort(result.begin(), result.end());
   result.erase(std::unique(result.begin(), result.end()), result.end());
@@ -12,10 +12,11 @@
 namespace td {
 
 bool check_utf8(CSlice str) {
-  const char *data = str.data();
-  const char *data_end = data + str.size();
+  const unsigned char *data = str.ubegin();
+  const unsigned char *data_end = str.uend();
   do {
-    unsigned int a = static_cast<unsigned char>(*data++);
+    data = utf8_skip_ascii(data, data_end);
+    unsigned int a = *data++;
     if ((a & 0x80) == 0) {
       if (data == data_end + 1) {
         return true;
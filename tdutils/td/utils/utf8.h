@@ -9,6 +9,8 @@
 #include "td/utils/common.h"
 #include "td/utils/Slice.h"
 
+#include <cstring>
+
 namespace td {
 
 /// checks UTF-8 string for correctness
@@ -19,11 +21,36 @@ inline bool is_utf8_character_first_code_unit(unsigned char c) {
   return (c & 0xC0) != 0x80;
 }
 
+/// advances the pointer over a prefix of ASCII-only bytes a word at a time;
+/// the pointer is never moved past the last complete word before end
+inline const unsigned char *utf8_skip_ascii(const unsigned char *ptr, const unsigned char *end) {
+  while (ptr + sizeof(uint64) <= end) {
+    uint64 word;
+    std::memcpy(&word, ptr, sizeof(word));
+    if ((word & 0x8080808080808080) != 0) {
+      break;
+    }
+    ptr += sizeof(word);
+  }
+  return ptr;
+}
+
 /// returns length of UTF-8 string in characters
 inline size_t utf8_length(Slice str) {
   size_t result = 0;
-  for (auto c : str) {
-    result += is_utf8_character_first_code_unit(c);
+  auto ptr = str.ubegin();
+  auto end = str.uend();
+  while (ptr != end) {
+    auto ascii_end = utf8_skip_ascii(ptr, end);
+    result += static_cast<size_t>(ascii_end - ptr);
+    ptr = ascii_end;
+    if (ptr == end) {
+      break;
+    }
+    auto block_end = ptr + sizeof(uint64) <= end ? ptr + sizeof(uint64) : end;
+    while (ptr != block_end) {
+      result += is_utf8_character_first_code_unit(*ptr++);
+    }
   }
   return result;
 }
@@ -31,8 +58,20 @@ inline size_t utf8_length(Slice str) {
 /// returns length of UTF-8 string in UTF-16 code units
 inline size_t utf8_utf16_length(Slice str) {
   size_t result = 0;
-  for (auto c : str) {
-    result += is_utf8_character_first_code_unit(c) + ((c & 0xf8) == 0xf0);
+  auto ptr = str.ubegin();
+  auto end = str.uend();
+  while (ptr != end) {
+    auto ascii_end = utf8_skip_ascii(ptr, end);
+    result += static_cast<size_t>(ascii_end - ptr);
+    ptr = ascii_end;
+    if (ptr == end) {
+      break;
+    }
+    auto block_end = ptr + sizeof(uint64) <= end ? ptr + sizeof(uint64) : end;
+    while (ptr != block_end) {
+      auto c = *ptr++;
+      result += is_utf8_character_first_code_unit(c) + ((c & 0xf8) == 0xf0);
+    }
   }
   return result;
 }
@@ -0,0 +1,66 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/EventArena.h"
+#include "td/utils/port/thread.h"
+#include "td/utils/Random.h"
+#include "td/utils/tests.h"
+
+#include <cstddef>
+#include <cstring>
+
+TEST(EventArena, simple) {
+  std::vector<void *> ptrs;
+  for (size_t size : {1, 17, 48, 100, 240, 496, 1000, 10000}) {
+    auto *ptr = td::EventArena::alloc(size);
+    CHECK(ptr != nullptr);
+    CHECK(reinterpret_cast<td::uint64>(ptr) % alignof(std::max_align_t) == 0);
+    std::memset(ptr, 0xab, size);
+    ptrs.push_back(ptr);
+  }
+  for (auto *ptr : ptrs) {
+    td::EventArena::dealloc(ptr);
+  }
+
+  // blocks of the same size class must be reused
+  auto *first = td::EventArena::alloc(40);
+  td::EventArena::dealloc(first);
+  auto *second = td::EventArena::alloc(40);
+  CHECK(first == second);
+  td::EventArena::dealloc(second);
+}
+
+#if !TD_THREAD_UNSUPPORTED
+TEST(EventArena, cross_thread_free) {
+  size_t threads_n = 4;
+  size_t qn = 20000;
+  std::vector<std::vector<void *>> ptrs(threads_n);
+  td::Stage run;
+  std::vector<td::thread> threads;
+  for (size_t id = 0; id < threads_n; id++) {
+    threads.push_back(td::thread([&, id] {
+      td::Random::Xorshift128plus rnd(static_cast<td::uint64>(id));
+      for (size_t i = 0; i < qn; i++) {
+        auto size = static_cast<size_t>(rnd.fast(1, 496));
+        auto *ptr = td::EventArena::alloc(size);
+        std::memset(ptr, 0xcd, size);
+        ptrs[id].push_back(ptr);
+      }
+      run.wait(threads_n);
+      // free blocks allocated by a neighbour thread, so the owning arena has
+      // to harvest its remote free list while it keeps allocating
+      for (auto *ptr : ptrs[(id + 1) % threads_n]) {
+        td::EventArena::dealloc(ptr);
+        td::EventArena::dealloc(td::EventArena::alloc(static_cast<size_t>(rnd.fast(1, 496))));
+      }
+    }));
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+#endif  //!TD_THREAD_UNSUPPORTED
@@ -0,0 +1,151 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/FlatHashMap.h"
+#include "td/utils/logging.h"
+#include "td/utils/Random.h"
+#include "td/utils/tests.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+TEST(FlatHashMap, basic) {
+  td::FlatHashMap<td::int32, td::int32> map;
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(0u, map.size());
+  ASSERT_TRUE(map.find(1) == map.end());
+
+  map[1] = 2;
+  ASSERT_EQ(1u, map.size());
+  ASSERT_EQ(2, map[1]);
+  ASSERT_EQ(1u, map.count(1));
+  ASSERT_EQ(0u, map.count(2));
+
+  auto emplace_result = map.emplace(1, 3);
+  ASSERT_TRUE(!emplace_result.second);
+  ASSERT_EQ(2, emplace_result.first->second);
+  emplace_result = map.emplace(2, 3);
+  ASSERT_TRUE(emplace_result.second);
+  ASSERT_EQ(3, emplace_result.first->second);
+  ASSERT_EQ(2u, map.size());
+
+  auto it = map.find(1);
+  ASSERT_TRUE(it != map.end());
+  it->second = 4;
+  ASSERT_EQ(4, map[1]);
+  map.erase(it);
+  ASSERT_EQ(1u, map.size());
+  ASSERT_TRUE(map.find(1) == map.end());
+  ASSERT_EQ(1u, map.erase(2));
+  ASSERT_EQ(0u, map.erase(2));
+  ASSERT_TRUE(map.empty());
+
+  map[5] = 6;
+  auto copy = map;
+  map.clear();
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(1u, copy.size());
+  ASSERT_EQ(6, copy[5]);
+
+  auto moved = std::move(copy);
+  ASSERT_EQ(6, moved[5]);
+}
+
+TEST(FlatHashMap, movable_values) {
+  td::FlatHashMap<td::int64, td::unique_ptr<td::int32>> map;
+  for (td::int32 i = 0; i < 100; i++) {
+    map.emplace(i, td::make_unique<td::int32>(i * i));
+  }
+  // pointers stored through unique_ptr must survive rehashes
+  auto *value = map.find(7)->second.get();
+  for (td::int32 i = 100; i < 1000; i++) {
+    map[i] = td::make_unique<td::int32>(i * i);
+  }
+  ASSERT_TRUE(map.find(7)->second.get() == value);
+  ASSERT_EQ(49, *value);
+}
+
+TEST(FlatHashMap, identity_hash) {
+  // std::hash<int64> may be an identity function, and message identifiers have
+  // their low bits zero, so all keys could collapse into one bucket without hash mixing
+  td::FlatHashMap<td::int64, td::int32> map;
+  for (td::int32 i = 0; i < 10000; i++) {
+    map[static_cast<td::int64>(i) << 20] = i;
+  }
+  ASSERT_EQ(10000u, map.size());
+  for (td::int32 i = 0; i < 10000; i++) {
+    ASSERT_EQ(i, map[static_cast<td::int64>(i) << 20]);
+  }
+}
+
+TEST(FlatHashMap, stress) {
+  td::Random::Xorshift128plus rnd(123);
+  td::FlatHashMap<td::int32, td::int32> map;
+  std::unordered_map<td::int32, td::int32> reference;
+
+  for (int test = 0; test < 1000; test++) {
+    auto key = static_cast<td::int32>(rnd() % 100);
+    auto value = static_cast<td::int32>(rnd());
+    switch (rnd() % 5) {
+      case 0:
+        map[key] = value;
+        reference[key] = value;
+        break;
+      case 1:
+        ASSERT_EQ(reference.emplace(key, value).second, map.emplace(key, value).second);
+        break;
+      case 2:
+        ASSERT_EQ(reference.erase(key), map.erase(key));
+        break;
+      case 3: {
+        auto it = map.find(key);
+        auto reference_it = reference.find(key);
+        ASSERT_EQ(reference_it == reference.end(), it == map.end());
+        if (it != map.end()) {
+          ASSERT_EQ(reference_it->second, it->second);
+        }
+        break;
+      }
+      case 4: {
+        ASSERT_EQ(reference.size(), map.size());
+        td::vector<std::pair<td::int32, td::int32>> entries(map.begin(), map.end());
+        td::vector<std::pair<td::int32, td::int32>> reference_entries(reference.begin(), reference.end());
+        std::sort(entries.begin(), entries.end());
+        std::sort(reference_entries.begin(), reference_entries.end());
+        ASSERT_TRUE(entries == reference_entries);
+        break;
+      }
+      default:
+        UNREACHABLE();
+    }
+  }
+}
+
+TEST(FlatHashSet, basic) {
+  td::FlatHashSet<td::int32> set;
+  ASSERT_TRUE(set.empty());
+  ASSERT_TRUE(set.insert(1).second);
+  ASSERT_TRUE(!set.insert(1).second);
+  ASSERT_TRUE(set.insert(2).second);
+  ASSERT_EQ(2u, set.size());
+  ASSERT_EQ(1u, set.count(1));
+  ASSERT_EQ(0u, set.count(3));
+  ASSERT_TRUE(set.find(2) != set.end());
+  ASSERT_EQ(1u, set.erase(1));
+  ASSERT_EQ(0u, set.erase(1));
+  ASSERT_EQ(1u, set.size());
+
+  td::int64 sum = 0;
+  for (auto key : set) {
+    sum += key;
+  }
+  ASSERT_EQ(2, sum);
+
+  set.clear();
+  ASSERT_TRUE(set.empty());
+}
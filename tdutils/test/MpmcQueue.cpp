@@ -11,6 +11,7 @@
 #include "td/utils/tests.h"
 
 #include <algorithm>
+#include <atomic>
 #include <tuple>
 
 TEST(OneValue, simple) {
@@ -205,3 +206,114 @@ TEST(MpmcQueue, multi_thread) {
   LOG_CHECK(q.hazard_pointers_to_delele_size_unsafe() == 0) << q.hazard_pointers_to_delele_size_unsafe();
 }
 #endif  //!TD_THREAD_UNSUPPORTED
+
+TEST(MpmcBoundedQueue, simple) {
+  td::MpmcBoundedQueue<int> q(16);
+  CHECK(q.capacity() == 16);
+  int x = 0;
+  CHECK(!q.try_pop(x));
+  for (int t = 0; t < 3; t++) {
+    for (int i = 0; i < 16; i++) {
+      CHECK(q.try_push(i));
+    }
+    CHECK(!q.try_push(16));
+    for (int i = 0; i < 16; i++) {
+      CHECK(q.try_pop(x));
+      LOG_CHECK(x == i) << x << " expected " << i;
+    }
+    CHECK(!q.try_pop(x));
+  }
+
+  for (int i = 0; i < 10; i++) {
+    CHECK(q.try_push(i));
+  }
+  int values[16];
+  auto count = q.try_pop_batch(values, 4);
+  CHECK(count == 4);
+  for (int i = 0; i < 4; i++) {
+    CHECK(values[i] == i);
+  }
+  count = q.try_pop_batch(values, 16);
+  CHECK(count == 6);
+  for (int i = 0; i < 6; i++) {
+    CHECK(values[i] == i + 4);
+  }
+  CHECK(q.try_pop_batch(values, 16) == 0);
+}
+
+#if !TD_THREAD_UNSUPPORTED
+TEST(MpmcBoundedQueue, multi_thread) {
+  size_t n = 4;
+  size_t m = 4;
+  struct Data {
+    size_t from{0};
+    size_t value{0};
+  };
+  struct ThreadData {
+    std::vector<Data> v;
+    char pad[64];
+  };
+  td::MpmcBoundedQueue<Data> q(64);
+  std::vector<td::thread> n_threads(n);
+  std::vector<td::thread> m_threads(m);
+  std::vector<ThreadData> thread_data(m);
+  std::atomic<size_t> left_writers{n};
+  size_t qn = 100000;
+  size_t thread_id = 0;
+  for (auto &thread : m_threads) {
+    thread = td::thread([&, thread_id] {
+      Data batch[16];
+      while (true) {
+        auto count = q.try_pop_batch(batch, 16);
+        if (count == 0) {
+          if (left_writers.load(std::memory_order_acquire) == 0 && q.try_pop_batch(batch, 16) == 0) {
+            return;
+          }
+          td::this_thread::yield();
+          continue;
+        }
+        for (size_t i = 0; i < count; i++) {
+          thread_data[thread_id].v.push_back(batch[i]);
+        }
+      }
+    });
+    thread_id++;
+  }
+  for (auto &thread : n_threads) {
+    thread = td::thread([&, thread_id] {
+      for (size_t i = 0; i < qn; i++) {
+        Data data;
+        data.from = thread_id - m;
+        data.value = i + 1;
+        while (!q.try_push(data)) {
+          td::this_thread::yield();
+        }
+      }
+      left_writers.fetch_sub(1, std::memory_order_release);
+    });
+    thread_id++;
+  }
+  for (auto &thread : n_threads) {
+    thread.join();
+  }
+  for (auto &thread : m_threads) {
+    thread.join();
+  }
+  std::vector<Data> all;
+  for (size_t i = 0; i < m; i++) {
+    std::vector<size_t> from(n, 0);
+    for (auto &data : thread_data[i].v) {
+      all.push_back(data);
+      CHECK(data.value > from[data.from]);
+      from[data.from] = data.value;
+    }
+  }
+  LOG_CHECK(all.size() == n * qn) << all.size();
+  std::sort(all.begin(), all.end(),
+            [](const auto &a, const auto &b) { return std::tie(a.from, a.value) < std::tie(b.from, b.value); });
+  for (size_t i = 0; i < n * qn; i++) {
+    CHECK(all[i].from == i / qn);
+    CHECK(all[i].value == i % qn + 1);
+  }
+}
+#endif  //!TD_THREAD_UNSUPPORTED
@@ -0,0 +1,98 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/tests.h"
+
+#include "td/utils/common.h"
+#include "td/utils/Random.h"
+#include "td/utils/TimerWheel.h"
+
+#include <algorithm>
+#include <map>
+
+REGISTER_TESTS(timer_wheel)
+
+using namespace td;
+
+TEST(TimerWheel, simple) {
+  TimerWheel wheel(0, 0.1);
+  TimerWheelNode node;
+  wheel.insert(1.0, &node);
+  ASSERT_EQ(1u, wheel.size());
+  ASSERT_TRUE(node.in_wheel());
+
+  int fired = 0;
+  wheel.run_expired(0.5, [&](TimerWheelNode *expired_node) { fired++; });
+  ASSERT_EQ(0, fired);
+
+  wheel.run_expired(1.5, [&](TimerWheelNode *expired_node) {
+    ASSERT_TRUE(expired_node == &node);
+    fired++;
+  });
+  ASSERT_EQ(1, fired);
+  ASSERT_TRUE(wheel.empty());
+  ASSERT_TRUE(!node.in_wheel());
+}
+
+TEST(TimerWheel, cancel) {
+  TimerWheel wheel(100, 0.1);
+  TimerWheelNode node;
+  wheel.insert(105, &node);
+  wheel.erase(&node);
+  ASSERT_TRUE(wheel.empty());
+
+  int fired = 0;
+  wheel.run_expired(1000, [&](TimerWheelNode *expired_node) { fired++; });
+  ASSERT_EQ(0, fired);
+}
+
+TEST(TimerWheel, random) {
+  Random::Xorshift128plus rnd(123);
+  double now = 1000;
+  TimerWheel wheel(now, 0.1);
+  std::vector<TimerWheelNode> nodes(10000);
+  std::map<TimerWheelNode *, double> expected;
+
+  for (int iter = 0; iter < 100; iter++) {
+    for (auto &node : nodes) {
+      if (node.in_wheel() && rnd() % 4 == 0) {
+        wheel.erase(&node);
+        expected.erase(&node);
+        continue;
+      }
+      double timeout = now + static_cast<double>(rnd() % 100000) * 0.01;
+      if (node.in_wheel()) {
+        wheel.fix(timeout, &node);
+      } else {
+        wheel.insert(timeout, &node);
+      }
+      expected[&node] = timeout;
+    }
+    ASSERT_EQ(expected.size(), wheel.size());
+
+    if (!wheel.empty()) {
+      double wakeup_at = wheel.get_wakeup_timestamp();
+      double min_timeout = 1e100;
+      for (auto &it : expected) {
+        min_timeout = td::min(min_timeout, it.second);
+      }
+      ASSERT_TRUE(wakeup_at <= min_timeout + 0.1 + 1e-9);
+    }
+
+    now += static_cast<double>(rnd() % 10000) * 0.01;
+    wheel.run_expired(now, [&](TimerWheelNode *node) {
+      auto it = expected.find(node);
+      CHECK(it != expected.end());
+      // timers may fire up to one tick late, but never much too early
+      CHECK(it->second <= now + 0.1 + 1e-9);
+      expected.erase(it);
+    });
+    for (auto &it : expected) {
+      // everything due before now must have fired
+      CHECK(it.second > now - 0.2);
+    }
+  }
+}
@@ -8,6 +8,7 @@
 
 #include "td/utils/buffer.h"
 #include "td/utils/Random.h"
+#include "td/utils/StringBuilder.h"
 
 using namespace td;
 
@@ -56,3 +57,43 @@ TEST(Buffer, buffer_builder) {
     ASSERT_EQ(builder.extract().as_slice(), str);
   }
 }
+
+TEST(Buffer, chain_string_builder) {
+  ChainBufferWriter writer;
+  StringBuilder sb(writer);
+  std::string expected;
+  for (int i = 0; i < 100000; i++) {
+    sb << "prefix" << i << '\t';
+    expected += "prefix";
+    expected += std::to_string(i);
+    expected += '\t';
+  }
+  ASSERT_TRUE(!sb.is_error());
+  sb.flush();
+  auto reader = writer.extract_reader();
+  ASSERT_EQ(expected.size(), reader.size());
+  ASSERT_EQ(expected, reader.move_as_buffer_slice().as_slice().str());
+}
+
+TEST(Buffer, allocator_stats) {
+  auto old_stats = BufferAllocator::get_stats();
+  for (int i = 0; i < 100; i++) {
+    BufferSlice a(32);
+    BufferSlice b(256);
+  }
+  BufferSlice c(100000);
+  auto new_stats = BufferAllocator::get_stats();
+  ASSERT_TRUE(new_stats.slab_reuse_count > old_stats.slab_reuse_count);
+  ASSERT_TRUE(new_stats.slab_alloc_count >= old_stats.slab_alloc_count);
+  ASSERT_TRUE(new_stats.exact_alloc_count > old_stats.exact_alloc_count);
+}
+
+TEST(Buffer, allocator_recycling) {
+  BufferSlice init(32);  // make sure that the thread-local allocator state exists
+  auto old_stats = BufferAllocator::get_stats();
+  for (int i = 0; i < 100; i++) {
+    BufferSlice a(4096);
+  }
+  auto new_stats = BufferAllocator::get_stats();
+  ASSERT_TRUE(new_stats.recycle_count > old_stats.recycle_count);
+}
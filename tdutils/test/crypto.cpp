@@ -64,6 +64,50 @@ TEST(Crypto, AesCtrState) {
   }
 }
 
+TEST(Crypto, AesIge) {
+  td::vector<td::uint32> answers{2045698207u, 2423540300u, 525522475u, 1545267325u, 724143417u};
+
+  std::size_t i = 0;
+  for (auto length : {16, 32, 256, 1024, 65536}) {
+    td::uint32 seed = length;
+    td::string s(length, '\0');
+    for (auto &c : s) {
+      seed = seed * 123457567u + 987651241u;
+      c = static_cast<char>((seed >> 23) & 255);
+    }
+
+    td::UInt256 key;
+    for (auto &c : key.raw) {
+      seed = seed * 123457567u + 987651241u;
+      c = (seed >> 23) & 255;
+    }
+    td::string iv(32, '\0');
+    for (auto &c : iv) {
+      seed = seed * 123457567u + 987651241u;
+      c = static_cast<char>((seed >> 23) & 255);
+    }
+
+    td::string t(length, '\0');
+    auto iv_copy = iv;
+    td::aes_ige_encrypt(as_slice(key), iv_copy, s, t);
+    ASSERT_EQ(answers[i], td::crc32(t));
+
+    // encrypting by halves must give the same result, because the updated iv continues the chaining
+    auto half = static_cast<std::size_t>(length) / 32 * 16;
+    td::string t2(length, '\0');
+    iv_copy = iv;
+    td::aes_ige_encrypt(as_slice(key), iv_copy, td::Slice(s).substr(0, half), td::MutableSlice(t2).substr(0, half));
+    td::aes_ige_encrypt(as_slice(key), iv_copy, td::Slice(s).substr(half), td::MutableSlice(t2).substr(half));
+    ASSERT_STREQ(t, t2);
+
+    iv_copy = iv;
+    td::aes_ige_decrypt(as_slice(key), iv_copy, t, t);
+    ASSERT_STREQ(s, t);
+
+    i++;
+  }
+}
+
 TEST(Crypto, Sha256State) {
   for (auto length : {0, 1, 31, 32, 33, 9999, 10000, 10001, 999999, 1000001}) {
     auto s = td::rand_string(std::numeric_limits<char>::min(), std::numeric_limits<char>::max(), length);
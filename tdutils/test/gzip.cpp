@@ -35,6 +35,18 @@ TEST(Gzip, gzencode_gzdecode) {
   encode_decode(str);
 }
 
+TEST(Gzip, gzdecode_one_shot) {
+  // cover both sides of the one-shot fast path: payloads that fit into the single
+  // output buffer, and highly compressible payloads that overflow the output size
+  // guess and fall back to the chained decoder
+  for (auto size : {1, 100, 1000, 4000}) {
+    encode_decode(td::rand_string(0, 127, size));
+  }
+  for (auto size : {1000, 5000, 100000, 1000000}) {
+    encode_decode(td::string(size, 'a'));
+  }
+}
+
 TEST(Gzip, flow) {
   auto str = td::rand_string('a', 'z', 1000000);
   auto parts = td::rand_split(str);
@@ -0,0 +1,73 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2019
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/Hints.h"
+#include "td/utils/tests.h"
+
+#include <utility>
+
+static void check_search(const td::Hints &hints, td::Slice query, td::vector<td::int64> expected) {
+  auto result = hints.search(query, 1000000);
+  ASSERT_EQ(expected.size(), result.first);
+  ASSERT_TRUE(result.second == expected);
+}
+
+TEST(Hints, search) {
+  td::Hints hints;
+  hints.add(1, "alice smith");
+  hints.add(2, "bob smith");
+  hints.add(3, "alicia keys");
+
+  check_search(hints, "al", {1, 3});
+  check_search(hints, "alice", {1});
+  check_search(hints, "smith", {1, 2});
+  check_search(hints, "smith al", {1});
+  check_search(hints, "smith carol", {});
+  check_search(hints, "", {});
+
+  ASSERT_EQ(3u, hints.size());
+  ASSERT_TRUE(hints.has_key(2));
+  ASSERT_EQ("bob smith", hints.key_to_string(2));
+
+  // results with equal ratings are ordered by key
+  auto all = hints.search_empty(2);
+  ASSERT_EQ(3u, all.first);
+  ASSERT_TRUE(all.second == td::vector<td::int64>({1, 2}));
+
+  hints.set_rating(2, -1);
+  check_search(hints, "smith", {2, 1});
+
+  hints.add(1, "carol white");
+  check_search(hints, "smith", {2});
+  check_search(hints, "carol", {1});
+
+  hints.remove(2);
+  ASSERT_TRUE(!hints.has_key(2));
+  check_search(hints, "smith", {});
+}
+
+TEST(Hints, many_keys_per_word) {
+  td::Hints hints;
+  for (td::int64 key = 1; key <= 100; key++) {
+    hints.add(key, PSLICE() << "user" << key << " common");
+  }
+  auto result = hints.search("common", 10);
+  ASSERT_EQ(100u, result.first);
+  ASSERT_EQ(10u, result.second.size());
+  ASSERT_TRUE(result.second == td::vector<td::int64>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+
+  check_search(hints, "user1 common", {1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 100});
+
+  for (td::int64 key = 1; key <= 100; key += 2) {
+    hints.remove(key);
+  }
+  result = hints.search("common", 1000000);
+  ASSERT_EQ(50u, result.first);
+  for (auto key : result.second) {
+    ASSERT_EQ(0, key % 2);
+  }
+}
@@ -93,3 +93,31 @@ TEST(JSON, kphp) {
       "{\"keyboard\":[[\"\\u2022 abcdefg\"],[\"\\u2022 hijklmnop\"],[\"\\u2022 "
       "qrstuvwxyz\"]],\"one_time_keyboard\":true}");
 }
+
+TEST(JSON, string_escaping) {
+  auto json_string = [](Slice str) {
+    char buf[256];
+    StringBuilder sb(MutableSlice{buf, sizeof(buf)});
+    sb << JsonString(str);
+    CHECK(!sb.is_error());
+    return sb.as_cslice().str();
+  };
+  auto json_raw_string = [](Slice str) {
+    char buf[256];
+    StringBuilder sb(MutableSlice{buf, sizeof(buf)});
+    sb << JsonRawString(str);
+    CHECK(!sb.is_error());
+    return sb.as_cslice().str();
+  };
+
+  ASSERT_EQ("\"\"", json_string(""));
+  ASSERT_EQ("\"abcdefghijklmnopqrstuvwxyz 0123456789\"", json_string("abcdefghijklmnopqrstuvwxyz 0123456789"));
+  ASSERT_EQ("\"quote \\\" in the middle\"", json_string("quote \" in the middle"));
+  ASSERT_EQ("\"\\\\ \\b \\f \\n \\r \\t \\u0001\"", json_string("\\ \b \f \n \r \t \x01"));
+  ASSERT_EQ("\"\\u043f\"", json_string("\xd0\xbf"));
+  ASSERT_EQ("\"\\ud83d\\ude00\"", json_string("\xf0\x9f\x98\x80"));
+  ASSERT_EQ("\"long enough ascii prefix before \\u043f and an ascii suffix afterwards\"",
+            json_string("long enough ascii prefix before \xd0\xbf and an ascii suffix afterwards"));
+  ASSERT_EQ("\"raw \xd0\xbf bytes are left intact\"", json_raw_string("raw \xd0\xbf bytes are left intact"));
+  ASSERT_EQ("\"raw control \\u0002 character\"", json_raw_string("raw control \x02 character"));
+}
@@ -1012,3 +1012,23 @@ TEST(Misc, CancellationToken) {
   source = CancellationTokenSource{};
   CHECK(token4);
 }
+
+TEST(Misc, check_utf8) {
+  CHECK(check_utf8(""));
+  CHECK(check_utf8("a"));
+  CHECK(check_utf8("abcdefghijklmnopqrstuvwxyz0123456789"));
+  CHECK(check_utf8("\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82"));
+  CHECK(check_utf8("long ascii prefix before a \xe2\x82\xac sign and an ascii suffix afterwards"));
+  CHECK(check_utf8("\xf0\x9f\x98\x80"));
+  CHECK(!check_utf8("\x80"));
+  CHECK(!check_utf8("\xc0\x80"));
+  CHECK(!check_utf8("\xe2\x82"));
+  CHECK(!check_utf8("\xed\xa0\x80"));  // surrogate
+  CHECK(!check_utf8("\xf5\x80\x80\x80"));
+  CHECK(!check_utf8("0123456789abcdef\xff"));
+  CHECK(!check_utf8("0123456789abcdef\xe2\x82"));
+
+  string str = "0123456789abcdef\xd0\xbf\xf0\x9f\x98\x80 tail";
+  ASSERT_EQ(utf8_length(str), 16u + 1 + 1 + 5);
+  ASSERT_EQ(utf8_utf16_length(str), 16u + 1 + 2 + 5);
+}